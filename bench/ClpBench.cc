@@ -0,0 +1,587 @@
+#include "ClpEventHandler.hpp"
+#include "ClpPresolve.hpp"
+#include "ClpSimplex.hpp"
+#include "CoinError.hpp"
+#include "CoinProfile.hpp"
+#include "floatdef.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+thread_local FILE * CbcOrClpReadCommand = stdin;
+thread_local int CbcOrClpRead_mode = 1;
+
+// clp-bench [--repeats n] [--method primal|dual] [--no-presolve] [--scaled k1,k2,...]
+//           [--json file.jsonl] [--compare baseline.jsonl] [--threshold percent] [--min-ms ms]
+//           [--profile file.folded] [files or directories...]
+//
+// Solves every model several times and reports the median time of each phase: parse (CoinLpIO,
+// or the MPS reader), presolve, factorize (refactorizations and the solution recomputed after
+// each of them), iterate (simplex pivots, those of the cleanup after postsolve included),
+// postsolve and serialize (the solution written out like solve() of the wrapper). The models are
+// the given LP/MPS files and directories, tests/data by default, plus generated transportation
+// problems of k sources and k sinks for every --scaled size (--scaled none for the files alone,
+// such as the models of clp-lpgen). Integer models are solved as LPs.
+//
+// --json writes one JSON line per model, --compare reads such a file from another build and
+// flags every phase that got slower by more than --threshold percent (10 by default) and
+// --min-ms milliseconds (0.5 by default); the exit status is 1 when there is a regression.
+//
+// --profile writes the CoinProfile regions of all the runs as collapsed stacks for flamegraph.pl
+// or speedscope, with a summary per region path next to it in file.txt. The regions are only
+// compiled in by the CLP_PROFILE option of CMake. clp-bench-counted, built by the CLP_OP_COUNTS
+// option, also writes the FloatT operations run in each region path to file.ops.txt.
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// integer durations only, floatdef.h specializes std::common_type<T, double>
+double elapsedMs(Clock::time_point start, Clock::time_point end = Clock::now())
+{
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return static_cast<double>(ns) / 1.0e6;
+}
+
+enum Phase
+{
+    PARSE,
+    PRESOLVE,
+    FACTORIZE,
+    ITERATE,
+    POSTSOLVE,
+    SERIALIZE,
+    PHASE_COUNT
+};
+
+const char * const PhaseNames[PHASE_COUNT] = { "parse", "presolve", "factorize", "iterate", "postsolve", "serialize" };
+
+using PhaseTimes = std::array<double, PHASE_COUNT>;
+
+struct SimplexClock
+{
+    Clock::time_point mark;
+    int factorizations = 0;
+    PhaseTimes * times = nullptr;
+};
+
+// Splits the time of primal() and dual() at their events: the main loop of both refactorizes and
+// recomputes the solution, sends endOfFactorization and then pivots, sending endOfIteration after
+// every pivot. Whatever follows the last event, the final refactorization and checks, is added to
+// FACTORIZE by the caller
+class PhaseHandler : public ClpEventHandler
+{
+public:
+    explicit PhaseHandler(SimplexClock * clock)
+    : _clock(clock)
+    {
+    }
+
+    ClpEventHandler * clone() const override
+    {
+        return new PhaseHandler(*this);
+    }
+
+    int event(Event whichEvent) override
+    {
+        if (whichEvent != endOfFactorization && whichEvent != endOfIteration)
+            return -1;
+        const auto now = Clock::now();
+        if (whichEvent == endOfFactorization)
+        {
+            (*_clock->times)[FACTORIZE] += elapsedMs(_clock->mark, now);
+            ++_clock->factorizations;
+        }
+        else
+        {
+            (*_clock->times)[ITERATE] += elapsedMs(_clock->mark, now);
+        }
+        _clock->mark = now;
+        return -1;
+    }
+
+private:
+    SimplexClock * _clock;
+};
+
+struct Options
+{
+    int repeats = 5;
+    bool dual = false;
+    bool presolve = true;
+    int precision = 9;
+};
+
+struct Model
+{
+    std::string name;
+    /// LP text, or the path of an MPS file
+    std::string content;
+    bool mps = false;
+};
+
+struct Result
+{
+    std::string name;
+    int rows = 0;
+    int columns = 0;
+    int iterations = 0;
+    int factorizations = 0;
+    int status = -1;
+    std::string objective;
+    PhaseTimes times {};
+};
+
+// Small LCG so the generated models are the same on every build
+class Generator
+{
+public:
+    explicit Generator(uint32_t seed) : _state(seed) {}
+
+    int next(int range)
+    {
+        _state = 1664525u * _state + 1013904223u;
+        return static_cast<int>((_state >> 8) % static_cast<uint32_t>(range));
+    }
+
+private:
+    uint32_t _state;
+};
+
+// Balanced transportation problem with k sources and k sinks: 2k rows, k * k columns, and the
+// degeneracy typical of assignment-like models
+std::string transportationModel(int k)
+{
+    Generator random(static_cast<uint32_t>(k));
+    std::vector<int> supply(k), demand(k);
+    int total = 0;
+    for (int i = 0; i < k; ++i)
+        total += supply[i] = 10 + random.next(90);
+    for (int j = 0; j + 1 < k; ++j)
+    {
+        demand[j] = std::min(total, total / k + random.next(10));
+        total -= demand[j];
+    }
+    demand[k - 1] = total;
+
+    std::ostringstream lp;
+    lp << "Minimize\n obj:";
+    for (int i = 0; i < k; ++i)
+    {
+        for (int j = 0; j < k; ++j)
+            lp << " + " << 1 + random.next(100) << "." << random.next(100) << " x" << i << "_" << j;
+        lp << "\n";
+    }
+    lp << "Subject To\n";
+    for (int i = 0; i < k; ++i)
+    {
+        lp << " s" << i << ":";
+        for (int j = 0; j < k; ++j)
+            lp << " + x" << i << "_" << j;
+        lp << " <= " << supply[i] << "\n";
+    }
+    for (int j = 0; j < k; ++j)
+    {
+        lp << " d" << j << ":";
+        for (int i = 0; i < k; ++i)
+            lp << " + x" << i << "_" << j;
+        lp << " >= " << demand[j] << "\n";
+    }
+    lp << "End\n";
+    return lp.str();
+}
+
+bool isModelFile(const std::filesystem::path & path)
+{
+    const auto extension = path.extension().string();
+    return extension == ".lp" || extension == ".mps";
+}
+
+void addModelFile(const std::filesystem::path & path, std::vector<Model> & models)
+{
+    Model model;
+    model.name = path.filename().string();
+    model.mps = path.extension() == ".mps";
+    if (model.mps)
+    {
+        model.content = path.string();
+    }
+    else
+    {
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        model.content = content.str();
+    }
+    models.push_back(std::move(model));
+}
+
+void addModels(const std::string & fileOrDirectory, std::vector<Model> & models)
+{
+    namespace fs = std::filesystem;
+    if (!fs::exists(fileOrDirectory))
+    {
+        std::cerr << "Skipping " << fileOrDirectory << ": not found" << std::endl;
+        return;
+    }
+    if (!fs::is_directory(fileOrDirectory))
+    {
+        addModelFile(fileOrDirectory, models);
+        return;
+    }
+    std::vector<fs::path> files;
+    for (const auto & entry : fs::directory_iterator(fileOrDirectory))
+    {
+        if (entry.is_regular_file() && isModelFile(entry.path()))
+            files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+    for (const auto & file : files)
+        addModelFile(file, models);
+}
+
+// The solution as solve() of the wrapper writes it: names, values and objective
+std::string serialize(const ClpSimplex & model, int precision)
+{
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(precision) << "{\"variables\":[";
+    const auto columns = model.getNumCols();
+    for (int i = 0; i < columns; ++i)
+        json << (i ? ",\"" : "\"") << model.getColumnName(i) << '"';
+    json << "],\"solution\":[";
+    const auto solution = model.getColSolution();
+    for (int i = 0; i < columns; ++i)
+        json << (i ? ",\"" : "\"") << solution[i] << '"';
+    json << "],\"objectiveValue\":\"" << model.objectiveValue() << "\"}";
+    return json.str();
+}
+
+// One solve of a model, the phase times added to result.times
+void runOnce(const Model & source, const Options & options, Result & result)
+{
+    auto & times = result.times;
+    SimplexClock clock;
+    clock.times = &times;
+    const PhaseHandler handler(&clock);
+
+    ClpSimplex model;
+    model.setLogLevel(0);
+    model.passInEventHandler(&handler);
+    auto start = Clock::now();
+    int errors = 1;
+    try
+    {
+        std::istringstream stream(source.content);
+        errors = source.mps ? model.readMps(source.content.c_str(), true) : model.readLp(stream);
+    }
+    catch (const CoinError &)
+    {
+        // CoinLpIO throws on malformed input, the model is reported with status -1
+    }
+    times[PARSE] += elapsedMs(start);
+    if (errors)
+        return;
+
+    const auto solve = [&](ClpSimplex & simplex) {
+        clock.mark = Clock::now();
+        if (options.dual)
+            simplex.dual();
+        else
+            simplex.primal();
+        times[FACTORIZE] += elapsedMs(clock.mark);
+    };
+
+    ClpPresolve presolve;
+    ClpSimplex * presolved = nullptr;
+    if (options.presolve)
+    {
+        start = Clock::now();
+        presolved = presolve.presolvedModel(model, 1.0e-8);
+        times[PRESOLVE] += elapsedMs(start);
+    }
+    if (presolved)
+    {
+        presolved->setLogLevel(0);
+        presolved->passInEventHandler(&handler);
+        solve(*presolved);
+        const auto iterations = presolved->numberIterations();
+        start = Clock::now();
+        presolve.postsolve(true);
+        delete presolved;
+        times[POSTSOLVE] += elapsedMs(start);
+        // the basis is optimal after postsolve unless the tolerances disagree
+        clock.mark = Clock::now();
+        model.primal(1);
+        times[FACTORIZE] += elapsedMs(clock.mark);
+        result.iterations = iterations + model.numberIterations();
+    }
+    else
+    {
+        solve(model);
+        result.iterations = model.numberIterations();
+    }
+    result.factorizations = clock.factorizations;
+    result.status = model.status();
+    result.rows = model.getNumRows();
+    result.columns = model.getNumCols();
+
+    start = Clock::now();
+    const auto json = serialize(model, options.precision);
+    times[SERIALIZE] += elapsedMs(start);
+    // the objective as serialized, so builds can be checked to agree on it
+    const auto objective = json.rfind(":\"");
+    result.objective = json.substr(objective + 2, json.size() - objective - 4);
+}
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const auto n = values.size();
+    return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+Result bench(const Model & model, const Options & options)
+{
+    Result result;
+    std::array<std::vector<double>, PHASE_COUNT> samples;
+    // a first unmeasured run takes the allocations and cold caches out of small models
+    runOnce(model, options, result);
+    for (int r = 0; r < options.repeats; ++r)
+    {
+        result.times.fill(0);
+        runOnce(model, options, result);
+        for (int p = 0; p < PHASE_COUNT; ++p)
+            samples[p].push_back(result.times[p]);
+    }
+    result.name = model.name;
+    for (int p = 0; p < PHASE_COUNT; ++p)
+        result.times[p] = median(samples[p]);
+    return result;
+}
+
+void writeJson(std::ostream & out, const Result & result)
+{
+    out << "{\"model\":\"" << result.name << "\",\"engine\":\"" << CLP_FLOAT_ENGINE << "\",\"rows\":" << result.rows
+        << ",\"columns\":" << result.columns << ",\"status\":" << result.status
+        << ",\"iterations\":" << result.iterations << ",\"factorizations\":" << result.factorizations
+        << ",\"objective\":\"" << result.objective << "\"" << std::fixed << std::setprecision(4);
+    for (int p = 0; p < PHASE_COUNT; ++p)
+        out << ",\"" << PhaseNames[p] << "Ms\":" << result.times[p];
+    out << "}\n";
+}
+
+void writeRow(std::ostream & out, const Result & result)
+{
+    double total = 0;
+    for (const auto t : result.times)
+        total += t;
+    const auto simplexMs = result.times[FACTORIZE] + result.times[ITERATE];
+    out << std::left << std::setw(28) << result.name << std::right << std::setw(7) << result.rows << std::setw(8)
+        << result.columns << std::setw(7) << result.iterations << std::fixed << std::setprecision(2);
+    for (const auto t : result.times)
+        out << std::setw(11) << t;
+    out << std::setw(11) << total << std::setw(10) << (result.iterations ? 1000.0 * simplexMs / result.iterations : 0.0)
+        << "  " << result.objective << "\n";
+}
+
+void writeHeader(std::ostream & out)
+{
+    out << std::left << std::setw(28) << "model" << std::right << std::setw(7) << "rows" << std::setw(8) << "columns"
+        << std::setw(7) << "iters";
+    for (const auto name : PhaseNames)
+        out << std::setw(11) << name;
+    out << std::setw(11) << "total ms" << std::setw(10) << "us/iter"
+        << "  objective\n";
+}
+
+// Phase times of every model of a --json file, read back without a JSON library: each line is
+// flat and written by writeJson()
+std::map<std::string, PhaseTimes> readBaseline(const std::string & path)
+{
+    std::map<std::string, PhaseTimes> baseline;
+    std::ifstream file(path);
+    std::string line;
+    const auto field = [&](const std::string & key) -> std::string {
+        const auto quoted = "\"" + key + "\":";
+        const auto at = line.find(quoted);
+        if (at == std::string::npos)
+            return {};
+        const auto begin = at + quoted.size();
+        const auto end = line.find_first_of(",}", begin);
+        return line.substr(begin, end - begin);
+    };
+    while (std::getline(file, line))
+    {
+        auto name = field("model");
+        if (name.size() < 2)
+            continue;
+        PhaseTimes times {};
+        for (int p = 0; p < PHASE_COUNT; ++p)
+            times[p] = std::atof(field(std::string(PhaseNames[p]) + "Ms").c_str());
+        baseline[name.substr(1, name.size() - 2)] = times;
+    }
+    return baseline;
+}
+
+// Returns the number of regressions
+int compare(const std::vector<Result> & results,
+            const std::map<std::string, PhaseTimes> & baseline,
+            double threshold,
+            double minimumMs)
+{
+    int regressions = 0;
+    std::cout << "\nChange against the baseline, per phase (+ is slower):\n";
+    std::cout << std::left << std::setw(28) << "model" << std::right;
+    for (const auto name : PhaseNames)
+        std::cout << std::setw(11) << name;
+    std::cout << "\n";
+    for (const auto & result : results)
+    {
+        const auto found = baseline.find(result.name);
+        std::cout << std::left << std::setw(28) << result.name << std::right;
+        if (found == baseline.end())
+        {
+            std::cout << "  not in the baseline\n";
+            continue;
+        }
+        std::vector<std::string> flagged;
+        for (int p = 0; p < PHASE_COUNT; ++p)
+        {
+            const auto before = found->second[p];
+            const auto now = result.times[p];
+            std::ostringstream cell;
+            if (before > 0)
+                cell << std::showpos << std::fixed << std::setprecision(1) << 100.0 * (now - before) / before << "%";
+            else
+                cell << "-";
+            std::cout << std::setw(11) << cell.str();
+            if (now - before > minimumMs && now > before * (1 + threshold / 100.0))
+                flagged.push_back(PhaseNames[p]);
+        }
+        for (const auto & phase : flagged)
+            std::cout << "  REGRESSION " << phase;
+        std::cout << "\n";
+        regressions += static_cast<int>(flagged.size());
+    }
+    return regressions;
+}
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    std::vector<int> scaled = { 10, 20, 40 };
+    std::vector<std::string> paths;
+    std::string jsonPath, baselinePath, profilePath;
+    double threshold = 10;
+    double minimumMs = 0.5;
+    for (int k = 1; k < argc; ++k)
+    {
+        const auto arg = std::string(argv[k]);
+        const auto hasValue = k + 1 < argc;
+        if (arg == "--repeats" && hasValue)
+            options.repeats = std::max(1, std::atoi(argv[++k]));
+        else if (arg == "--method" && hasValue)
+            options.dual = std::string(argv[++k]) == "dual";
+        else if (arg == "--no-presolve")
+            options.presolve = false;
+        else if (arg == "--scaled" && hasValue)
+        {
+            scaled.clear();
+            std::istringstream sizes(argv[++k]);
+            std::string size;
+            while (std::getline(sizes, size, ','))
+            {
+                if (std::atoi(size.c_str()) > 1)
+                    scaled.push_back(std::atoi(size.c_str()));
+            }
+        }
+        else if (arg == "--json" && hasValue)
+            jsonPath = argv[++k];
+        else if (arg == "--compare" && hasValue)
+            baselinePath = argv[++k];
+        else if (arg == "--threshold" && hasValue)
+            threshold = std::atof(argv[++k]);
+        else if (arg == "--min-ms" && hasValue)
+            minimumMs = std::atof(argv[++k]);
+        else if (arg == "--profile" && hasValue)
+            profilePath = argv[++k];
+        else if (arg.rfind("--", 0) == 0)
+        {
+            std::cerr << "Unknown or incomplete option " << arg << std::endl;
+            return 2;
+        }
+        else
+            paths.push_back(arg);
+    }
+    if (paths.empty())
+        paths.push_back(CLP_BENCH_DATA);
+
+    std::vector<Model> models;
+    for (const auto & path : paths)
+        addModels(path, models);
+    for (const auto k : scaled)
+        models.push_back({ "transportation-" + std::to_string(k), transportationModel(k), false });
+
+    std::ofstream json;
+    if (!jsonPath.empty())
+        json.open(jsonPath);
+#ifndef COIN_PROFILE
+    if (!profilePath.empty())
+        std::cerr << "Built without CLP_PROFILE, " << profilePath << " will be empty" << std::endl;
+#endif
+    CoinProfile::reset();
+
+    std::cout << "Engine: " << CLP_FLOAT_ENGINE << ", " << (options.dual ? "dual" : "primal")
+              << (options.presolve ? " with presolve" : "") << ", median of " << options.repeats
+              << " runs, times in ms\n";
+    writeHeader(std::cout);
+    std::vector<Result> results;
+    for (const auto & model : models)
+    {
+        results.push_back(bench(model, options));
+        writeRow(std::cout, results.back());
+        if (json.is_open())
+            writeJson(json, results.back());
+    }
+    if (!profilePath.empty())
+    {
+        std::ofstream folded(profilePath);
+        CoinProfile::writeFolded(folded);
+        std::ofstream summary(profilePath + ".txt");
+        summary << "path calls totalMs selfMs\n";
+        CoinProfile::writeSummary(summary);
+#ifdef CLP_FLOAT_COUNTED
+        std::ofstream counts(profilePath + ".ops.txt");
+        counts << "path";
+        for (int op = 0; op < FloatCount::OP_COUNT; ++op)
+            counts << " " << FloatCount::name(op);
+        counts << "\n";
+        CoinProfile::writeCounts(counts);
+#endif
+    }
+
+    if (baselinePath.empty())
+        return 0;
+    const auto baseline = readBaseline(baselinePath);
+    if (baseline.empty())
+    {
+        std::cerr << "No results in " << baselinePath << std::endl;
+        return 2;
+    }
+    const auto regressions = compare(results, baseline, threshold, minimumMs);
+    std::cout << regressions << " phase regression(s) above " << threshold << "% and " << minimumMs << " ms" << std::endl;
+    return regressions ? 1 : 0;
+}
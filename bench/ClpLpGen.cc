@@ -0,0 +1,473 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// clp-lpgen [--rows m] [--columns n] [--density d] [--degeneracy f] [--equalities f]
+//           [--spread decades] [--scale decades] [--integers f] [--seed s] [--format lp|mps]
+//           [--family k1,k2,...] [--output file|directory]
+//
+// Writes synthetic LP or MPS models for scaling benchmarks. Every model is built around a planted
+// point: the rows are placed around its activities, so the model is feasible whatever the options,
+// and every column has a finite upper bound, so it is bounded too. The options shape the model:
+//
+//   --density     fraction of nonzeros in the matrix (every row and column gets at least one)
+//   --degeneracy  fraction of the inequality rows tight at the planted point, which then sits on
+//                 that many constraints at once
+//   --equalities  fraction of equality rows
+//   --spread      every row and every column gets a power of ten within +-spread/2, so the
+//                 coefficients span about 10^+-spread, as in badly scaled models
+//   --scale       right hand sides and bounds are multiplied by 10^scale; 27 gives models with
+//                 tinlake-style values around 1e27
+//   --integers    fraction of integer columns, whose planted values stay integral
+//
+// All numbers are written as exact decimals built from integer mantissas, so the planted point
+// stays exactly feasible however large the values, and a given seed produces the same model on
+// every platform. With --family the model is written once per factor k, with k times the rows and
+// columns, to gen-<rows>x<columns>.<format> files in the --output directory, ready for clp-bench.
+// MPS readers cannot take every such value back (see fitsMps), so the large scales need --format lp.
+
+namespace
+{
+// splitmix64: the standard library engines are portable but their distributions are not
+class Random
+{
+public:
+    explicit Random(uint64_t seed) : _state(seed) {}
+
+    uint64_t next()
+    {
+        uint64_t z = (_state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    /// Uniform in [0, range)
+    int64_t below(int64_t range)
+    {
+        return static_cast<int64_t>(next() % static_cast<uint64_t>(range));
+    }
+
+    /// Uniform in [low, high]
+    int64_t between(int64_t low, int64_t high)
+    {
+        return low + below(high - low + 1);
+    }
+
+    /// True with the given probability
+    bool chance(double probability)
+    {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53 < probability;
+    }
+
+private:
+    uint64_t _state;
+};
+
+struct Options
+{
+    int rows = 100;
+    int columns = 200;
+    double density = 0.05;
+    double degeneracy = 0.2;
+    double equalities = 0.1;
+    int spread = 0;
+    int scale = 0;
+    double integers = 0;
+    uint64_t seed = 1;
+    bool mps = false;
+};
+
+/// mantissa * 10^exponent, written without exponent notation
+struct Decimal
+{
+    int64_t mantissa = 0;
+    int exponent = 0;
+};
+
+std::string toString(const Decimal & value)
+{
+    auto digits = std::to_string(value.mantissa < 0 ? -value.mantissa : value.mantissa);
+    if (value.mantissa == 0)
+        return "0";
+    if (value.exponent >= 0)
+    {
+        digits.append(value.exponent, '0');
+    }
+    else
+    {
+        const auto point = static_cast<int>(digits.size()) + value.exponent;
+        if (point <= 0)
+            digits = "0." + std::string(-point, '0') + digits;
+        else
+            digits.insert(point, ".");
+        // drop the trailing zeros of the fraction
+        digits.erase(digits.find_last_not_of('0') + 1);
+        if (digits.back() == '.')
+            digits.pop_back();
+    }
+    return value.mantissa < 0 ? "-" + digits : digits;
+}
+
+// Digits of value left of the decimal point and right of it
+std::pair<int, int> digitCounts(const Decimal & value)
+{
+    if (value.mantissa == 0)
+        return { 1, 0 };
+    const auto digits = static_cast<int>(std::to_string(value.mantissa < 0 ? -value.mantissa : value.mantissa).size());
+    return { std::max(1, digits + value.exponent), std::max(0, -value.exponent) };
+}
+
+enum class Sense
+{
+    LESS,
+    GREATER,
+    EQUAL
+};
+
+struct Model
+{
+    int rows = 0;
+    int columns = 0;
+    /// Column-wise entries: row index and coefficient
+    std::vector<std::vector<std::pair<int, Decimal>>> entries;
+    std::vector<Decimal> cost;
+    std::vector<Decimal> upper;
+    std::vector<bool> integer;
+    std::vector<Sense> sense;
+    std::vector<Decimal> rhs;
+};
+
+// Coefficient (i, j) is m * 10^(rowExponent[i] + columnExponent[j]) and the planted value of
+// column j is k_j * 10^(scale - columnExponent[j]), so the activity of row i is
+// 10^(rowExponent[i] + scale) * sum(m * k_j): an exact integer sum under a common power of ten.
+Model generate(const Options & options)
+{
+    Random random(options.seed);
+    Model model;
+    model.rows = options.rows;
+    model.columns = options.columns;
+
+    const auto half = options.spread / 2;
+    std::vector<int> rowExponent(options.rows), columnExponent(options.columns);
+    for (auto & e : rowExponent)
+        e = static_cast<int>(random.between(-half, options.spread - half));
+    model.integer.resize(options.columns);
+    for (int j = 0; j < options.columns; ++j)
+    {
+        model.integer[j] = random.chance(options.integers);
+        // integer columns are not scaled, so their planted values stay integral
+        columnExponent[j] = model.integer[j] ? 0 : static_cast<int>(random.between(-half, options.spread - half));
+    }
+
+    // the sparsity pattern, with at least one entry per column and per row
+    model.entries.resize(options.columns);
+    std::vector<bool> rowUsed(options.rows);
+    std::vector<int> pattern;
+    for (int j = 0; j < options.columns; ++j)
+    {
+        pattern.clear();
+        for (int i = 0; i < options.rows; ++i)
+        {
+            if (random.chance(options.density))
+                pattern.push_back(i);
+        }
+        if (pattern.empty())
+            pattern.push_back(static_cast<int>(random.below(options.rows)));
+        for (const auto i : pattern)
+        {
+            rowUsed[i] = true;
+            model.entries[j].push_back({ i, {} });
+        }
+    }
+    for (int i = 0; i < options.rows; ++i)
+    {
+        if (rowUsed[i])
+            continue;
+        auto & column = model.entries[random.below(options.columns)];
+        column.insert(std::lower_bound(column.begin(),
+                                       column.end(),
+                                       i,
+                                       [](const std::pair<int, Decimal> & entry, int row) { return entry.first < row; }),
+                      { i, {} });
+    }
+
+    // the planted point, between 0 and the upper bound of its column
+    std::vector<int64_t> planted(options.columns);
+    model.upper.resize(options.columns);
+    model.cost.resize(options.columns);
+    for (int j = 0; j < options.columns; ++j)
+    {
+        const auto bound = random.between(1, 1000);
+        planted[j] = random.between(0, bound);
+        model.upper[j] = { bound, options.scale - columnExponent[j] };
+        // costs balance the column scaling, the signs mix so the optimum is not at a trivial corner
+        model.cost[j] = { random.between(-99, 99), columnExponent[j] };
+    }
+
+    std::vector<int64_t> activity(options.rows);
+    for (int j = 0; j < options.columns; ++j)
+    {
+        for (auto & [i, coefficient] : model.entries[j])
+        {
+            auto mantissa = random.between(1, 99);
+            if (random.chance(0.3))
+                mantissa = -mantissa;
+            coefficient = { mantissa, rowExponent[i] + columnExponent[j] };
+            activity[i] += mantissa * planted[j];
+        }
+    }
+
+    model.sense.resize(options.rows);
+    model.rhs.resize(options.rows);
+    for (int i = 0; i < options.rows; ++i)
+    {
+        const auto exponent = rowExponent[i] + options.scale;
+        if (random.chance(options.equalities))
+        {
+            model.sense[i] = Sense::EQUAL;
+            model.rhs[i] = { activity[i], exponent };
+            continue;
+        }
+        const auto slack = random.chance(options.degeneracy) ? 0 : random.between(1, 1000);
+        model.sense[i] = random.chance(0.5) ? Sense::LESS : Sense::GREATER;
+        model.rhs[i] = { model.sense[i] == Sense::LESS ? activity[i] + slack : activity[i] - slack, exponent };
+    }
+    return model;
+}
+
+std::string columnName(int j)
+{
+    return "x" + std::to_string(j);
+}
+
+std::string rowName(int i)
+{
+    return "r" + std::to_string(i);
+}
+
+void writeLp(std::ostream & out, const Model & model)
+{
+    const auto term = [&](const Decimal & value, const std::string & name) {
+        out << (value.mantissa < 0 ? " - " : " + ") << toString({ std::abs(value.mantissa), value.exponent }) << " "
+            << name;
+    };
+    out << "Minimize\n obj:";
+    for (int j = 0; j < model.columns; ++j)
+    {
+        if (model.cost[j].mantissa)
+            term(model.cost[j], columnName(j));
+        if (j % 8 == 7)
+            out << "\n";
+    }
+
+    // the matrix is stored by column, the LP format wants it by row
+    std::vector<std::vector<std::pair<int, Decimal>>> rows(model.rows);
+    for (int j = 0; j < model.columns; ++j)
+    {
+        for (const auto & [i, coefficient] : model.entries[j])
+            rows[i].push_back({ j, coefficient });
+    }
+    out << "\nSubject To\n";
+    for (int i = 0; i < model.rows; ++i)
+    {
+        out << " " << rowName(i) << ":";
+        int count = 0;
+        for (const auto & [j, coefficient] : rows[i])
+        {
+            term(coefficient, columnName(j));
+            if (++count % 8 == 0)
+                out << "\n";
+        }
+        const auto sense = model.sense[i] == Sense::LESS ? " <= " : model.sense[i] == Sense::GREATER ? " >= " : " = ";
+        out << sense << toString(model.rhs[i]) << "\n";
+    }
+    out << "Bounds\n";
+    for (int j = 0; j < model.columns; ++j)
+        out << " 0 <= " << columnName(j) << " <= " << toString(model.upper[j]) << "\n";
+    if (std::find(model.integer.begin(), model.integer.end(), true) != model.integer.end())
+    {
+        out << "Generals\n";
+        for (int j = 0; j < model.columns; ++j)
+        {
+            if (model.integer[j])
+                out << " " << columnName(j) << "\n";
+        }
+    }
+    out << "End\n";
+}
+
+// Free MPS: the fixed column layout has no room for the long decimals of scaled models
+void writeMps(std::ostream & out, const Model & model, const std::string & name)
+{
+    out << "NAME " << name << "\nROWS\n N obj\n";
+    for (int i = 0; i < model.rows; ++i)
+    {
+        const auto type = model.sense[i] == Sense::LESS ? "L" : model.sense[i] == Sense::GREATER ? "G" : "E";
+        out << " " << type << " " << rowName(i) << "\n";
+    }
+    out << "COLUMNS\n";
+    bool inIntegers = false;
+    int markers = 0;
+    for (int j = 0; j < model.columns; ++j)
+    {
+        if (model.integer[j] != inIntegers)
+        {
+            inIntegers = model.integer[j];
+            out << " M" << markers++ << " 'MARKER' " << (inIntegers ? "'INTORG'" : "'INTEND'") << "\n";
+        }
+        const auto name = columnName(j);
+        if (model.cost[j].mantissa)
+            out << " " << name << " obj " << toString(model.cost[j]) << "\n";
+        for (const auto & [i, coefficient] : model.entries[j])
+            out << " " << name << " " << rowName(i) << " " << toString(coefficient) << "\n";
+    }
+    if (inIntegers)
+        out << " M" << markers << " 'MARKER' 'INTEND'\n";
+    out << "RHS\n";
+    for (int i = 0; i < model.rows; ++i)
+    {
+        if (model.rhs[i].mantissa)
+            out << " RHS " << rowName(i) << " " << toString(model.rhs[i]) << "\n";
+    }
+    out << "BOUNDS\n";
+    for (int j = 0; j < model.columns; ++j)
+        out << " UP BND " << columnName(j) << " " << toString(model.upper[j]) << "\n";
+    out << "ENDATA\n";
+}
+
+// CoinMpsIO reads up to 30 integer and 23 fractional digits and takes an upper bound past 1e25
+// as infinite, the LP reader has no such limits
+bool fitsMps(const Model & model)
+{
+    const auto fits = [](const Decimal & value, int integerDigits) {
+        const auto [integer, fraction] = digitCounts(value);
+        return integer <= integerDigits && fraction <= 23;
+    };
+    for (int j = 0; j < model.columns; ++j)
+    {
+        if (!fits(model.cost[j], 30) || !fits(model.upper[j], 25))
+            return false;
+        for (const auto & entry : model.entries[j])
+        {
+            if (!fits(entry.second, 30))
+                return false;
+        }
+    }
+    return std::all_of(model.rhs.begin(), model.rhs.end(), [&](const Decimal & value) { return fits(value, 30); });
+}
+
+bool write(const Options & options, const std::string & path)
+{
+    const auto model = generate(options);
+    if (options.mps && !fitsMps(model))
+    {
+        std::cerr << "Values too large or too small for MPS at --spread " << options.spread << " --scale "
+                  << options.scale << ", use --format lp" << std::endl;
+        return false;
+    }
+    std::ofstream file;
+    if (!path.empty())
+    {
+        const auto directory = std::filesystem::path(path).parent_path();
+        if (!directory.empty())
+            std::filesystem::create_directories(directory);
+        file.open(path);
+        if (!file)
+        {
+            std::cerr << "Cannot write " << path << std::endl;
+            return false;
+        }
+    }
+    auto & out = path.empty() ? std::cout : file;
+    if (options.mps)
+        writeMps(out, model, "gen-" + std::to_string(model.rows) + "x" + std::to_string(model.columns));
+    else
+        writeLp(out, model);
+    return static_cast<bool>(out);
+}
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    Options options;
+    std::vector<int> family;
+    std::string output;
+    for (int k = 1; k < argc; ++k)
+    {
+        const auto arg = std::string(argv[k]);
+        if (k + 1 >= argc)
+        {
+            std::cerr << "Unknown or incomplete option " << arg << std::endl;
+            return 2;
+        }
+        const std::string value = argv[++k];
+        if (arg == "--rows")
+            options.rows = std::max(1, std::atoi(value.c_str()));
+        else if (arg == "--columns")
+            options.columns = std::max(1, std::atoi(value.c_str()));
+        else if (arg == "--density")
+            options.density = std::atof(value.c_str());
+        else if (arg == "--degeneracy")
+            options.degeneracy = std::atof(value.c_str());
+        else if (arg == "--equalities")
+            options.equalities = std::atof(value.c_str());
+        else if (arg == "--spread")
+            options.spread = std::max(0, std::atoi(value.c_str()));
+        else if (arg == "--scale")
+            options.scale = std::atoi(value.c_str());
+        else if (arg == "--integers")
+            options.integers = std::atof(value.c_str());
+        else if (arg == "--seed")
+            options.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--format" && (value == "lp" || value == "mps"))
+            options.mps = value == "mps";
+        else if (arg == "--family")
+        {
+            std::istringstream factors(value);
+            std::string factor;
+            while (std::getline(factors, factor, ','))
+            {
+                if (std::atoi(factor.c_str()) > 0)
+                    family.push_back(std::atoi(factor.c_str()));
+            }
+        }
+        else if (arg == "--output")
+            output = value;
+        else
+        {
+            std::cerr << "Unknown or incomplete option " << arg << " " << value << std::endl;
+            return 2;
+        }
+    }
+
+    if (family.empty())
+        return write(options, output) ? 0 : 1;
+
+    if (output.empty())
+    {
+        std::cerr << "--family needs an --output directory" << std::endl;
+        return 2;
+    }
+    std::filesystem::create_directories(output);
+    for (const auto factor : family)
+    {
+        auto scaled = options;
+        scaled.rows = options.rows * factor;
+        scaled.columns = options.columns * factor;
+        const auto name = "gen-" + std::to_string(scaled.rows) + "x" + std::to_string(scaled.columns) +
+                          (options.mps ? ".mps" : ".lp");
+        const auto path = (std::filesystem::path(output) / name).string();
+        if (!write(scaled, path))
+            return 1;
+        std::cerr << path << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+// Throughput of ClpPool over the LP files in tests/data for 1, 2, 4, ... workers.
+// Run after building: node bench/pool-bench.js [--repeats N] [--max-workers N] [--module clp-wasm-double.all.js]
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+const ClpPool = require("../clp-wasm.pool.js");
+
+const args = process.argv.slice(2);
+const option = (name, fallback) => {
+  const i = args.indexOf(name);
+  return i >= 0 ? args[i + 1] : fallback;
+};
+const repeats = Number(option("--repeats", 20));
+const moduleFile = option("--module", "clp-wasm.all.js");
+const maxWorkers = Number(option("--max-workers", os.cpus().length));
+
+const dataDir = path.join(__dirname, "..", "tests", "data");
+const problems = fs.readdirSync(dataDir)
+  .filter((f) => f.endsWith(".lp"))
+  .map((f) => fs.readFileSync(path.join(dataDir, f), "utf8"));
+
+async function run(workers) {
+  const pool = new ClpPool({ workers, module: moduleFile, maxQueued: problems.length * repeats });
+  await pool.ready;
+  const start = process.hrtime.bigint();
+  const jobs = [];
+  for (let r = 0; r < repeats; ++r) {
+    for (const problem of problems) {
+      jobs.push(pool.solve(problem, { raw: true }));
+    }
+  }
+  await Promise.all(jobs);
+  const ms = Number(process.hrtime.bigint() - start) / 1e6;
+  pool.terminate();
+  return { ms, solves: jobs.length };
+}
+
+(async () => {
+  console.log(`Module: ${moduleFile}, ${problems.length} problems x ${repeats} repeats`);
+  let baseline = 0;
+  for (let workers = 1; workers <= maxWorkers; workers *= 2) {
+    const { ms, solves } = await run(workers);
+    const throughput = (1000 * solves) / ms;
+    baseline = baseline || throughput;
+    console.log(`workers ${String(workers).padStart(3)}  ${ms.toFixed(1).padStart(9)} ms  ` +
+      `${throughput.toFixed(1).padStart(8)} solves/s  speedup ${(throughput / baseline).toFixed(2)}x`);
+  }
+})();
@@ -13,7 +13,7 @@ fi
 BUILD_DIR=build_${BUILD_PLATFORM}_${BUILD_CONFIG}
 
 # Clean-up
-rm -f $BUILD_DIR/clp-wasm.js*
+rm -f $BUILD_DIR/clp-wasm*.js*
 
 if [ $BUILD_PLATFORM == "wasm" ]; then
     echo 'Running wasm build ... '
@@ -32,9 +32,10 @@ fi
 cd $BUILD_DIR && ninja && cd ..
 
 if [ $BUILD_PLATFORM == "wasm" ]; then
-    cp $BUILD_DIR/clp-wasm.wasm* .
-    cp $BUILD_DIR/clp-wasm.js* .
-    cp $BUILD_DIR/clp-wasm.wasm* example/
-    cp $BUILD_DIR/clp-wasm.js* example/
+    cp $BUILD_DIR/clp-wasm*.wasm* .
+    cp $BUILD_DIR/clp-wasm*.js* .
+    cp $BUILD_DIR/clp-wasm*.wasm* example/
+    cp $BUILD_DIR/clp-wasm*.js* example/
+    cp clp-wasm.pool.js clp-wasm.worker.js example/
 fi
 
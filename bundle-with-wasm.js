@@ -1,5 +1,9 @@
 const fs = require('fs');
-const contents = fs.readFileSync('clp-wasm.wasm', { encoding: 'base64' });
-let clpjs = fs.readFileSync('clp-wasm.js', 'utf8')
-const newClp = clpjs.replace('var wasmBlobStr=null;', 'var wasmBlobStr="' + contents + '";');
-fs.writeFileSync('clp-wasm.all.js', newClp, 'utf8');
\ No newline at end of file
+for (const name of ['clp-wasm', 'clp-wasm-double', 'clp-wasm-bin113']) {
+    if (!fs.existsSync(`${name}.wasm`))
+        continue;
+    const contents = fs.readFileSync(`${name}.wasm`, { encoding: 'base64' });
+    let clpjs = fs.readFileSync(`${name}.js`, 'utf8')
+    const newClp = clpjs.replace('var wasmBlobStr=null;', 'var wasmBlobStr="' + contents + '";');
+    fs.writeFileSync(`${name}.all.js`, newClp, 'utf8');
+}
@@ -31,6 +31,19 @@ interface LP {
     generals?: string[]
 }
 
+type NumericArray = NumericType[] | Float64Array | string;
+
+interface CSCModel {
+    objective: NumericArray,
+    columnLower: NumericArray,
+    columnUpper: NumericArray,
+    rowLower: NumericArray,
+    rowUpper: NumericArray,
+    starts: number[] | Int32Array,
+    rows: number[] | Int32Array,
+    values: NumericArray
+}
+
 interface CLP {
 
     /* direction */
@@ -61,10 +74,21 @@ interface CLP {
 
     version(): string;
 
+    engine(): string; /* scalar engine: "dec100" (default bundle), "bin113" or "double" */
+
     createLp(lp: LP): string;
 
     solve(lp: string, precision: number): Result
 
+    /* solves LP strings and/or CSC models one after the other on one reused solver,
+       results are null for problems that could not be loaded */
+    solveBatch(problems: (string | CSCModel)[], precision?: number): { results: (Result | null)[], timings: Float64Array }
+
+    solveBasis(lp: string): string; /* optimal basis, one status digit per column then per row */
+
+    /* solves with fastClp (e.g. the double engine) and refines the basis found with this engine */
+    solveMixed(lp: string, precision?: number, fastClp?: CLP): Result
+
     bnRound(bn: string): string; /* rounds a big number from a string */
     bnCeil(bn: string): string; /* ceil of a big number from a string */
     bnFloor(bn: string): string; /* floor of a big number from a string */
@@ -72,6 +96,7 @@ interface CLP {
 
 export {
     LP,
+    CSCModel,
     Result,
     CLP
 }
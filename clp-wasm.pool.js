@@ -0,0 +1,286 @@
+// Pool of clp-wasm workers, each one holding its own WASM instance, so independent problems
+// are solved on all cores. Jobs wait in a priority queue (higher priority first, FIFO among
+// equals) that is bounded for back-pressure, and can be cancelled through an AbortSignal.
+//
+//   const pool = new ClpPool({ workers: 4 });
+//   await pool.ready;
+//   const result = await pool.solve(lpText, { precision: 9, priority: 1, signal });
+(function () {
+  var isNode = typeof window === "undefined" && typeof self === "undefined";
+
+  function defaultWorkers() {
+    if (isNode) {
+      return require("os").cpus().length;
+    }
+    return (typeof navigator !== "undefined" && navigator.hardwareConcurrency) || 4;
+  }
+
+  function cancelledError() {
+    var error = new Error("Job cancelled");
+    error.name = "AbortError";
+    return error;
+  }
+
+  // Binary max-heap of jobs ordered by priority, then by submission order
+  function JobQueue() {
+    this.heap = [];
+  }
+
+  JobQueue.prototype.before = function (a, b) {
+    return a.priority > b.priority || (a.priority === b.priority && a.id < b.id);
+  };
+
+  JobQueue.prototype.push = function (job) {
+    var heap = this.heap;
+    var i = heap.push(job) - 1;
+    while (i > 0) {
+      var parent = (i - 1) >> 1;
+      if (!this.before(heap[i], heap[parent])) break;
+      var t = heap[i]; heap[i] = heap[parent]; heap[parent] = t;
+      i = parent;
+    }
+  };
+
+  JobQueue.prototype.pop = function () {
+    var heap = this.heap;
+    var top = heap[0];
+    var last = heap.pop();
+    if (heap.length > 0) {
+      heap[0] = last;
+      var i = 0;
+      for (;;) {
+        var left = 2 * i + 1, right = left + 1, best = i;
+        if (left < heap.length && this.before(heap[left], heap[best])) best = left;
+        if (right < heap.length && this.before(heap[right], heap[best])) best = right;
+        if (best === i) break;
+        var t = heap[i]; heap[i] = heap[best]; heap[best] = t;
+        i = best;
+      }
+    }
+    return top;
+  };
+
+  JobQueue.prototype.remove = function (job) {
+    var index = this.heap.indexOf(job);
+    if (index < 0) return false;
+    var rest = this.heap.splice(0);
+    rest.splice(index, 1);
+    for (var k = 0; k < rest.length; ++k) this.push(rest[k]);
+    return true;
+  };
+
+  Object.defineProperty(JobQueue.prototype, "length", {
+    get: function () { return this.heap.length; }
+  });
+
+  // options.workers: number of workers (default: number of cores)
+  // options.module: clp-wasm flavour each worker loads (default "clp-wasm.all.js")
+  // options.workerScript: path or URL of clp-wasm.worker.js
+  // options.maxQueued: jobs allowed to wait before solve() rejects (default 1024)
+  function ClpPool(options) {
+    options = options || {};
+    this.size = options.workers || defaultWorkers();
+    this.maxQueued = options.maxQueued || 1024;
+    this.module = options.module || "clp-wasm.all.js";
+    this.workerScript = options.workerScript || "clp-wasm.worker.js";
+    if (isNode) {
+      var path = require("path");
+      this.module = path.resolve(__dirname, this.module);
+      this.workerScript = path.resolve(__dirname, this.workerScript);
+    }
+    this.queue = new JobQueue();
+    this.nextId = 0;
+    this.workers = [];
+    this.capacityWaiters = [];
+    var started = [];
+    for (var i = 0; i < this.size; ++i) {
+      started.push(this.startWorker(i));
+    }
+    this.ready = Promise.all(started).then(function () { });
+  }
+
+  ClpPool.prototype.startWorker = function (index) {
+    var pool = this;
+    var worker;
+    if (isNode) {
+      var Worker = require("worker_threads").Worker;
+      worker = new Worker(this.workerScript);
+    } else {
+      worker = new Worker(this.workerScript);
+    }
+    var slot = { worker: worker, job: null, ready: false, cancellable: false, cancelFlag: null };
+    if (typeof SharedArrayBuffer !== "undefined") {
+      slot.cancelFlag = new Int32Array(new SharedArrayBuffer(4));
+    }
+    this.workers[index] = slot;
+    var onMessage = function (message) {
+      pool.onWorkerMessage(slot, message);
+    };
+    if (isNode) {
+      worker.on("message", onMessage);
+    } else {
+      worker.onmessage = function (event) { onMessage(event.data); };
+    }
+    return new Promise(function (resolve, reject) {
+      slot.onReady = resolve;
+      slot.onFailed = reject;
+      worker.postMessage({ type: "init", module: pool.module, cancelFlag: slot.cancelFlag && slot.cancelFlag.buffer });
+    });
+  };
+
+  ClpPool.prototype.onWorkerMessage = function (slot, message) {
+    if (message.type === "ready") {
+      slot.ready = true;
+      slot.cancellable = !!message.cancellable && !!slot.cancelFlag;
+      slot.onReady();
+      this.dispatch();
+      return;
+    }
+    if (message.type === "error" && message.id === -1) {
+      slot.onFailed(new Error(message.error));
+      return;
+    }
+    var job = slot.job;
+    if (!job || job.id !== message.id) {
+      return;
+    }
+    slot.job = null;
+    if (job.signal) {
+      job.signal.removeEventListener("abort", job.onAbort);
+    }
+    if (job.cancelled) {
+      // already rejected, the worker only reports that it stopped
+    } else if (message.type === "result") {
+      if (job.raw) {
+        job.resolve(message.result);
+      } else {
+        var text = new TextDecoder().decode(message.result);
+        var result = text ? JSON.parse(text) : null;
+        if (result) {
+          result.ms = message.ms;
+          if (message.stopReason) {
+            result.stopReason = message.stopReason;
+          }
+        }
+        job.resolve(result);
+      }
+    } else {
+      job.reject(new Error(message.error));
+    }
+    this.dispatch();
+  };
+
+  ClpPool.prototype.dispatch = function () {
+    for (var i = 0; i < this.workers.length && this.queue.length > 0; ++i) {
+      var slot = this.workers[i];
+      if (!slot.ready || slot.job) continue;
+      var job = this.queue.pop();
+      slot.job = job;
+      var transfer = typeof job.problem === "string" ? [] : [job.problem.buffer];
+      if (slot.cancellable) {
+        // a cancellation that came after the previous solve finished must not stop this one
+        Atomics.store(slot.cancelFlag, 0, 0);
+      }
+      slot.worker.postMessage(
+        { type: "solve", id: job.id, problem: job.problem, precision: job.precision, timeLimit: job.timeLimit },
+        transfer
+      );
+      job.problem = null;
+    }
+    while (this.capacityWaiters.length > 0 && this.queue.length < this.maxQueued) {
+      this.capacityWaiters.shift()();
+    }
+  };
+
+  // Solves an LP given as text or as UTF-8 bytes (a Uint8Array, whose buffer is transferred
+  // to the worker). options: precision (default 9), priority (default 0), signal (AbortSignal),
+  // timeLimit (seconds of solving after which the solution reached so far is returned, with
+  // stopReason "time" in the result) and raw (resolve with the result JSON as UTF-8 bytes
+  // instead of an object)
+  ClpPool.prototype.solve = function (problem, options) {
+    options = options || {};
+    var pool = this;
+    if (this.queue.length >= this.maxQueued) {
+      return Promise.reject(new Error("ClpPool queue is full, wait for capacity()"));
+    }
+    if (options.signal && options.signal.aborted) {
+      return Promise.reject(cancelledError());
+    }
+    return new Promise(function (resolve, reject) {
+      var job = {
+        id: pool.nextId++,
+        problem: problem,
+        precision: typeof options.precision === "undefined" ? 9 : options.precision,
+        priority: options.priority || 0,
+        timeLimit: options.timeLimit || 0,
+        raw: !!options.raw,
+        signal: options.signal,
+        resolve: resolve,
+        reject: reject,
+      };
+      if (job.signal) {
+        job.onAbort = function () { pool.cancel(job); };
+        job.signal.addEventListener("abort", job.onAbort);
+      }
+      pool.queue.push(job);
+      pool.dispatch();
+    });
+  };
+
+  ClpPool.prototype.cancel = function (job) {
+    if (this.queue.remove(job)) {
+      job.reject(cancelledError());
+      this.dispatch();
+      return;
+    }
+    for (var i = 0; i < this.workers.length; ++i) {
+      var slot = this.workers[i];
+      if (slot.job !== job) continue;
+      if (slot.cancellable) {
+        // the solve stops at its next iteration and the worker takes the next job once it
+        // reports back
+        job.cancelled = true;
+        Atomics.store(slot.cancelFlag, 0, 1);
+        job.reject(cancelledError());
+        return;
+      }
+      // without SharedArrayBuffer a running solve cannot be interrupted, replace its worker
+      slot.job = null;
+      slot.worker.terminate();
+      job.reject(cancelledError());
+      this.startWorker(i).catch(function () { });
+      return;
+    }
+  };
+
+  // Resolves once the queue has room for another job
+  ClpPool.prototype.capacity = function () {
+    var pool = this;
+    if (this.queue.length < this.maxQueued) {
+      return Promise.resolve();
+    }
+    return new Promise(function (resolve) {
+      pool.capacityWaiters.push(resolve);
+    });
+  };
+
+  Object.defineProperty(ClpPool.prototype, "queued", {
+    get: function () { return this.queue.length; }
+  });
+
+  ClpPool.prototype.terminate = function () {
+    var pending = this.queue.heap.splice(0);
+    for (var i = 0; i < this.workers.length; ++i) {
+      var slot = this.workers[i];
+      if (slot.job) pending.push(slot.job);
+      slot.worker.terminate();
+    }
+    for (var k = 0; k < pending.length; ++k) {
+      pending[k].reject(cancelledError());
+    }
+    this.workers = [];
+  };
+
+  if (typeof module !== "undefined") module.exports = ClpPool;
+  else self.ClpPool = ClpPool;
+})();
@@ -0,0 +1,75 @@
+// Worker side of ClpPool (see clp-wasm.pool.js). Each worker loads its own copy of the
+// clp-wasm module given in the "init" message and solves one job at a time on a reused
+// ClpWrapper. Runs as a browser Web Worker or as a Node worker_threads worker.
+(function () {
+  var isNode = typeof self === "undefined";
+  var port = isNode ? require("worker_threads").parentPort : self;
+  var encoder = new TextEncoder();
+  var decoder = new TextDecoder();
+  var wrapper = null;
+
+  function post(message, transfer) {
+    port.postMessage(message, transfer || []);
+  }
+
+  function now() {
+    return typeof performance !== "undefined" ? performance.now() : Date.now();
+  }
+
+  function loadModule(moduleUrl) {
+    if (isNode) {
+      return require(moduleUrl);
+    }
+    importScripts(moduleUrl);
+    return self.clpPromise;
+  }
+
+  function init(message) {
+    loadModule(message.module).then(function (clp) {
+      wrapper = new clp.ClpWrapper();
+      // the pool cancels a running solve by setting the first element of this shared flag
+      var cancellable = !!(message.cancelFlag && wrapper.setCancelFlag);
+      if (cancellable) {
+        wrapper.setCancelFlag(new Int32Array(message.cancelFlag));
+      }
+      post({ type: "ready", engine: clp.engine ? clp.engine() : "dec100", cancellable: cancellable });
+    }, function (e) {
+      post({ type: "error", id: -1, error: String(e) });
+    });
+  }
+
+  function solve(message) {
+    var start = now();
+    var problem = typeof message.problem === "string" ? message.problem : decoder.decode(message.problem);
+    var solution;
+    try {
+      if (wrapper.setTimeLimit) {
+        wrapper.setTimeLimit(message.timeLimit || 0);
+      }
+      solution = wrapper.solve(problem, message.precision);
+    } catch (e) {
+      post({ type: "error", id: message.id, error: String(e) });
+      return;
+    }
+    // the JSON text goes back as bytes so its buffer can be transferred instead of copied
+    var bytes = encoder.encode(solution);
+    var stopReason = solution && wrapper.stopReason ? wrapper.stopReason() : "";
+    post({ type: "result", id: message.id, result: bytes, ms: now() - start, stopReason: stopReason }, [bytes.buffer]);
+  }
+
+  function onMessage(message) {
+    if (message.type === "init") {
+      init(message);
+    } else if (message.type === "solve") {
+      solve(message);
+    }
+  }
+
+  if (isNode) {
+    port.on("message", onMessage);
+  } else {
+    port.onmessage = function (event) {
+      onMessage(event.data);
+    };
+  }
+})();
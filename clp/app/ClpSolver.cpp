@@ -132,11 +132,11 @@ int mainTest(int argc, const char *argv[], int algorithm,
 static void statistics(ClpSimplex *originalModel, ClpSimplex *model);
 static void generateCode(const char *fileName, int type);
 // Returns next valid field
-int CbcOrClpRead_mode = 1;
-FILE *CbcOrClpReadCommand = stdin;
+thread_local int CbcOrClpRead_mode = 1;
+thread_local FILE *CbcOrClpReadCommand = stdin;
 // Alternative to environment
-extern char *alternativeEnvironment;
-extern int CbcOrClpEnvironmentIndex;
+extern thread_local char *alternativeEnvironment;
+extern thread_local int CbcOrClpEnvironmentIndex;
 #ifdef CLP_USER_DRIVEN1
 /* Returns true if variable sequenceOut can leave basis when
    model->sequenceIn() enters.
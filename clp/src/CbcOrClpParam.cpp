@@ -47,9 +47,10 @@ static char coin_prompt[] = "Clp:";
 #ifdef CLP_HAS_ABC
 #include "AbcCommon.hpp"
 #endif
-static bool doPrinting = true;
-static std::string afterEquals = "";
-static char printArray[250];
+// per thread, like the command reading state below, so models can be set up concurrently
+static thread_local bool doPrinting = true;
+static thread_local std::string afterEquals = "";
+static thread_local char printArray[250];
 #if COIN_INT_MAX == 0
 #undef COIN_INT_MAX
 #define COIN_INT_MAX 2147483647
@@ -1197,12 +1198,12 @@ void CbcOrClpParam::setStringValue(std::string value)
 {
   stringValue_ = value;
 }
-static char line[1000];
-static char *where = NULL;
-extern int CbcOrClpRead_mode;
-int CbcOrClpEnvironmentIndex = -1;
+static thread_local char line[1000];
+static thread_local char *where = NULL;
+extern thread_local int CbcOrClpRead_mode;
+thread_local int CbcOrClpEnvironmentIndex = -1;
 // Alternative to environment
-char *alternativeEnvironment = NULL;
+thread_local char *alternativeEnvironment = NULL;
 static size_t fillEnv()
 {
 #if defined(_MSC_VER) || defined(__MSVCRT__)
@@ -1251,7 +1252,7 @@ static size_t fillEnv()
   return length;
 #endif
 }
-extern FILE *CbcOrClpReadCommand;
+extern thread_local FILE *CbcOrClpReadCommand;
 // Simple read stuff
 std::string
 CoinReadNextField()
@@ -521,7 +521,7 @@ void ClpCholeskyDense::factorizePart3(int *rowsDropped)
 }
 /*#define POS_DEBUG*/
 #ifdef POS_DEBUG
-static int counter = 0;
+static thread_local int counter = 0;
 int ClpCholeskyDense::bNumber(const longDouble *array, int &iRow, int &iCol)
 {
   int numberBlocks = (numberRows_ + BLOCK - 1) >> BLOCKSHIFT;
@@ -212,7 +212,7 @@ int ClpDualRowSteepest::pivotRow()
   assert(model_);
   int i, iRow;
   FloatT *infeas = infeasible_->denseVector();
-  FloatT largest = 0.0;
+  FloatT largest = FloatConst::Zero;
   int *index = infeasible_->getIndices();
   int number = infeasible_->getNumElements();
   const int *pivotVariable = model_->pivotVariable();
@@ -222,7 +222,7 @@ int ClpDualRowSteepest::pivotRow()
   FloatT tolerance = model_->currentPrimalTolerance();
   // we can't really trust infeasibilities if there is primal error
   // this coding has to mimic coding in checkPrimalSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestPrimalError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestPrimalError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   // But cap
@@ -299,7 +299,7 @@ int ClpDualRowSteepest::pivotRow()
         numberWanted = CoinMax(2000, static_cast< int >(ratio));
     }
   }
-  if (model_->largestPrimalError() > 1.0e-3)
+  if (model_->largestPrimalError() > FloatConst::OneEm3)
     numberWanted = number + 1; // be safe
   int iPass;
   // Setup two passes
@@ -325,7 +325,7 @@ int ClpDualRowSteepest::pivotRow()
             value *= 2.0;
         }
 #endif
-        FloatT weight = CoinMin(weights_[iRow], 1.0e50);
+        FloatT weight = CoinMin(weights_[iRow], FloatConst::OneE50);
         //largestWeight = CoinMax(largestWeight,weight);
         //smallestWeight = CoinMin(smallestWeight,weight);
         //FloatT dubious = dubiousWeights_[iRow];
@@ -343,7 +343,7 @@ int ClpDualRowSteepest::pivotRow()
           if (!model_->flagged(iSequence)) {
             //#define CLP_DEBUG 3
 #ifdef CLP_DEBUG
-            FloatT value2 = 0.0;
+            FloatT value2 = FloatConst::Zero;
             if (solution[iSequence] > upper[iSequence] + tolerance)
               value2 = solution[iSequence] - upper[iSequence];
             else if (solution[iSequence] < lower[iSequence] - tolerance)
@@ -384,7 +384,7 @@ int ClpDualRowSteepest::pivotRow()
       if (CoinAbs(infeas[iRow]) > 1.0e-50) {
         index[nLeft++] = iRow;
       } else {
-        infeas[iRow] = 0.0;
+        infeas[iRow] = FloatConst::Zero;
       }
     }
     infeasible_->setNumElements(nLeft);
@@ -393,11 +393,11 @@ int ClpDualRowSteepest::pivotRow()
   return chosenRow;
 }
 #if 0
-static FloatT ft_count = 0.0;
-static FloatT up_count = 0.0;
-static FloatT ft_count_in = 0.0;
-static FloatT up_count_in = 0.0;
-static int xx_count = 0;
+static thread_local FloatT ft_count = 0.0;
+static thread_local FloatT up_count = 0.0;
+static thread_local FloatT ft_count_in = 0.0;
+static thread_local FloatT up_count_in = 0.0;
+static thread_local int xx_count = 0;
 #endif
 /* Updates weights and returns pivot alpha.
    Also does FT update */
@@ -419,7 +419,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     alternateWeights_->clear();
     int i;
     for (i = 0; i < numberRows; i++) {
-      FloatT value = 0.0;
+      FloatT value = FloatConst::Zero;
       array[i] = 1.0;
       which[0] = i;
       alternateWeights_->setNumElements(1);
@@ -430,7 +430,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
       for (j = 0; j < number; j++) {
         int iRow = which[j];
         value += array[iRow] * array[iRow];
-        array[iRow] = 0.0;
+        array[iRow] = FloatConst::Zero;
       }
       alternateWeights_->setNumElements(0);
       FloatT w = CoinMax(weights_[i], value) * .1;
@@ -452,11 +452,11 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
 #endif
     return 0.0;
   }
-  FloatT alpha = 0.0;
+  FloatT alpha = FloatConst::Zero;
   if (!model_->factorization()->networkBasis()) {
     // clear other region
     alternateWeights_->clear();
-    FloatT norm = 0.0;
+    FloatT norm = FloatConst::Zero;
     int i;
     FloatT *work = input->denseVector();
     int numberNonZero = input->getNumElements();
@@ -523,7 +523,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     // alternateWeights_ should still be empty
     int pivotRow = model_->pivotRow();
 #ifdef CLP_DEBUG
-    if (model_->logLevel() > 4 && CoinAbs(norm - weights_[pivotRow]) > 1.0e-3 * (1.0 + norm))
+    if (model_->logLevel() > 4 && CoinAbs(norm - weights_[pivotRow]) > FloatConst::OneEm3 * (1.0 + norm))
       printf("on row %d, true weight %g, old %g\n",
         pivotRow, sqrt(norm), sqrt(weights_[pivotRow]));
 #endif
@@ -532,7 +532,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     assert(model_->alpha());
     assert(norm);
     // pivot element
-    alpha = 0.0;
+    alpha = FloatConst::Zero;
     FloatT multiplier = 2.0 / model_->alpha();
     // look at updated column
     work = updatedColumn->denseVector();
@@ -575,7 +575,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     model_->factorization()->updateColumnFT(spare, updatedColumn);
     // clear other region
     alternateWeights_->clear();
-    FloatT norm = 0.0;
+    FloatT norm = FloatConst::Zero;
     int i;
     FloatT *work = input->denseVector();
     int number = input->getNumElements();
@@ -601,7 +601,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
 #endif
     int pivotRow = model_->pivotRow();
 #ifdef CLP_DEBUG
-    if (model_->logLevel() > 4 && CoinAbs(norm - weights_[pivotRow]) > 1.0e-3 * (1.0 + norm))
+    if (model_->logLevel() > 4 && CoinAbs(norm - weights_[pivotRow]) > FloatConst::OneEm3 * (1.0 + norm))
       printf("on row %d, true weight %g, old %g\n",
         pivotRow, sqrt(norm), sqrt(weights_[pivotRow]));
 #endif
@@ -612,7 +612,7 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     //if (norm < DEVEX_TRY_NORM)
     //norm = DEVEX_TRY_NORM;
     // pivot element
-    alpha = 0.0;
+    alpha = FloatConst::Zero;
     FloatT multiplier = 2.0 / model_->alpha();
     // look at updated column
     work = updatedColumn->denseVector();
@@ -666,7 +666,7 @@ void ClpDualRowSteepest::updatePrimalSolution(
   int number = primalUpdate->getNumElements();
   int *COIN_RESTRICT which = primalUpdate->getIndices();
   int i;
-  FloatT changeObj = 0.0;
+  FloatT changeObj = FloatConst::Zero;
   FloatT tolerance = model_->currentPrimalTolerance();
   const int *COIN_RESTRICT pivotVariable = model_->pivotVariable();
   FloatT *COIN_RESTRICT infeas = infeasible_->denseVector();
@@ -684,7 +684,7 @@ void ClpDualRowSteepest::updatePrimalSolution(
       FloatT value = solution[iPivot];
       FloatT cost = costModel[iPivot];
       FloatT change = primalRatio * work[i];
-      work[i] = 0.0;
+      work[i] = FloatConst::Zero;
       value -= change;
       changeObj -= change * cost;
       FloatT lower = lowerModel[iPivot];
@@ -777,7 +777,7 @@ void ClpDualRowSteepest::updatePrimalSolution(
         if (infeas[iRow])
           infeas[iRow] = COIN_INDEXED_REALLY_TINY_ELEMENT;
       }
-      work[iRow] = 0.0;
+      work[iRow] = FloatConst::Zero;
     }
   }
   // Do pivot row
@@ -869,7 +869,7 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
           lastRow = model->spareIntArray_[1];
         }
         for (i = firstRow; i < lastRow; i++) {
-          FloatT value = 0.0;
+          FloatT value = FloatConst::Zero;
           array[0] = 1.0;
           which[0] = i;
           alternateWeights_->setNumElements(1);
@@ -880,7 +880,7 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
           int j;
           for (j = 0; j < number; j++) {
             value += array[j] * array[j];
-            array[j] = 0.0;
+            array[j] = FloatConst::Zero;
           }
           alternateWeights_->setNumElements(0);
           weights_[i] = value;
@@ -1064,13 +1064,13 @@ void ClpDualRowSteepest::unrollWeights()
     for (i = 0; i < number; i++) {
       int iRow = which[i];
       weights_[iRow] = saved[i];
-      saved[i] = 0.0;
+      saved[i] = FloatConst::Zero;
     }
   } else {
     for (i = 0; i < number; i++) {
       int iRow = which[i];
       weights_[iRow] = saved[iRow];
-      saved[iRow] = 0.0;
+      saved[iRow] = FloatConst::Zero;
     }
   }
   alternateWeights_->setNumElements(0);
@@ -1111,7 +1111,7 @@ bool ClpDualRowSteepest::looksOptimal() const
   FloatT tolerance = model_->currentPrimalTolerance();
   // we can't really trust infeasibilities if there is primal error
   // this coding has to mimic coding in checkPrimalSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestPrimalError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestPrimalError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   // But cap
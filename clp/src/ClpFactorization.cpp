@@ -16,6 +16,7 @@
 #include "CoinIndexedVector.hpp"
 #include "ClpSimplex.hpp"
 #include "ClpSimplexDual.hpp"
+#include "ClpSolveStats.hpp"
 #include "ClpMatrixBase.hpp"
 #ifndef SLIM_CLP
 #include "ClpNetworkBasis.hpp"
@@ -1650,6 +1651,7 @@ bool ClpFactorization::timeToRefactorize() const
 int ClpFactorization::factorize(ClpSimplex *model,
   int solveType, bool valuesPass)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::factorize);
 #ifdef CLP_REUSE_ETAS
   model_ = model;
 #endif
@@ -2562,6 +2564,10 @@ scaledDense,scaledDense_2,scaledL,scaledR,scaledU\n");
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   factorization_instrument(2);
 #endif
+  if (ClpSolveStats::Totals *totals = ClpSolveStats::current()) {
+    totals->lElements = coinFactorizationA_->numberElementsL();
+    totals->uElements = coinFactorizationA_->numberElementsU();
+  }
   return coinFactorizationA_->status();
 }
 /* Replaces one Column in basis,
@@ -2713,6 +2719,7 @@ int ClpFactorization::replaceColumn(const ClpSimplex *model,
 int ClpFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::ftran);
 #ifdef CLP_DEBUG
   regionSparse->checkClear();
 #endif
@@ -2794,6 +2801,7 @@ int ClpFactorization::updateColumn(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2,
   bool noPermute) const
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::ftran);
 #ifdef CLP_DEBUG
   if (!noPermute)
     regionSparse->checkClear();
@@ -2881,6 +2889,7 @@ int ClpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
   CoinIndexedVector *regionSparse3,
   bool noPermuteRegion3)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::ftran);
 #ifdef CLP_DEBUG
   regionSparse1->checkClear();
 #endif
@@ -2983,6 +2992,7 @@ int ClpFactorization::updateColumnForDebug(CoinIndexedVector *regionSparse,
 int ClpFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
   CoinIndexedVector *regionSparse2) const
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::btran);
   if (!numberRows())
     return 0;
 #ifndef SLIM_CLP
@@ -3060,6 +3070,7 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
   CoinIndexedVector *regionSparse2,
   CoinIndexedVector *regionSparse3) const
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::btran);
   if (!numberRows())
     return;
 #ifndef SLIM_CLP
@@ -15,15 +15,12 @@
 #include <cmath>
 #include "CoinHelperFunctions.hpp"
 #include "CoinTypes.hpp"
+#include "CoinSimd128.hpp"
 
 FloatT
 maximumAbsElement(const FloatT *region, int size)
 {
-  int i;
-  FloatT maxValue = 0.0;
-  for (i = 0; i < size; i++)
-    maxValue = CoinMax(maxValue, CoinAbs(region[i]));
-  return maxValue;
+  return CoinSimdMaxAbs(region, size);
 }
 void setElements(FloatT *region, int size, FloatT value)
 {
@@ -35,6 +32,14 @@ void multiplyAdd(const FloatT *region1, int size, FloatT multiplier1,
   FloatT *region2, FloatT multiplier2)
 {
   int i;
+#if COIN_SIMD128
+  // products by +-1 are exact so one kernel covers every case where neither
+  // multiplier is 0 (0 * inf must not leak into region2)
+  if (multiplier1 != 0.0 && multiplier2 != 0.0) {
+    CoinSimdMultiplyAdd(region1, size, multiplier1, region2, multiplier2);
+    return;
+  }
+#endif
   if (multiplier1 == 1.0) {
     if (multiplier2 == 1.0) {
       for (i = 0; i < size; i++)
@@ -95,11 +100,7 @@ void multiplyAdd(const FloatT *region1, int size, FloatT multiplier1,
 FloatT
 innerProduct(const FloatT *region1, int size, const FloatT *region2)
 {
-  int i;
-  FloatT value = 0.0;
-  for (i = 0; i < size; i++)
-    value += region1[i] * region2[i];
-  return value;
+  return CoinSimdDot(region1, region2, size);
 }
 void getNorms(const FloatT *region, int size, FloatT &norm1, FloatT &norm2)
 {
@@ -134,6 +134,7 @@ ClpModel::ClpModel(bool emptyMessages)
   dblParam_[ClpObjOffset] = 0.0;
   dblParam_[ClpMaxSeconds] = -1.0;
   dblParam_[ClpMaxWallSeconds] = -1.0;
+  setTimeLimitsNs();
   dblParam_[ClpPresolveTolerance] = 1.0e-8;
 
 #ifndef CLP_NO_STD
@@ -750,6 +751,7 @@ void ClpModel::gutsOfCopy(const ClpModel &rhs, int trueCopy)
   dblParam_[ClpObjOffset] = rhs.dblParam_[ClpObjOffset];
   dblParam_[ClpMaxSeconds] = rhs.dblParam_[ClpMaxSeconds];
   dblParam_[ClpMaxWallSeconds] = rhs.dblParam_[ClpMaxWallSeconds];
+  setTimeLimitsNs();
   dblParam_[ClpPresolveTolerance] = rhs.dblParam_[ClpPresolveTolerance];
 #ifndef CLP_NO_STD
 
@@ -1103,6 +1105,8 @@ bool ClpModel::setDblParam(ClpDblParam key, FloatT value)
     return false;
   }
   dblParam_[key] = value;
+  if (key == ClpMaxSeconds || key == ClpMaxWallSeconds)
+    setTimeLimitsNs();
   return true;
 }
 
@@ -2774,6 +2778,7 @@ void ClpModel::setMaximumSeconds(FloatT value)
     dblParam_[ClpMaxSeconds] = value + CoinCpuTime();
   else
     dblParam_[ClpMaxSeconds] = -1.0;
+  setTimeLimitsNs();
 }
 void ClpModel::setMaximumWallSeconds(FloatT value)
 {
@@ -2781,17 +2786,26 @@ void ClpModel::setMaximumWallSeconds(FloatT value)
     dblParam_[ClpMaxWallSeconds] = value + CoinWallclockTime();
   else
     dblParam_[ClpMaxWallSeconds] = -1.0;
+  setTimeLimitsNs();
+}
+// Copies the deadlines to the integer clocks
+void ClpModel::setTimeLimitsNs()
+{
+  maximumCpuNs_ = dblParam_[ClpMaxSeconds] >= 0.0 ? CoinSecondsToNs(dblParam_[ClpMaxSeconds]) : -1;
+  // CoinWallclockTime() counts from its first call, which any deadline set went through
+  maximumWallNs_ = dblParam_[ClpMaxWallSeconds] >= 0.0 ? CoinSecondsToNs(dblParam_[ClpMaxWallSeconds] + CoinWallclockTime(-1)) : -1;
 }
 // Returns true if hit maximum iterations (or time)
 bool ClpModel::hitMaximumIterations() const
 {
   // replaced - compiler error? bool hitMax= (numberIterations_>=maximumIterations());
   bool hitMax = (numberIterations_ >= intParam_[ClpMaxNumIteration]);
-  if (dblParam_[ClpMaxSeconds] >= 0.0 && !hitMax) {
-    hitMax = (CoinCpuTime() >= dblParam_[ClpMaxSeconds]);
+  // integer clocks: this runs on every iteration, and FloatT values from getrusage are not free
+  if (maximumCpuNs_ >= 0 && !hitMax) {
+    hitMax = (CoinCpuTimeNs() >= maximumCpuNs_);
   }
-  if (dblParam_[ClpMaxWallSeconds] >= 0.0 && !hitMax) {
-    hitMax = (CoinWallclockTime() >= dblParam_[ClpMaxWallSeconds]);
+  if (maximumWallNs_ >= 0 && !hitMax) {
+    hitMax = (CoinGetTimeOfDayNs() >= maximumWallNs_);
   }
   return hitMax;
 }
@@ -2800,7 +2814,7 @@ void ClpModel::onStopped()
 {
   if (problemStatus_ == 3) {
     secondaryStatus_ = 0;
-    if ((CoinCpuTime() >= dblParam_[ClpMaxSeconds] && dblParam_[ClpMaxSeconds] >= 0.0) || (CoinWallclockTime() >= dblParam_[ClpMaxWallSeconds] && dblParam_[ClpMaxWallSeconds] >= 0.0))
+    if ((maximumCpuNs_ >= 0 && CoinCpuTimeNs() >= maximumCpuNs_) || (maximumWallNs_ >= 0 && CoinGetTimeOfDayNs() >= maximumWallNs_))
       secondaryStatus_ = 9;
   }
 }
@@ -3275,6 +3289,7 @@ ClpModel::ClpModel(const ClpModel *rhs,
   dblParam_[ClpObjOffset] = rhs->dblParam_[ClpObjOffset];
   dblParam_[ClpMaxSeconds] = rhs->dblParam_[ClpMaxSeconds];
   dblParam_[ClpMaxWallSeconds] = rhs->dblParam_[ClpMaxWallSeconds];
+  setTimeLimitsNs();
   dblParam_[ClpPresolveTolerance] = rhs->dblParam_[ClpPresolveTolerance];
 #ifndef CLP_NO_STD
   strParam_[ClpProbName] = rhs->strParam_[ClpProbName];
@@ -1230,6 +1230,8 @@ protected:
   void deleteNamesAsChar(const char *const *names, int number) const;
   /// On stopped - sets secondary status
   void onStopped();
+  /// Copies the ClpMaxSeconds and ClpMaxWallSeconds deadlines to the integer clocks
+  void setTimeLimitsNs();
   //@}
 
   ////////////////// data //////////////////
@@ -1240,6 +1242,10 @@ protected:
   FloatT optimizationDirection_;
   /// Array of FloatT parameters
   FloatT dblParam_[ClpLastDblParam];
+  /** Deadlines of ClpMaxSeconds on CoinCpuTimeNs() and of ClpMaxWallSeconds on
+      CoinGetTimeOfDayNs(), -1 for none, so that hitMaximumIterations() compares integers */
+  int64_t maximumCpuNs_;
+  int64_t maximumWallNs_;
   /// Objective value
   FloatT objectiveValue_;
   /// Small element value
@@ -6,8 +6,10 @@
 #include <cstdio>
 
 #include "CoinPragma.hpp"
+#include "CoinProfile.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinSimd128.hpp"
 //#define THREAD
 //#define FAKE_CILK
 #if ABOCA_LITE
@@ -384,9 +386,9 @@ void ClpPackedMatrix::transposeTimes(FloatT scalar,
           n += chunk;
         }
         for (int i = 0; i < numberThreads; i++) {
-          cilk_spawn transposeTimesBit(info[i]);
+          clp_spawn(transposeTimesBit, info[i]);
         }
-        cilk_sync;
+        clp_sync;
       } else {
 #endif
         CoinBigIndex start = columnStart[0];
@@ -653,9 +655,9 @@ void ClpPackedMatrix::transposeTimesSubset(int number,
           n += chunk;
         }
         for (int i = 0; i < numberThreads; i++) {
-          cilk_spawn transposeTimesSubsetBit(info[i]);
+          clp_spawn(transposeTimesSubsetBit, info[i]);
         }
-        cilk_sync;
+        clp_sync;
       } else {
 #endif
         for (int jColumn = 0; jColumn < number; jColumn++) {
@@ -706,6 +708,7 @@ void ClpPackedMatrix::transposeTimes(const ClpSimplex *model, FloatT scalar,
   CoinIndexedVector *y,
   CoinIndexedVector *columnArray) const
 {
+  COIN_PROFILE_REGION("transposeTimes");
   columnArray->clear();
   FloatT *COIN_RESTRICT pi = rowArray->denseVector();
   int numberNonZero = 0;
@@ -1490,13 +1493,9 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const FloatT *COIN_RESTRICT pi
   const CoinBigIndex *COIN_RESTRICT columnStart = matrix_->getVectorStarts();
   const FloatT *COIN_RESTRICT elementByColumn = matrix_->getElements();
 #if 1 //ndef INTEL_MKL
-  FloatT value = 0.0;
-  CoinBigIndex j;
   CoinBigIndex end = columnStart[1];
-  for (j = columnStart[0]; j < end; j++) {
-    int iRow = row[j];
-    value += pi[iRow] * elementByColumn[j];
-  }
+  FloatT value = CoinSimdSparseDot(pi, row + columnStart[0], elementByColumn + columnStart[0],
+    static_cast< int >(end - columnStart[0]));
   int iColumn;
   for (iColumn = 0; iColumn < numberActiveColumns_ - 1; iColumn++) {
     CoinBigIndex start = end;
@@ -1505,11 +1504,8 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const FloatT *COIN_RESTRICT pi
       array[numberNonZero] = value;
       index[numberNonZero++] = iColumn;
     }
-    value = 0.0;
-    for (j = start; j < end; j++) {
-      int iRow = row[j];
-      value += pi[iRow] * elementByColumn[j];
-    }
+    value = CoinSimdSparseDot(pi, row + start, elementByColumn + start,
+      static_cast< int >(end - start));
   }
   if (CoinAbs(value) > zeroTolerance) {
     array[numberNonZero] = value;
@@ -1549,14 +1545,10 @@ int ClpPackedMatrix::gutsOfTransposeTimesScaled(const FloatT *COIN_RESTRICT pi,
   const int *COIN_RESTRICT row = matrix_->getIndices();
   const CoinBigIndex *COIN_RESTRICT columnStart = matrix_->getVectorStarts();
   const FloatT *COIN_RESTRICT elementByColumn = matrix_->getElements();
-  FloatT value = 0.0;
   FloatT scale = columnScale[0];
-  CoinBigIndex j;
   CoinBigIndex end = columnStart[1];
-  for (j = columnStart[0]; j < end; j++) {
-    int iRow = row[j];
-    value += pi[iRow] * elementByColumn[j];
-  }
+  FloatT value = CoinSimdSparseDot(pi, row + columnStart[0], elementByColumn + columnStart[0],
+    static_cast< int >(end - columnStart[0]));
   int iColumn;
   for (iColumn = 0; iColumn < numberActiveColumns_ - 1; iColumn++) {
     value *= scale;
@@ -1567,11 +1559,8 @@ int ClpPackedMatrix::gutsOfTransposeTimesScaled(const FloatT *COIN_RESTRICT pi,
       array[numberNonZero] = value;
       index[numberNonZero++] = iColumn;
     }
-    value = 0.0;
-    for (j = start; j < end; j++) {
-      int iRow = row[j];
-      value += pi[iRow] * elementByColumn[j];
-    }
+    value = CoinSimdSparseDot(pi, row + start, elementByColumn + start,
+      static_cast< int >(end - start));
   }
   value *= scale;
   if (CoinAbs(value) > zeroTolerance) {
@@ -1666,9 +1655,9 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const FloatT *COIN_RESTRICT pi
       n += chunk;
     }
     for (int i = 0; i < numberThreads; i++) {
-      cilk_spawn transposeTimesUnscaledBit(info[i]);
+      clp_spawn(transposeTimesUnscaledBit, info[i]);
     }
-    cilk_sync;
+    clp_sync;
     for (int i = 0; i < numberThreads; i++)
       numberNonZero += info[i].numberAdded;
     moveAndZero(info, 2, NULL);
@@ -1687,23 +1676,8 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const FloatT *COIN_RESTRICT pi
         CoinBigIndex start = columnStart[iColumn];
         CoinBigIndex end = columnStart[iColumn + 1];
         jColumn = iColumn;
-        int n = static_cast< int >(end - start);
-        bool odd = (n & 1) != 0;
-        n = n >> 1;
-        const int *COIN_RESTRICT rowThis = row + start;
-        const FloatT *COIN_RESTRICT elementThis = elementByColumn + start;
-        for (; n; n--) {
-          int iRow0 = *rowThis;
-          int iRow1 = *(rowThis + 1);
-          rowThis += 2;
-          value += pi[iRow0] * (*elementThis);
-          value += pi[iRow1] * (*(elementThis + 1));
-          elementThis += 2;
-        }
-        if (odd) {
-          int iRow = *rowThis;
-          value += pi[iRow] * (*elementThis);
-        }
+        value = CoinSimdSparseDot(pi, row + start, elementByColumn + start,
+          static_cast< int >(end - start));
       }
     }
     if (CoinAbs(value) > zeroTolerance) {
@@ -1838,9 +1812,9 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const FloatT *COIN_RESTRICT pi
       n += chunk;
     }
     for (int i = 0; i < numberThreads; i++) {
-      cilk_spawn transposeTimesUnscaledBit2(info[i]);
+      clp_spawn(transposeTimesUnscaledBit2, info[i]);
     }
-    cilk_sync;
+    clp_sync;
     for (int i = 0; i < numberThreads; i++) {
       numberNonZero += info[i].numberAdded;
       numberRemaining += info[i].numberRemaining;
@@ -1861,22 +1835,7 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const FloatT *COIN_RESTRICT pi
         CoinBigIndex end = columnStart[iColumn + 1];
         int n = static_cast< int >(end - start);
 #if 1
-        bool odd = (n & 1) != 0;
-        n = n >> 1;
-        const int *COIN_RESTRICT rowThis = row + start;
-        const FloatT *COIN_RESTRICT elementThis = elementByColumn + start;
-        for (; n; n--) {
-          int iRow0 = *rowThis;
-          int iRow1 = *(rowThis + 1);
-          rowThis += 2;
-          value += pi[iRow0] * (*elementThis);
-          value += pi[iRow1] * (*(elementThis + 1));
-          elementThis += 2;
-        }
-        if (odd) {
-          int iRow = *rowThis;
-          value += pi[iRow] * (*elementThis);
-        }
+        value = CoinSimdSparseDot(pi, row + start, elementByColumn + start, n);
 #else
       const int *COIN_RESTRICT rowThis = &row[end - 16];
       const FloatT *COIN_RESTRICT elementThis = &elementByColumn[end - 16];
@@ -2008,10 +1967,8 @@ int ClpPackedMatrix::gutsOfTransposeTimesScaled(const FloatT *COIN_RESTRICT pi,
       CoinBigIndex start = columnStart[iColumn];
       CoinBigIndex end = columnStart[iColumn + 1];
       jColumn = iColumn;
-      for (CoinBigIndex j = start; j < end; j++) {
-        int iRow = row[j];
-        value += pi[iRow] * elementByColumn[j];
-      }
+      value = CoinSimdSparseDot(pi, row + start, elementByColumn + start,
+        static_cast< int >(end - start));
       value *= scale;
     }
   }
@@ -2065,18 +2022,7 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
     CoinBigIndex start = rowStart[iRow];
     CoinBigIndex end = rowStart[iRow + 1];
     int n = static_cast< int >(end - start);
-    const int *COIN_RESTRICT columnThis = column + start;
-    const FloatT *COIN_RESTRICT elementThis = element + start;
-
-    // could do by twos
-    for (; n; n--) {
-      int iColumn = *columnThis;
-      columnThis++;
-      FloatT elValue = *elementThis;
-      elementThis++;
-      elValue *= value;
-      output[iColumn] += elValue;
-    }
+    CoinSimdScatterAdd(element + start, column + start, n, value, output);
   }
   // get rid of tiny values and count
   int numberNonZero = 0;
@@ -2095,9 +2041,9 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
       n += chunk;
     }
     for (int i = 0; i < numberThreads; i++) {
-      cilk_spawn packDownBit(info[i]);
+      clp_spawn(packDownBit, info[i]);
     }
-    cilk_sync;
+    clp_sync;
     for (int i = 0; i < numberThreads; i++) {
       numberNonZero += info[i].numberAdded;
     }
@@ -2706,9 +2652,9 @@ int ClpPackedMatrix::transposeTimes2(const ClpSimplex *model,
             n += chunk;
           }
           for (int i = 0; i < numberThreads; i++) {
-            cilk_spawn transposeTimes2UnscaledBit(info[i]);
+            clp_spawn(transposeTimes2UnscaledBit, info[i]);
           }
-          cilk_sync;
+          clp_sync;
           for (int i = 0; i < numberThreads; i++) {
             numberNonZero += info[i].numberAdded;
           }
@@ -2882,9 +2828,9 @@ int ClpPackedMatrix::transposeTimes2(const ClpSimplex *model,
             n += chunk;
           }
           for (int i = 0; i < numberThreads; i++) {
-            cilk_spawn transposeTimes2ScaledBit(info[i]);
+            clp_spawn(transposeTimes2ScaledBit, info[i]);
           }
-          cilk_sync;
+          clp_sync;
           for (int i = 0; i < numberThreads; i++) {
             numberNonZero += info[i].numberAdded;
           }
@@ -8359,12 +8305,12 @@ void ClpPackedMatrix3::transposeTimes2(const ClpSimplex *model,
   info[ODD_INFO + 1].numberToDo = numberBlocks_ + 1;
 #if ABOCA_LITE
   if (abcState() > 1) {
-    cilk_spawn transposeTimes3Bit2Odd(info[ODD_INFO]);
+    clp_spawn(transposeTimes3Bit2Odd, info[ODD_INFO]);
     for (int iBlock = 0; iBlock < numberChunks_; iBlock++) {
-      cilk_spawn transposeTimes3Bit2(info[iBlock]);
+      clp_spawn(transposeTimes3Bit2, info[iBlock]);
     }
     transposeTimes3BitSlacks(info[ODD_INFO + 1]);
-    cilk_sync;
+    clp_sync;
   } else {
 #endif
     transposeTimes3Bit2Odd(info[ODD_INFO]);
@@ -8997,9 +8943,9 @@ ClpSimplexDual::dualColumn0(const CoinIndexedVector * rowArray,
 	    info[i].tolerance=dualTolerance_;
 	  }
 	  for (int i=0;i<numberThreads;i++) {
-	    cilk_spawn dualColumn00(info[i]);
+	    clp_spawn(dualColumn00, info[i]);
 	  }
-	  cilk_sync;
+	  clp_sync;
 	  moveAndZero(info,1,NULL);
 	  for (int i=0;i<numberThreads;i++) {
 	    numberRemaining += info[i].numberRemaining;
@@ -625,7 +625,7 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
         info.r3norm = fmerit; // Must be the 2-norm here.
 
         thisLsqr.do_lsqr(rhs, damp, atol, btol, conlim, itnlim,
-          !show.is_zero(), info, dy, &istop, &itncg, &outfo, precon, Pr);
+          show != 0, info, dy, &istop, &itncg, &outfo, precon, Pr);
         if (precon)
           dy = dy * Pr;
 
@@ -10,6 +10,7 @@
 //#define SOME_DEBUG
 
 #include "CoinPragma.hpp"
+#include "CoinProfile.hpp"
 #include <math.h>
 
 #include "CoinHelperFunctions.hpp"
@@ -75,6 +76,7 @@ static CoinWorkDouble eExtra = 1.0e-12;
 
 int ClpPredictorCorrector::solve()
 {
+  COIN_PROFILE_REGION("barrier");
   problemStatus_ = -1;
   algorithm_ = 1;
   //create all regions
@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "CoinHelperFunctions.hpp"
+#include "CoinProfile.hpp"
 #include "ClpConfig.h"
 #ifdef CLP_HAS_ABC
 #include "CoinAbcCommon.hpp"
@@ -109,6 +110,7 @@ ClpPresolve::presolvedModel(ClpSimplex &si,
   const char *prohibitedRows,
   const char *prohibitedColumns)
 {
+  COIN_PROFILE_REGION("presolve");
   // Check matrix
   int checkType = ((si.specialOptions() & 128) != 0) ? 14 : 15;
   if (!si.clpMatrix()->allElementsInRange(&si, si.getSmallElementValue(),
@@ -176,6 +178,7 @@ int ClpPresolve::presolveStatus() const
 }
 void ClpPresolve::postsolve(bool updateStatus)
 {
+  COIN_PROFILE_REGION("postsolve");
   // Return at once if no presolved model
   if (!presolvedModel_)
     return;
@@ -231,7 +231,7 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -266,7 +266,7 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
     // would have to have two goes for devex, three for steepest
     anyUpdates = 2;
   } else if (updates->getNumElements()) {
-    if (updates->getIndices()[0] == pivotRow && CoinAbs(updates->denseVector()[0]) > 1.0e-6) {
+    if (updates->getIndices()[0] == pivotRow && CoinAbs(updates->denseVector()[0]) > FloatConst::OneEm6) {
       // reasonable size
       anyUpdates = 1;
       //if (CoinAbs(model_->dualIn())<1.0e-4||CoinAbs(CoinAbs(model_->dualIn())-CoinAbs(updates->denseVector()[0]))>1.0e-5)
@@ -557,14 +557,14 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
         if (CoinAbs(infeas[i]) > COIN_INDEXED_TINY_ELEMENT)
           index[number++] = i;
         else
-          infeas[i] = 0.0;
+          infeas[i] = FloatConst::Zero;
       }
     }
     infeasible_->setNumElements(number);
   }
   if (model_->numberIterations() < model_->lastBadIteration() + 200 && model_->factorization()->pivots() > 10) {
     // we can't really trust infeasibilities if there is dual error
-    FloatT checkTolerance = 1.0e-8;
+    FloatT checkTolerance = FloatConst::OneEm8;
     if (model_->largestDualError() > checkTolerance)
       tolerance *= model_->largestDualError() / checkTolerance;
     // But cap
@@ -577,10 +577,10 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
       number);
 #endif
   // stop last one coming immediately
-  FloatT saveOutInfeasibility = 0.0;
+  FloatT saveOutInfeasibility = FloatConst::Zero;
   if (sequenceOut >= 0) {
     saveOutInfeasibility = infeas[sequenceOut];
-    infeas[sequenceOut] = 0.0;
+    infeas[sequenceOut] = FloatConst::Zero;
   }
   if (model_->factorization()->pivots() && model_->numberPrimalInfeasibilities())
     tolerance = CoinMax(tolerance, 1.0e-15 * model_->infeasibilityCost());
@@ -687,9 +687,9 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
       pivotColumnBit(info[0]);
     } else {
       for (int i = 0; i < numberThreads; i++) {
-        cilk_spawn pivotColumnBit(info[i]);
+        clp_spawn(pivotColumnBit, info[i]);
       }
-      cilk_sync;
+      clp_sync;
     }
     for (int i = 0; i < numberThreads; i++) {
       FloatT bestDjX = info[i].primalRatio;
@@ -763,7 +763,7 @@ void ClpPrimalColumnSteepest::justDjs(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -805,7 +805,7 @@ void ClpPrimalColumnSteepest::justDjs(CoinIndexedVector *updates,
       int iSequence = index[j];
       FloatT value = reducedCost[iSequence];
       value -= updateBy[j];
-      updateBy[j] = 0.0;
+      updateBy[j] = FloatConst::Zero;
       reducedCost[iSequence] = value;
       ClpSimplex::Status status = model_->getStatus(iSequence + addSequence);
 
@@ -887,7 +887,7 @@ void ClpPrimalColumnSteepest::djsAndDevex(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   // for weights update we use pivotSequence
@@ -904,7 +904,7 @@ void ClpPrimalColumnSteepest::djsAndDevex(CoinIndexedVector *updates,
   //if (mode_ != 1 && reference(sequenceIn))
   //   referenceIn = 1.0;
   // save outgoing weight round update
-  FloatT outgoingWeight = 0.0;
+  FloatT outgoingWeight = FloatConst::Zero;
   int sequenceOut = model_->sequenceOut();
   if (sequenceOut >= 0)
     outgoingWeight = weights_[sequenceOut];
@@ -933,7 +933,7 @@ void ClpPrimalColumnSteepest::djsAndDevex(CoinIndexedVector *updates,
     int iSequence = index[j];
     FloatT value = reducedCost[iSequence];
     FloatT value2 = updateBy[j];
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     value -= value2;
     reducedCost[iSequence] = value;
     ClpSimplex::Status status = model_->getStatus(iSequence + addSequence);
@@ -1034,7 +1034,7 @@ void ClpPrimalColumnSteepest::djsAndDevex(CoinIndexedVector *updates,
     FloatT value = reducedCost[iSequence];
     FloatT value2 = updateBy[j];
     value -= value2;
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     reducedCost[iSequence] = value;
     ClpSimplex::Status status = model_->getStatus(iSequence);
 
@@ -1137,7 +1137,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   // for weights update we use pivotSequence
@@ -1161,11 +1161,11 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
     FloatT *work1 = altVector[1]->denseVector();
     FloatT *worka = alternateWeights_->denseVector();
     int iRow = -1;
-    FloatT diff = 1.0e-8;
+    FloatT diff = FloatConst::OneEm8;
     for (int i = 0; i < numberRows; i++) {
       FloatT dd = CoinMax(CoinAbs(work1[i]), CoinAbs(worka[i]));
       FloatT d = CoinAbs(work1[i] - worka[i]);
-      if (dd > 1.0e-6 && d > diff * dd) {
+      if (dd > FloatConst::OneEm6 && d > diff * dd) {
         diff = d / dd;
         iRow = i;
       }
@@ -1185,12 +1185,12 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
     if (reference(sequenceIn))
       referenceIn = 1.0;
     else
-      referenceIn = 0.0;
+      referenceIn = FloatConst::Zero;
   } else {
     referenceIn = -1.0;
   }
   // save outgoing weight round update
-  FloatT outgoingWeight = 0.0;
+  FloatT outgoingWeight = FloatConst::Zero;
   int sequenceOut = model_->sequenceOut();
   if (sequenceOut >= 0)
     outgoingWeight = weights_[sequenceOut];
@@ -1227,7 +1227,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
 
     case ClpSimplex::basic:
       infeasible_->zero(iSequence + addSequence);
-      reducedCost[iSequence] = 0.0;
+      reducedCost[iSequence] = FloatConst::Zero;
     case ClpSimplex::isFixed:
       break;
     case ClpSimplex::isFree:
@@ -1372,7 +1372,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
       int iSequence = index[j];
       FloatT value = updateBy[j];
       if (value) {
-        updateBy[j] = 0.0;
+        updateBy[j] = FloatConst::Zero;
         infeasible_->quickAdd(iSequence, value);
       } else {
         infeasible_->zero(iSequence);
@@ -1385,7 +1385,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
       int iSequence = index[j];
       FloatT value = reducedCost[iSequence];
       FloatT value2 = updateBy[j];
-      updateBy[j] = 0.0;
+      updateBy[j] = FloatConst::Zero;
       value -= value2;
       reducedCost[iSequence] = value;
       ClpSimplex::Status status = model_->getStatus(iSequence);
@@ -1483,7 +1483,7 @@ void ClpPrimalColumnSteepest::djsAndDevex2(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -1525,7 +1525,7 @@ void ClpPrimalColumnSteepest::djsAndDevex2(CoinIndexedVector *updates,
       int iSequence = index[j];
       FloatT value = reducedCost[iSequence];
       value -= updateBy[j];
-      updateBy[j] = 0.0;
+      updateBy[j] = FloatConst::Zero;
       reducedCost[iSequence] = value;
       ClpSimplex::Status status = model_->getStatus(iSequence + addSequence);
 
@@ -1605,7 +1605,7 @@ void ClpPrimalColumnSteepest::djsAndDevex2(CoinIndexedVector *updates,
     //if (mode_ != 1 && reference(sequenceIn))
     //   referenceIn = 1.0;
     // save outgoing weight round update
-    FloatT outgoingWeight = 0.0;
+    FloatT outgoingWeight = FloatConst::Zero;
     int sequenceOut = model_->sequenceOut();
     if (sequenceOut >= 0)
       outgoingWeight = weights_[sequenceOut];
@@ -1633,7 +1633,7 @@ void ClpPrimalColumnSteepest::djsAndDevex2(CoinIndexedVector *updates,
       FloatT thisWeight = weight[iSequence];
       // row has -1
       FloatT pivot = -updateBy[iSequence];
-      updateBy[iSequence] = 0.0;
+      updateBy[iSequence] = FloatConst::Zero;
       FloatT value = pivot * pivot * devex_;
       if (reference(iSequence + numberColumns))
         value += 1.0;
@@ -1651,7 +1651,7 @@ void ClpPrimalColumnSteepest::djsAndDevex2(CoinIndexedVector *updates,
       FloatT thisWeight = weight[iSequence];
       // row has -1
       FloatT pivot = updateBy[iSequence];
-      updateBy[iSequence] = 0.0;
+      updateBy[iSequence] = FloatConst::Zero;
       FloatT value = pivot * pivot * devex_;
       if (reference(iSequence))
         value += 1.0;
@@ -1693,7 +1693,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest2(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -1738,7 +1738,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest2(CoinIndexedVector *updates,
       int iSequence = index[j];
       FloatT value = reducedCost[iSequence];
       value -= updateBy[j];
-      updateBy[j] = 0.0;
+      updateBy[j] = FloatConst::Zero;
       reducedCost[iSequence] = value;
       ClpSimplex::Status status = model_->getStatus(iSequence + addSequence);
 
@@ -1823,12 +1823,12 @@ void ClpPrimalColumnSteepest::djsAndSteepest2(CoinIndexedVector *updates,
       if (reference(sequenceIn))
         referenceIn = 1.0;
       else
-        referenceIn = 0.0;
+        referenceIn = FloatConst::Zero;
     } else {
       referenceIn = -1.0;
     }
     // save outgoing weight round update
-    FloatT outgoingWeight = 0.0;
+    FloatT outgoingWeight = FloatConst::Zero;
     int sequenceOut = model_->sequenceOut();
     if (sequenceOut >= 0)
       outgoingWeight = weights_[sequenceOut];
@@ -1859,11 +1859,11 @@ void ClpPrimalColumnSteepest::djsAndSteepest2(CoinIndexedVector *updates,
         FloatT *work1 = altVector[1]->denseVector();
         FloatT *worka = alternateWeights_->denseVector();
         int iRow = -1;
-        FloatT diff = 1.0e-8;
+        FloatT diff = FloatConst::OneEm8;
         for (int i = 0; i < numberRows; i++) {
           FloatT dd = CoinMax(CoinAbs(work1[i]), CoinAbs(worka[i]));
           FloatT d = CoinAbs(work1[i] - worka[i]);
-          if (dd > 1.0e-6 && d > diff * dd) {
+          if (dd > FloatConst::OneEm6 && d > diff * dd) {
             diff = d / dd;
             iRow = i;
           }
@@ -1915,7 +1915,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest2(CoinIndexedVector *updates,
         FloatT thisWeight = weight[iSequence];
         // row has -1
         FloatT pivot = -updateBy[j];
-        updateBy[j] = 0.0;
+        updateBy[j] = FloatConst::Zero;
         FloatT value = pivot * pivot * devex_;
         if (reference(iSequence + numberColumns))
           value += 1.0;
@@ -1938,7 +1938,7 @@ void ClpPrimalColumnSteepest::djsAndSteepest2(CoinIndexedVector *updates,
         FloatT thisWeight = weight[iSequence];
         // row has -1
         FloatT pivot = updateBy[j];
-        updateBy[j] = 0.0;
+        updateBy[j] = FloatConst::Zero;
         FloatT value = pivot * pivot * devex_;
         if (reference(iSequence))
           value += 1.0;
@@ -1979,7 +1979,7 @@ int ClpPrimalColumnSteepest::transposeTimes2(const CoinIndexedVector *pi1, CoinI
     if (reference(sequenceIn))
       referenceIn = 1.0;
     else
-      referenceIn = 0.0;
+      referenceIn = FloatConst::Zero;
   } else {
     referenceIn = -1.0;
   }
@@ -2002,7 +2002,7 @@ int ClpPrimalColumnSteepest::transposeTimes2(const CoinIndexedVector *pi1, CoinI
       pi1, dj2, dj1);
     // get subset which have nonzero tableau elements
     model_->clpMatrix()->subsetTransposeTimes(model_, pi2, dj1, dj2);
-    bool killDjs = (scaleFactor == 0.0);
+    bool killDjs = (scaleFactor == FloatConst::Zero);
     if (!scaleFactor)
       scaleFactor = 1.0;
     // columns
@@ -2020,9 +2020,9 @@ int ClpPrimalColumnSteepest::transposeTimes2(const CoinIndexedVector *pi1, CoinI
       int iSequence = index[j];
       FloatT value2 = updateBy[j];
       if (killDjs)
-        updateBy[j] = 0.0;
+        updateBy[j] = FloatConst::Zero;
       FloatT modification = updateBy2[j];
-      updateBy2[j] = 0.0;
+      updateBy2[j] = FloatConst::Zero;
       ClpSimplex::Status status = model_->getStatus(iSequence);
 
       if (status != ClpSimplex::basic && status != ClpSimplex::isFixed) {
@@ -2032,7 +2032,7 @@ int ClpPrimalColumnSteepest::transposeTimes2(const CoinIndexedVector *pi1, CoinI
 
         thisWeight += pivotSquared * devex_ + pivot * modification;
         if (thisWeight < TRY_NORM) {
-          if (referenceIn < 0.0) {
+          if (referenceIn < FloatConst::Zero) {
             // steepest
             thisWeight = CoinMax(TRY_NORM, ADD_ONE + pivotSquared);
           } else {
@@ -2065,7 +2065,7 @@ void ClpPrimalColumnSteepest::justDevex(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -2081,7 +2081,7 @@ void ClpPrimalColumnSteepest::justDevex(CoinIndexedVector *updates,
   //if (mode_ != 1 && reference(sequenceIn))
   //   referenceIn = 1.0;
   // save outgoing weight round update
-  FloatT outgoingWeight = 0.0;
+  FloatT outgoingWeight = FloatConst::Zero;
   int sequenceOut = model_->sequenceOut();
   if (sequenceOut >= 0)
     outgoingWeight = weights_[sequenceOut];
@@ -2111,7 +2111,7 @@ void ClpPrimalColumnSteepest::justDevex(CoinIndexedVector *updates,
     FloatT thisWeight = weight[iSequence];
     // row has -1
     FloatT pivot = -updateBy[j];
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     FloatT value = pivot * pivot * devex_;
     if (reference(iSequence + numberColumns))
       value += 1.0;
@@ -2130,7 +2130,7 @@ void ClpPrimalColumnSteepest::justDevex(CoinIndexedVector *updates,
     FloatT thisWeight = weight[iSequence];
     // row has -1
     FloatT pivot = updateBy[j];
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     FloatT value = pivot * pivot * devex_;
     if (reference(iSequence))
       value += 1.0;
@@ -2170,7 +2170,7 @@ void ClpPrimalColumnSteepest::justSteepest(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -2184,11 +2184,11 @@ void ClpPrimalColumnSteepest::justSteepest(CoinIndexedVector *updates,
   int sequenceIn = pivotVariable[pivotRow];
   infeasible_->zero(sequenceIn);
   // and we can see if reference
-  FloatT referenceIn = 0.0;
+  FloatT referenceIn = FloatConst::Zero;
   if (mode_ != 1 && reference(sequenceIn))
     referenceIn = 1.0;
   // save outgoing weight round update
-  FloatT outgoingWeight = 0.0;
+  FloatT outgoingWeight = FloatConst::Zero;
   int sequenceOut = model_->sequenceOut();
   if (sequenceOut >= 0)
     outgoingWeight = weights_[sequenceOut];
@@ -2225,11 +2225,11 @@ void ClpPrimalColumnSteepest::justSteepest(CoinIndexedVector *updates,
     FloatT *work1 = altVector[1]->denseVector();
     FloatT *worka = alternateWeights_->denseVector();
     int iRow = -1;
-    FloatT diff = 1.0e-8;
+    FloatT diff = FloatConst::OneEm8;
     for (int i = 0; i < numberRows; i++) {
       FloatT dd = CoinMax(CoinAbs(work1[i]), CoinAbs(worka[i]));
       FloatT d = CoinAbs(work1[i] - worka[i]);
-      if (dd > 1.0e-6 && d > diff * dd) {
+      if (dd > FloatConst::OneEm6 && d > diff * dd) {
         diff = d / dd;
         iRow = i;
       }
@@ -2248,7 +2248,7 @@ void ClpPrimalColumnSteepest::justSteepest(CoinIndexedVector *updates,
     FloatT thisWeight = weight[iSequence];
     // row has -1
     FloatT pivot = -updateBy[j];
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     FloatT modification = other[iSequence];
     FloatT pivotSquared = pivot * pivot;
 
@@ -2280,9 +2280,9 @@ void ClpPrimalColumnSteepest::justSteepest(CoinIndexedVector *updates,
     int iSequence = index[j];
     FloatT thisWeight = weight[iSequence];
     FloatT pivot = updateBy[j];
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     FloatT modification = updateBy2[j];
-    updateBy2[j] = 0.0;
+    updateBy2[j] = FloatConst::Zero;
     FloatT pivotSquared = pivot * pivot;
 
     thisWeight += pivotSquared * devex_ + pivot * modification;
@@ -2338,7 +2338,7 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   int pivotRow = model_->pivotRow();
@@ -2371,7 +2371,7 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
     if (CoinAbs(dj) > 1.0e-15) {
       // some dj
       updates->insert(pivotRow, -dj);
-      if (CoinAbs(dj) > 1.0e-6) {
+      if (CoinAbs(dj) > FloatConst::OneEm6) {
         // reasonable size
         anyUpdates = 1;
       } else {
@@ -2757,7 +2757,7 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
       numberWanted = CoinMax(100, number / 200);
     } else if (ratio < 0.3) {
       numberWanted = CoinMax(500, number / 40);
-    } else if (ratio < 0.5 || mode_ == 5) {
+    } else if (ratio < FloatConst::Half || mode_ == 5) {
       numberWanted = CoinMax(2000, number / 10);
       numberWanted = CoinMax(numberWanted, numberColumns / 30);
     } else if (mode_ != 5) {
@@ -2840,11 +2840,11 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
     int sequenceIn = pivotVariable[pivotRow];
     infeasible_->zero(sequenceIn);
     // and we can see if reference
-    FloatT referenceIn = 0.0;
+    FloatT referenceIn = FloatConst::Zero;
     if (switchType != 1 && reference(sequenceIn))
       referenceIn = 1.0;
     // save outgoing weight round update
-    FloatT outgoingWeight = 0.0;
+    FloatT outgoingWeight = FloatConst::Zero;
     if (sequenceOut >= 0)
       outgoingWeight = weights_[sequenceOut];
     // update weights
@@ -2882,7 +2882,7 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
         FloatT thisWeight = weight[iSequence];
         // row has -1
         FloatT pivot = updateBy[iSequence] * scaleFactor;
-        updateBy[iSequence] = 0.0;
+        updateBy[iSequence] = FloatConst::Zero;
         FloatT modification = other[iSequence];
         FloatT pivotSquared = pivot * pivot;
 
@@ -2909,7 +2909,7 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
         FloatT thisWeight = weight[iSequence];
         // row has -1
         FloatT pivot = updateBy[iSequence] * scaleFactor;
-        updateBy[iSequence] = 0.0;
+        updateBy[iSequence] = FloatConst::Zero;
         FloatT value = pivot * pivot * devex_;
         if (reference(iSequence + numberColumns))
           value += 1.0;
@@ -2936,9 +2936,9 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
         int iSequence = index[j];
         FloatT thisWeight = weight[iSequence];
         FloatT pivot = updateBy[iSequence] * scaleFactor;
-        updateBy[iSequence] = 0.0;
+        updateBy[iSequence] = FloatConst::Zero;
         FloatT modification = updateBy2[j];
-        updateBy2[j] = 0.0;
+        updateBy2[j] = FloatConst::Zero;
         FloatT pivotSquared = pivot * pivot;
 
         thisWeight += pivotSquared * devex_ + pivot * modification;
@@ -2963,7 +2963,7 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
         FloatT thisWeight = weight[iSequence];
         // row has -1
         FloatT pivot = updateBy[iSequence] * scaleFactor;
-        updateBy[iSequence] = 0.0;
+        updateBy[iSequence] = FloatConst::Zero;
         FloatT value = pivot * pivot * devex_;
         if (reference(iSequence))
           value += 1.0;
@@ -3001,9 +3001,9 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
   number = infeasible_->getNumElements();
   if (model_->numberIterations() < model_->lastBadIteration() + 200) {
     // we can't really trust infeasibilities if there is dual error
-    FloatT checkTolerance = 1.0e-8;
+    FloatT checkTolerance = FloatConst::OneEm8;
     if (!model_->factorization()->pivots())
-      checkTolerance = 1.0e-6;
+      checkTolerance = FloatConst::OneEm6;
     if (model_->largestDualError() > checkTolerance)
       tolerance *= model_->largestDualError() / checkTolerance;
     // But cap
@@ -3016,10 +3016,10 @@ int ClpPrimalColumnSteepest::pivotColumnOldMethod(CoinIndexedVector *updates,
       number);
 #endif
   // stop last one coming immediately
-  FloatT saveOutInfeasibility = 0.0;
+  FloatT saveOutInfeasibility = FloatConst::Zero;
   if (sequenceOut >= 0) {
     saveOutInfeasibility = infeas[sequenceOut];
-    infeas[sequenceOut] = 0.0;
+    infeas[sequenceOut] = FloatConst::Zero;
   }
   tolerance *= tolerance; // as we are using squares
 
@@ -3119,7 +3119,7 @@ void ClpPrimalColumnSteepest::redoInfeasibilities()
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   // reverse sign so test is cleaner
@@ -3131,11 +3131,11 @@ void ClpPrimalColumnSteepest::redoInfeasibilities()
   for (int iSequence = 0; iSequence < number; iSequence++) {
     unsigned char thisStatus = status[iSequence] & 7;
     FloatT value = reducedCost[iSequence];
-    infeas[iSequence] = 0.0;
+    infeas[iSequence] = FloatConst::Zero;
     if (thisStatus == 3) {
     } else if ((thisStatus & 1) != 0) {
       // basic or fixed
-      value = 0.0;
+      value = FloatConst::Zero;
     } else if (thisStatus == 2) {
       value = -value;
     } else {
@@ -3144,7 +3144,7 @@ void ClpPrimalColumnSteepest::redoInfeasibilities()
         // we are going to bias towards free (but only if reasonable)
         value = -CoinAbs(value) * FREE_BIAS;
       } else {
-        value = 0.0;
+        value = FloatConst::Zero;
       }
     }
     if (value < tolerance) {
@@ -3335,7 +3335,7 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
         pivotSequence_ = found;
         for (iRow = 0; iRow < numberRows; iRow++) {
           int iPivot = savePivotOrder[iRow];
-          temp[iPivot] = 0.0;
+          temp[iPivot] = FloatConst::Zero;
         }
 #else
         for (int iRow = 0; iRow < numberRows; iRow++) {
@@ -3385,12 +3385,12 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
 #ifndef CLP_PRIMAL_SLACK_MULTIPLIER
       for (iSequence = 0; iSequence < number; iSequence++) {
         FloatT value = reducedCost[iSequence];
-        infeas[iSequence] = 0.0;
+        infeas[iSequence] = FloatConst::Zero;
         unsigned char thisStatus = status[iSequence] & 7;
         if (thisStatus == 3) {
         } else if ((thisStatus & 1) != 0) {
           // basic or fixed
-          value = 0.0;
+          value = FloatConst::Zero;
         } else if (thisStatus == 2) {
           value = -value;
         } else {
@@ -3399,7 +3399,7 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
             // we are going to bias towards free (but only if reasonable)
             value = -CoinAbs(value) * FREE_BIAS;
           } else {
-            value = 0.0;
+            value = FloatConst::Zero;
           }
         }
         if (value < -tolerance) {
@@ -3411,13 +3411,13 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
       // Columns
       int numberColumns = model_->numberColumns();
       for (iSequence = 0; iSequence < numberColumns; iSequence++) {
-        infeas[iSequence] = 0.0;
+        infeas[iSequence] = FloatConst::Zero;
         FloatT value = reducedCost[iSequence];
         unsigned char thisStatus = status[iSequence] & 7;
         if (thisStatus == 3) {
         } else if ((thisStatus & 1) != 0) {
           // basic or fixed
-          value = 0.0;
+          value = FloatConst::Zero;
         } else if (thisStatus == 2) {
           value = -value;
         } else {
@@ -3434,7 +3434,7 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
               value = -CoinAbs(value) * FREE_BIAS;
             }
           } else {
-            value = 0.0;
+            value = FloatConst::Zero;
           }
         }
         if (value < -tolerance) {
@@ -3445,12 +3445,12 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
       // Rows
       for (; iSequence < number; iSequence++) {
         FloatT value = reducedCost[iSequence];
-        infeas[iSequence] = 0.0;
+        infeas[iSequence] = FloatConst::Zero;
         unsigned char thisStatus = status[iSequence] & 7;
         if (thisStatus == 3) {
         } else if ((thisStatus & 1) != 0) {
           // basic or fixed
-          value = 0.0;
+          value = FloatConst::Zero;
         } else if (thisStatus == 2) {
           value = -value;
         } else {
@@ -3459,7 +3459,7 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
             // we are going to bias towards free (but only if reasonable)
             value = -CoinAbs(value) * FREE_BIAS;
           } else {
-            value = 0.0;
+            value = FloatConst::Zero;
           }
         }
         if (value < -tolerance) {
@@ -3531,7 +3531,7 @@ void ClpPrimalColumnSteepest::unrollWeights()
   for (i = 0; i < number; i++) {
     int iRow = which[i];
     weights_[iRow] = saved[iRow];
-    saved[iRow] = 0.0;
+    saved[iRow] = FloatConst::Zero;
   }
   alternateWeights_->setNumElements(0);
 }
@@ -3592,7 +3592,7 @@ void ClpPrimalColumnSteepest::updateWeights(CoinIndexedVector *input)
     FloatT *temp2 = temp + nCol;
     FloatT *temp2P = pivRow + nCol;
     FloatT *piU = pivRow + nTotal;
-    FloatT devex = 0.0;
+    FloatT devex = FloatConst::Zero;
     FloatT scaleFactor = 1.0 / model_->dualIn();
     const int *pivotVariable = model_->pivotVariable();
     for (int i = 0; i < number; i++) {
@@ -3622,8 +3622,8 @@ void ClpPrimalColumnSteepest::updateWeights(CoinIndexedVector *input)
     for (int i = 0; i < nCol; i++) {
       CoinBigIndex start = columnStart[i];
       CoinBigIndex end = start + columnLength[i];
-      FloatT value = 0.0;
-      FloatT value2 = 0.0;
+      FloatT value = FloatConst::Zero;
+      FloatT value2 = FloatConst::Zero;
       for (CoinBigIndex j = start; j < end; j++) {
         int iRow = row[j];
         value -= piU[iRow] * element[j];
@@ -3697,7 +3697,7 @@ void ClpPrimalColumnSteepest::updateWeights(CoinIndexedVector *input)
   int pivotRow = model_->pivotRow();
   pivotSequence_ = pivotRow;
 
-  devex_ = 0.0;
+  devex_ = FloatConst::Zero;
   // Can't create alternateWeights_ as packed as needed unpacked
   if (!input->packedMode()) {
     if (pivotRow >= 0) {
@@ -3732,7 +3732,7 @@ void ClpPrimalColumnSteepest::updateWeights(CoinIndexedVector *input)
             }
           }
 #if ALT_UPDATE_WEIGHTS != 2
-          if (!newWork[pivotRow] && devex_ > 0.0)
+          if (!newWork[pivotRow] && devex_ > FloatConst::Zero)
             newWhich[newNumber++] = pivotRow; // add if not already in
           newWork[pivotRow] = -2.0 * CoinMax(devex_, 0.0);
 #endif
@@ -3812,7 +3812,7 @@ void ClpPrimalColumnSteepest::updateWeights(CoinIndexedVector *input)
             }
           }
 #if ALT_UPDATE_WEIGHTS != 2
-          if (!newWork[pivotRow] && devex_ > 0.0)
+          if (!newWork[pivotRow] && devex_ > FloatConst::Zero)
             newWhich[newNumber++] = pivotRow; // add if not already in
           newWork[pivotRow] = -2.0 * CoinMax(devex_, 0.0);
 #endif
@@ -3869,7 +3869,7 @@ void ClpPrimalColumnSteepest::updateWeights(CoinIndexedVector *input)
   weights_[sequenceIn] = devex_;
   FloatT testValue = 0.1;
   if (mode_ == 4 && numberSwitched_ == 1)
-    testValue = 0.5;
+    testValue = FloatConst::Half;
   if (CoinAbs(devex_ - oldDevex) > testValue * check) {
 #ifdef CLP_DEBUG
     if ((model_->messageHandler()->logLevel() & 48) == 16)
@@ -3919,14 +3919,14 @@ void ClpPrimalColumnSteepest::checkAccuracy(int sequence,
   FloatT *work = rowArray1->denseVector();
   const int *pivotVariable = model_->pivotVariable();
 
-  FloatT devex = 0.0;
+  FloatT devex = FloatConst::Zero;
   int i;
 
   if (mode_ == 1) {
     for (i = 0; i < number; i++) {
       int iRow = which[i];
       devex += work[iRow] * work[iRow];
-      work[iRow] = 0.0;
+      work[iRow] = FloatConst::Zero;
     }
     devex += ADD_ONE;
   } else {
@@ -3936,14 +3936,14 @@ void ClpPrimalColumnSteepest::checkAccuracy(int sequence,
       if (reference(iPivot)) {
         devex += work[iRow] * work[iRow];
       }
-      work[iRow] = 0.0;
+      work[iRow] = FloatConst::Zero;
     }
     if (reference(sequence))
       devex += 1.0;
   }
 
-  FloatT oldDevex = CoinMax(weights_[sequence], 1.0e-4);
-  devex = CoinMax(devex, 1.0e-4);
+  FloatT oldDevex = CoinMax(weights_[sequence], FloatConst::OneEm4);
+  devex = CoinMax(devex, FloatConst::OneEm4);
   FloatT check = CoinMax(devex, oldDevex);
   ;
   rowArray1->setNumElements(0);
@@ -3962,14 +3962,14 @@ void ClpPrimalColumnSteepest::checkAccuracy(int sequence,
       for (i = 0; i < number; i++)
         printf("(%d,%g) ", which[i], (double)work[which[i]]);
       printf("\n");
-      devex = 0.0;
+      devex = FloatConst::Zero;
       for (i = 0; i < number; i++) {
         int iRow = which[i];
         int iPivot = pivotVariable[iRow];
         if (reference(iPivot)) {
           devex += work[iRow] * work[iRow];
         }
-        work[iRow] = 0.0;
+        work[iRow] = FloatConst::Zero;
       }
       if (reference(sequence))
         devex += 1.0;
@@ -4020,7 +4020,7 @@ void ClpPrimalColumnSteepest::initializeWeights()
         for (j = 0; j < number; j++) {
           int iRow = which[j];
           value += array[iRow] * array[iRow];
-          array[iRow] = 0.0;
+          array[iRow] = FloatConst::Zero;
         }
         alternateWeights_->setNumElements(0);
         weights_[iSequence] = value;
@@ -4048,7 +4048,7 @@ void ClpPrimalColumnSteepest::clearArrays()
   state_ = -1;
   savedPivotSequence_ = -1;
   savedSequenceOut_ = -1;
-  devex_ = 0.0;
+  devex_ = FloatConst::Zero;
 }
 // Returns true if would not find any column
 bool ClpPrimalColumnSteepest::looksOptimal() const
@@ -4184,14 +4184,14 @@ int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
   FloatT tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
-  FloatT error = CoinMin(1.0e-2, model_->largestDualError());
+  FloatT error = CoinMin(FloatConst::OneEm2, model_->largestDualError());
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
   if (model_->numberIterations() < model_->lastBadIteration() + 200) {
     // we can't really trust infeasibilities if there is dual error
-    FloatT checkTolerance = 1.0e-8;
+    FloatT checkTolerance = FloatConst::OneEm8;
     if (!model_->factorization()->pivots())
-      checkTolerance = 1.0e-6;
+      checkTolerance = FloatConst::OneEm6;
     if (model_->largestDualError() > checkTolerance)
       tolerance *= model_->largestDualError() / checkTolerance;
     // But cap
@@ -4216,7 +4216,7 @@ int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
     int iSequence = index[j];
     FloatT value = duals[iSequence];
     value -= updateBy[j];
-    updateBy[j] = 0.0;
+    updateBy[j] = FloatConst::Zero;
     duals[iSequence] = value;
   }
   //#define CLP_DEBUG
@@ -4255,7 +4255,7 @@ int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
     for (iRow = 0; iRow < numberRows; iRow++) {
       // slack
       FloatT value = array[iRow];
-      if (CoinAbs(duals[iRow] - value) > 1.0e-3)
+      if (CoinAbs(duals[iRow] - value) > FloatConst::OneEm3)
         printf("bad row %d old dual %g new %g\n", iRow, duals[iRow], value);
       //duals[iRow]=value;
     }
@@ -4430,7 +4430,7 @@ int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
       doingR = true;
       // update start
       startC[iPassC] = end;
-      if (end >= startC[iPassC + 1] - 1.0e-8) {
+      if (end >= startC[iPassC + 1] - FloatConst::OneEm8) {
         if (iPassC)
           finishedC = true;
         else
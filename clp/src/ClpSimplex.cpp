@@ -6,6 +6,7 @@
 //#undef NDEBUG
 
 #include "ClpConfig.h"
+#include "CoinProfile.hpp"
 
 #include "CoinPragma.hpp"
 #include <math.h>
@@ -553,6 +554,7 @@ int ClpSimplex::gutsOfSolution(FloatT *givenDuals,
   const FloatT *givenPrimals,
   bool valuesPass)
 {
+  COIN_PROFILE_REGION("gutsOfSolution");
 
   // if values pass, save values of basic variables
   FloatT *save = NULL;
@@ -7031,6 +7033,7 @@ int ClpSimplex::restoreModel(const char *fileName)
     // Fill in scalars
     optimizationDirection_ = scalars.optimizationDirection;
     CoinMemcpyN(scalars.dblParam, ClpLastDblParam, dblParam_);
+    setTimeLimitsNs();
     objectiveValue_ = scalars.objectiveValue;
     dualBound_ = scalars.dualBound;
     dualTolerance_ = scalars.dualTolerance;
@@ -7646,6 +7649,8 @@ int ClpSimplex::readLp(const char *filename, const FloatT epsilon)
 int ClpSimplex::readLp(std::istream &is, const FloatT epsilon)
 {
   CoinLpIO m;
+  // report through the model's handler, so setLogLevel(0) silences the parser as well
+  m.passInMessageHandler(handler_);
   m.readLp(is, epsilon);
   return readLp(m);
 }
@@ -72,6 +72,7 @@ class AbcSimplex;
 #define cilk_spawn
 #define cilk_sync
 #endif
+#include "ClpTaskPool.hpp"
 #ifdef LONG_REGION_2
 #define SHORT_REGION 1
 #else
@@ -2101,13 +2102,9 @@ typedef struct {
 #ifndef ABC_INHERIT
 #if ABOCA_LITE
 void moveAndZero(clpTempInfo *info, int type, void *extra);
-// 2 is owner of abcState_
-#ifdef ABCSTATE_LITE
-#if ABCSTATE_LITE == 2
-int abcState_ = 0;
-#else
+// defined in ClpTaskPool.cpp, which is kept out of unity batches where the
+// ABCSTATE_LITE owner trick cannot work
 extern int abcState_;
-#endif
 inline int abcState()
 {
   return abcState_;
@@ -2116,7 +2113,6 @@ inline void setAbcState(int state)
 {
   abcState_ = state;
 }
-#endif
 #else
 #define abcState 0
 #endif
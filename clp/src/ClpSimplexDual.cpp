@@ -92,6 +92,7 @@
 #endif
 
 #include "CoinPragma.hpp"
+#include "CoinProfile.hpp"
 
 #include <math.h>
 
@@ -104,6 +105,7 @@
 //#define FAKE_CILK
 #include "ClpSimplexDual.hpp"
 #include "ClpEventHandler.hpp"
+#include "ClpSolveStats.hpp"
 #include "ClpFactorization.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinIndexedVector.hpp"
@@ -267,16 +269,16 @@ int ClpSimplexDual::startupSolve(int ifValuesPass, FloatT *saveDuals, int startF
       // make reduced costs okay
       for (i = 0; i < numberColumns_; i++) {
         if (getStatus(i) == atLowerBound) {
-          if (saveDuals[i] < 0.0) {
+          if (saveDuals[i] < FloatConst::Zero) {
             //if (saveDuals[i]<-1.0e-3)
             //printf("bad dj at lb %d %g\n",i,saveDuals[i]);
-            saveDuals[i] = 0.0;
+            saveDuals[i] = FloatConst::Zero;
           }
         } else if (getStatus(i) == atUpperBound) {
-          if (saveDuals[i] > 0.0) {
+          if (saveDuals[i] > FloatConst::Zero) {
             //if (saveDuals[i]>1.0e-3)
             //printf("bad dj at ub %d %g\n",i,saveDuals[i]);
-            saveDuals[i] = 0.0;
+            saveDuals[i] = FloatConst::Zero;
           }
         }
       }
@@ -331,9 +333,9 @@ int ClpSimplexDual::startupSolve(int ifValuesPass, FloatT *saveDuals, int startF
       if (handler_->logLevel() > 2) {
         handler_->message(CLP_SIMPLEX_STATUS, messages_)
           << numberIterations_ << objectiveValue();
-        handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+        handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
           << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-        handler_->printing(sumDualInfeasibilities_ > 0.0)
+        handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
           << sumDualInfeasibilities_ << numberDualInfeasibilities_;
         handler_->printing(numberDualInfeasibilitiesWithoutFree_
           < numberDualInfeasibilities_)
@@ -400,8 +402,8 @@ void ClpSimplexDual::gutsOfDual(int ifValuesPass, FloatT *&saveDuals, int initia
   z_thinks = -1;
   int nPivots = 9999;
 #endif
-  FloatT largestPrimalError = 0.0;
-  FloatT largestDualError = 0.0;
+  FloatT largestPrimalError = FloatConst::Zero;
+  FloatT largestDualError = FloatConst::Zero;
   FloatT smallestPrimalInfeasibility = COIN_DBL_MAX;
   int numberRayTries = 0;
   // Start can skip some things in transposeTimes
@@ -452,9 +454,9 @@ void ClpSimplexDual::gutsOfDual(int ifValuesPass, FloatT *&saveDuals, int initia
       if (handler_->logLevel() > 2) {
         handler_->message(CLP_SIMPLEX_STATUS, messages_)
           << numberIterations_ << objectiveValue();
-        handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+        handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
           << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-        handler_->printing(sumDualInfeasibilities_ > 0.0)
+        handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
           << sumDualInfeasibilities_ << numberDualInfeasibilities_;
         handler_->printing(numberDualInfeasibilitiesWithoutFree_
           < numberDualInfeasibilities_)
@@ -491,7 +493,7 @@ void ClpSimplexDual::gutsOfDual(int ifValuesPass, FloatT *&saveDuals, int initia
       ifValuesPass);
     smallestPrimalInfeasibility = CoinMin(smallestPrimalInfeasibility,
       sumPrimalInfeasibilities_);
-    if (sumPrimalInfeasibilities_ > 1.0e5 && sumPrimalInfeasibilities_ > 1.0e5 * smallestPrimalInfeasibility && (moreSpecialOptions_ & 256) == 0 && ((progress_.lastObjective(0) < -1.0e10 && -progress_.lastObjective(1) > -1.0e5) || sumPrimalInfeasibilities_ > 1.0e10 * smallestPrimalInfeasibility) && problemStatus_ < 0) {
+    if (sumPrimalInfeasibilities_ > 1.0e5 && sumPrimalInfeasibilities_ > 1.0e5 * smallestPrimalInfeasibility && (moreSpecialOptions_ & 256) == 0 && ((progress_.lastObjective(0) < -FloatConst::OneE10 && -progress_.lastObjective(1) > -1.0e5) || sumPrimalInfeasibilities_ > FloatConst::OneE10 * smallestPrimalInfeasibility) && problemStatus_ < 0) {
       // problems - try primal
       problemStatus_ = 10;
       // mark as large infeasibility cost wanted
@@ -558,7 +560,7 @@ void ClpSimplexDual::gutsOfDual(int ifValuesPass, FloatT *&saveDuals, int initia
     }
     // Do iterations
     int returnCode = whileIterating(saveDuals, ifValuesPass);
-    if (problemStatus_ == 1 && (progressFlag_ & 8) != 0 && CoinAbs(objectiveValue_) > 1.0e10)
+    if (problemStatus_ == 1 && (progressFlag_ & 8) != 0 && CoinAbs(objectiveValue_) > FloatConst::OneE10)
       problemStatus_ = 10; // infeasible - but has looked feasible
 #ifdef CLP_INVESTIGATE_SERIAL
     nPivots = factorization_->pivots();
@@ -590,6 +592,7 @@ void ClpSimplexDual::gutsOfDual(int ifValuesPass, FloatT *&saveDuals, int initia
 }
 int ClpSimplexDual::dual(int ifValuesPass, int startFinishOptions)
 {
+  COIN_PROFILE_REGION("dual");
   //handler_->setLogLevel(63);
   //yprintf("STARTing dual %d rows\n",numberRows_);
   bestObjectiveValue_ = -COIN_DBL_MAX;
@@ -627,9 +630,9 @@ int ClpSimplexDual::dual(int ifValuesPass, int startFinishOptions)
     gutsOfDual(ifValuesPass, saveDuals, initialStatus, data);
   if (!problemStatus_) {
     // see if cutoff reached
-    FloatT limit = 0.0;
+    FloatT limit = FloatConst::Zero;
     getDblParam(ClpDualObjectiveLimit, limit);
-    if (CoinAbs(limit) < 1.0e30 && objectiveValue() * optimizationDirection_ > limit + 1.0e-7 + 1.0e-8 * CoinAbs(limit)) {
+    if (CoinAbs(limit) < FloatConst::OneE30 && objectiveValue() * optimizationDirection_ > limit + FloatConst::OneEm7 + FloatConst::OneEm8 * CoinAbs(limit)) {
       // actually infeasible on objective
       problemStatus_ = 1;
       secondaryStatus_ = 1;
@@ -707,16 +710,16 @@ int ClpSimplexDual::dual (int ifValuesPass , int startFinishOptions)
                // make reduced costs okay
                for (i = 0; i < numberColumns_; i++) {
                     if (getStatus(i) == atLowerBound) {
-                         if (saveDuals[i] < 0.0) {
+                         if (saveDuals[i] < FloatConst::Zero) {
                               //if (saveDuals[i]<-1.0e-3)
                               //printf("bad dj at lb %d %g\n",i,saveDuals[i]);
-                              saveDuals[i] = 0.0;
+                              saveDuals[i] = FloatConst::Zero;
                          }
                     } else if (getStatus(i) == atUpperBound) {
-                         if (saveDuals[i] > 0.0) {
+                         if (saveDuals[i] > FloatConst::Zero) {
                               //if (saveDuals[i]>1.0e-3)
                               //printf("bad dj at ub %d %g\n",i,saveDuals[i]);
-                              saveDuals[i] = 0.0;
+                              saveDuals[i] = FloatConst::Zero;
                          }
                     }
                }
@@ -764,9 +767,9 @@ int ClpSimplexDual::dual (int ifValuesPass , int startFinishOptions)
                if (handler_->logLevel() > 2) {
                     handler_->message(CLP_SIMPLEX_STATUS, messages_)
                               << numberIterations_ << objectiveValue();
-                    handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+                    handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
                               << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-                    handler_->printing(sumDualInfeasibilities_ > 0.0)
+                    handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
                               << sumDualInfeasibilities_ << numberDualInfeasibilities_;
                     handler_->printing(numberDualInfeasibilitiesWithoutFree_
                                        < numberDualInfeasibilities_)
@@ -816,9 +819,9 @@ int ClpSimplexDual::dual (int ifValuesPass , int startFinishOptions)
                     if (handler_->logLevel() > 2) {
                          handler_->message(CLP_SIMPLEX_STATUS, messages_)
                                    << numberIterations_ << objectiveValue();
-                         handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+                         handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
                                    << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-                         handler_->printing(sumDualInfeasibilities_ > 0.0)
+                         handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
                                    << sumDualInfeasibilities_ << numberDualInfeasibilities_;
                          handler_->printing(numberDualInfeasibilitiesWithoutFree_
                                             < numberDualInfeasibilities_)
@@ -964,7 +967,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         continue;
       if (CoinAbs(dj_[iPivot]) > dualTolerance_) {
         // for now safer to ignore free ones
-        if (lower_[iPivot] > -1.0e50 || upper_[iPivot] < 1.0e50)
+        if (lower_[iPivot] > -FloatConst::OneE50 || upper_[iPivot] < FloatConst::OneE50)
           if (pivoted(iPivot))
             candidateList[numberCandidates++] = iRow;
       } else {
@@ -992,7 +995,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
       int il = -1;
       FloatT largest = 1.0e-1;
       int ilnb = -1;
-      FloatT largestnb = 1.0e-8;
+      FloatT largestnb = FloatConst::OneEm8;
       for (int i = 0; i < numberRows_ + numberColumns_; i++) {
         FloatT diff = CoinAbs(solution_[i] - zzzzzz[i]);
         if (diff > largest) {
@@ -1017,16 +1020,16 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
     //resetFakeBounds(-1);
 #ifdef CLP_DEBUG
     if (givenDuals) {
-      FloatT value5 = 0.0;
+      FloatT value5 = FloatConst::Zero;
       int i;
       for (i = 0; i < numberRows_ + numberColumns_; i++) {
-        if (dj_[i] < -1.0e-6)
+        if (dj_[i] < -FloatConst::OneEm6)
           if (upper_[i] < TOO_BIG_FLOAT)
             value5 += dj_[i] * upper_[i];
           else
             printf("bad dj %g on %d with large upper status %d\n",
               dj_[i], i, status_[i] & 7);
-        else if (dj_[i] > 1.0e-6)
+        else if (dj_[i] > FloatConst::OneEm6)
           if (lower_[i] > TOO_SMALL_FLOAT)
             value5 += dj_[i] * lower_[i];
           else
@@ -1036,13 +1039,13 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
       printf("Values objective Value %g\n", value5);
     }
     if ((handler_->logLevel() & 32) && wasInValuesPass) {
-      FloatT value5 = 0.0;
+      FloatT value5 = FloatConst::Zero;
       int i;
       for (i = 0; i < numberRows_ + numberColumns_; i++) {
-        if (dj_[i] < -1.0e-6)
+        if (dj_[i] < -FloatConst::OneEm6)
           if (upper_[i] < TOO_BIG_FLOAT)
             value5 += dj_[i] * upper_[i];
-          else if (dj_[i] > 1.0e-6)
+          else if (dj_[i] > FloatConst::OneEm6)
             if (lower_[i] > TOO_SMALL_FLOAT)
               value5 += dj_[i] * lower_[i];
       }
@@ -1105,7 +1108,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
       printf("xxx %d old obj %g, recomputed %g, sum dual inf %g\n",
         numberIterations_,
         saveValue, objectiveValue_, sumDualInfeasibilities_);
-      if (saveValue > objectiveValue_ + 1.0e-2)
+      if (saveValue > objectiveValue_ + FloatConst::OneEm2)
         printf("**bad**\n");
       CoinMemcpyN(saveRow1, numberRows_, rowReducedCost_);
       CoinMemcpyN(saveRow2, numberRows_, rowActivityWork_);
@@ -1129,7 +1132,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
                     unpack(rowArray_[3], iSequence);
                     factorization_->updateColumn(rowArray_[2], rowArray_[3]);
                     assert (CoinAbs(array[iPivot] - 1.0) < 1.0e-4);
-                    array[iPivot] = 0.0;
+                    array[iPivot] = FloatConst::Zero;
                     for (i = 0; i < numberRows_; i++)
                          assert (CoinAbs(array[i]) < 1.0e-4);
                     rowArray_[3]->clear();
@@ -1264,15 +1267,15 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
           acceptablePivot_ = -CoinAbs(acceptablePivot_); // stop early exit
 #if CAN_HAVE_ZERO_OBJ > 1
         if ((specialOptions_ & 16777216) != 0)
-          theta_ = 0.0;
+          theta_ = FloatConst::Zero;
 #endif
       } else {
         // Make sure direction plausible
-        CoinAssert(upperOut_ < 1.0e50 || lowerOut_ > -1.0e50);
+        CoinAssert(upperOut_ < FloatConst::OneE50 || lowerOut_ > -FloatConst::OneE50);
         // If in integer cleanup do direction using duals
         // may be wrong way round
         if (ifValuesPass == 2) {
-          if (dual_[pivotRow_] > 0.0) {
+          if (dual_[pivotRow_] > FloatConst::Zero) {
             // this will give a -1 in pivot row (as slacks are -1.0)
             directionOut_ = 1;
           } else {
@@ -1376,11 +1379,11 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         if ((handler_->logLevel() & 32))
           printf("btran alpha %g, ftran alpha %g\n", btranAlpha, alpha_);
 #endif
-        FloatT checkValue = 1.0e-7;
+        FloatT checkValue = FloatConst::OneEm7;
         // if can't trust much and long way from optimal then relax
         if (largestPrimalError_ > 10.0)
-          checkValue = CoinMin(1.0e-4, 1.0e-8 * largestPrimalError_);
-        if (CoinAbs(btranAlpha) < 1.0e-12 || CoinAbs(alpha_) < 1.0e-12 || CoinAbs(btranAlpha - alpha_) > checkValue * (1.0 + CoinAbs(alpha_))) {
+          checkValue = CoinMin(FloatConst::OneEm4, FloatConst::OneEm8 * largestPrimalError_);
+        if (CoinAbs(btranAlpha) < FloatConst::OneEm12 || CoinAbs(alpha_) < FloatConst::OneEm12 || CoinAbs(btranAlpha - alpha_) > checkValue * (1.0 + CoinAbs(alpha_))) {
           handler_->message(CLP_DUAL_CHECK, messages_)
             << btranAlpha
             << alpha_
@@ -1396,11 +1399,11 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
           } else {
             // take on more relaxed criterion
             FloatT test;
-            if (CoinAbs(btranAlpha) < 1.0e-8 || CoinAbs(alpha_) < 1.0e-8)
+            if (CoinAbs(btranAlpha) < FloatConst::OneEm8 || CoinAbs(alpha_) < FloatConst::OneEm8)
               test = 1.0e-1 * CoinAbs(alpha_);
             else
-              test = 1.0e-4 * (1.0 + CoinAbs(alpha_));
-            if (CoinAbs(btranAlpha) < 1.0e-12 || CoinAbs(alpha_) < 1.0e-12 || CoinAbs(btranAlpha - alpha_) > test) {
+              test = FloatConst::OneEm4 * (1.0 + CoinAbs(alpha_));
+            if (CoinAbs(btranAlpha) < FloatConst::OneEm12 || CoinAbs(alpha_) < FloatConst::OneEm12 || CoinAbs(btranAlpha - alpha_) > test) {
               dualRowPivot_->unrollWeights();
               // need to reject something
               char x = isColumn(sequenceOut_) ? 'C' : 'R';
@@ -1421,7 +1424,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
               rowArray_[0]->clear();
               rowArray_[1]->clear();
               columnArray_[0]->clear();
-              if (CoinAbs(alpha_) < 1.0e-10 && CoinAbs(btranAlpha) < 1.0e-8 && numberIterations_ > 100) {
+              if (CoinAbs(alpha_) < 1.0e-10 && CoinAbs(btranAlpha) < FloatConst::OneEm8 && numberIterations_ > 100) {
                 //printf("I think should declare infeasible\n");
                 problemStatus_ = 1;
                 returnCode = 1;
@@ -1432,7 +1435,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
           }
         }
         // update duals BEFORE replaceColumn so can do updateColumn
-        FloatT objectiveChange = 0.0;
+        FloatT objectiveChange = FloatConst::Zero;
         // do duals first as variables may flip bounds
         // rowArray_[0] and columnArray_[0] may have flips
         // so use rowArray_[3] for work array from here on
@@ -1476,7 +1479,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
             dualOut_ = lowerOut_ - valueOut_;
           }
 #if 0
-                         if (dualOut_ < 0.0) {
+                         if (dualOut_ < FloatConst::Zero) {
 #ifdef CLP_DEBUG
                               if (handler_->logLevel() & 32) {
                                    printf(" dualOut_ %g %g save %g\n", dualOut_, averagePrimalInfeasibility, saveDualOut);
@@ -1485,9 +1488,9 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
                               }
 #endif
                               if (upperOut_ == lowerOut_)
-                                   dualOut_ = 0.0;
+                                   dualOut_ = FloatConst::Zero;
                          }
-                         if(dualOut_ < -CoinMax(1.0e-12 * averagePrimalInfeasibility, 1.0e-8)
+                         if(dualOut_ < -CoinMax(FloatConst::OneEm12 * averagePrimalInfeasibility, FloatConst::OneEm8)
                                    && factorization_->pivots() > 100 &&
                                    getStatus(sequenceIn_) != isFree) {
                               // going backwards - factorize
@@ -1503,7 +1506,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         FloatT movementOld = oldDualOut * directionOut_ / alpha_;
         // so objective should increase by CoinAbs(dj)*movement
         // but we already have objective change - so check will be good
-        if (objectiveChange + CoinAbs(movementOld * dualIn_) < -CoinMax(1.0e-5, 1.0e-12 * CoinAbs(objectiveValue_))) {
+        if (objectiveChange + CoinAbs(movementOld * dualIn_) < -CoinMax(FloatConst::OneEm5, FloatConst::OneEm12 * CoinAbs(objectiveValue_))) {
 #ifdef CLP_DEBUG
           if (handler_->logLevel() & 32)
             printf("movement %g, swap change %g, rest %g  * %g\n",
@@ -1536,10 +1539,10 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
             (moreSpecialOptions_ & 16) != 0,
             acceptablePivot);
         // If looks like bad pivot - refactorize
-        if (CoinAbs(dualOut_) > 1.0e50)
+        if (CoinAbs(dualOut_) > FloatConst::OneE50)
           updateStatus = 2;
         // if no pivots, bad update but reasonable alpha - take and invert
-        if (updateStatus == 2 && !factorization_->pivots() && CoinAbs(alpha_) > 1.0e-5)
+        if (updateStatus == 2 && !factorization_->pivots() && CoinAbs(alpha_) > FloatConst::OneEm5)
           updateStatus = 4;
         if (updateStatus == 1 || updateStatus == 4) {
           // slight error
@@ -1582,7 +1585,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
             columnArray_[0]->clear();
             // make sure dual feasible
             // look at all rows and columns
-            FloatT objectiveChange = 0.0;
+            FloatT objectiveChange = FloatConst::Zero;
             updateDualsInDual(rowArray_[0], columnArray_[0], rowArray_[1],
               0.0, objectiveChange, true);
             rowArray_[1]->clear();
@@ -1592,7 +1595,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         } else if (updateStatus == 3) {
           // out of memory
           // increase space if not many iterations
-          if (factorization_->pivots() < 0.5 * factorization_->maximumPivots() && factorization_->pivots() < 200)
+          if (factorization_->pivots() < FloatConst::Half * factorization_->maximumPivots() && factorization_->pivots() < 200)
             factorization_->areaFactor(
               factorization_->areaFactor() * 1.1);
           problemStatus_ = -2; // factorize now
@@ -1600,12 +1603,12 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
           problemStatus_ = -2; // factorize now
         }
         // update primal solution
-        if (theta_ < 0.0 && candidate == -1) {
+        if (theta_ < FloatConst::Zero && candidate == -1) {
 #ifdef CLP_DEBUG
           if (handler_->logLevel() & 32)
             printf("negative theta %g\n", theta_);
 #endif
-          theta_ = 0.0;
+          theta_ = FloatConst::Zero;
         }
         // do actual flips
         flipBounds(rowArray_[0], columnArray_[0]);
@@ -1620,7 +1623,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         dualOut_ /= alpha_;
         dualOut_ *= -directionOut_;
         //setStatus(sequenceIn_,basic);
-        dj_[sequenceIn_] = 0.0;
+        dj_[sequenceIn_] = FloatConst::Zero;
         FloatT oldValue = valueIn_;
         if (directionIn_ == -1) {
           // as if from upper bound
@@ -1658,8 +1661,8 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         if (ixxxxxx > ixxyyyy - 5) {
           handler_->setLogLevel(63);
           int nTotal = numberColumns_ + numberRows_;
-          FloatT oldObj = 0.0;
-          FloatT newObj = 0.0;
+          FloatT oldObj = FloatConst::Zero;
+          FloatT newObj = FloatConst::Zero;
           for (int i = 0; i < nTotal; i++) {
             if (savePSol[i])
               oldObj += savePSol[i] * saveCost[i];
@@ -1682,7 +1685,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
             oldObj, newObj);
           memset(saveDj, 0, numberRows_ * sizeof(FloatT));
           times(1.0, savePSol, saveDj);
-          FloatT largest = 1.0e-6;
+          FloatT largest = FloatConst::OneEm6;
           int k = -1;
           for (int i = 0; i < numberRows_; i++) {
             saveDj[i] -= savePSol[i + numberColumns_];
@@ -1760,7 +1763,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         originalBound(sequenceIn_);
         changeBound(sequenceOut_);
 #ifdef CLP_DEBUG
-        if (objectiveValue_ < oldobj - 1.0e-5 && (handler_->logLevel() & 16))
+        if (objectiveValue_ < oldobj - FloatConst::OneEm5 && (handler_->logLevel() & 16))
           printf("obj backwards %g %g\n", objectiveValue_, oldobj);
 #endif
 #if 0
@@ -1811,7 +1814,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
         ray_ = NULL;
         if ((factorization_->pivots() < 2
               || ((specialOptions_ & 2097152) != 0 && factorization_->pivots() < 50))
-          && acceptablePivot_ <= 1.0e-8 && acceptablePivot_ > 0.0) {
+          && acceptablePivot_ <= FloatConst::OneEm8 && acceptablePivot_ > FloatConst::Zero) {
           //&&goodAccuracy()) {
           // If not in branch and bound etc save ray
           if ((specialOptions_ & (1024 | 4096)) == 0 || (specialOptions_ & (32 | 2097152)) != 0) {
@@ -1836,16 +1839,16 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
               memset(farkas, 0, (2 * numberColumns_ + numberRows_) * sizeof(FloatT));
               transposeTimes(-1.0, ray_, farkas);
               for (int i = 0; i < numberRows_; i++) {
-                if (CoinAbs(ray_[i]) > 1.0e-7) {
+                if (CoinAbs(ray_[i]) > FloatConst::OneEm7) {
                   if (getRowStatus(i) == basic) {
                     nBasic++;
                   } else if (getRowStatus(i) == atLowerBound) {
-                    if (ray_[i] > 0.0)
+                    if (ray_[i] > FloatConst::Zero)
                       nPlusLower++;
                     else
                       nMinusLower++;
                   } else if (getRowStatus(i) == atUpperBound) {
-                    if (ray_[i] > 0.0)
+                    if (ray_[i] > FloatConst::Zero)
                       nPlusUpper++;
                     else
                       nMinusUpper++;
@@ -1857,28 +1860,28 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
               printf("Slacks %d basic lower +,- %d,%d upper +,- %d,%d\n",
                 nBasic, nPlusLower, nMinusLower, nPlusUpper, nMinusLower);
               for (int i = 0; i < numberColumns_; i++) {
-                if (CoinAbs(farkas[i]) > 1.0e-7) {
+                if (CoinAbs(farkas[i]) > FloatConst::OneEm7) {
                   if (getColumnStatus(i) == basic) {
                     nBasic++;
                   } else if (getColumnStatus(i) == atLowerBound) {
-                    if (farkas[i] > 0.0)
+                    if (farkas[i] > FloatConst::Zero)
                       nPlusLower++;
                     else
                       nMinusLower++;
                   } else if (getColumnStatus(i) == atUpperBound) {
-                    if (farkas[i] > 0.0)
+                    if (farkas[i] > FloatConst::Zero)
                       nPlusUpper++;
                     else
                       nMinusUpper++;
                   } else {
                     if (!lower_[i]) {
-                      if (farkas[i] > 0.0) {
+                      if (farkas[i] > FloatConst::Zero) {
                         nPlusFixedLower++;
                       } else {
                         nMinusFixedLower++;
                       }
                     } else {
-                      if (farkas[i] > 0.0) {
+                      if (farkas[i] > FloatConst::Zero) {
                         nPlusFixedUpper++;
                       } else {
                         nMinusFixedUpper++;
@@ -1902,11 +1905,11 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
           FloatT dualTest = ((specialOptions_ & 4096) != 0) ? 1.0e8 : 1.0e13;
           // but if none at fake bounds
           if (!checkFakeBounds())
-            dualTest = 0.0;
+            dualTest = FloatConst::Zero;
           if (((specialOptions_ & 4096) != 0 || bestPossiblePivot < 1.0e-11) && dualBound_ > dualTest) {
-            FloatT testValue = 1.0e-4;
+            FloatT testValue = FloatConst::OneEm4;
             if (!factorization_->pivots() && numberPrimalInfeasibilities_ == 1)
-              testValue = 1.0e-6;
+              testValue = FloatConst::OneEm6;
             if (valueOut_ > upperOut_ + testValue || valueOut_ < lowerOut_ - testValue
               || (specialOptions_ & 64) == 0) {
               // say infeasible
@@ -1919,7 +1922,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
               // Should be correct - but ...
               int numberFake = numberAtFakeBound();
               FloatT sumPrimal = (!numberFake) ? 2.0e5 : sumPrimalInfeasibilities_;
-              if (sumPrimalInfeasibilities_ < 1.0e-3 || sumDualInfeasibilities_ > 1.0e-5 || (sumPrimal < 1.0e5 && (specialOptions_ & 1024) != 0 && factorization_->pivots())) {
+              if (sumPrimalInfeasibilities_ < FloatConst::OneEm3 || sumDualInfeasibilities_ > FloatConst::OneEm5 || (sumPrimal < 1.0e5 && (specialOptions_ & 1024) != 0 && factorization_->pivots())) {
                 if (sumPrimal > 50.0 && factorization_->pivots() > 2) {
                   problemStatus_ = -4;
 #ifdef COIN_DEVELOP
@@ -1947,7 +1950,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
                 }
               }
 #else
-              if (sumPrimalInfeasibilities_ < 1.0e-3 || sumDualInfeasibilities_ > 1.0e-6) {
+              if (sumPrimalInfeasibilities_ < FloatConst::OneEm3 || sumDualInfeasibilities_ > FloatConst::OneEm6) {
 #ifdef COIN_DEVELOP
                 printf("at %d - primal %d %g - dual %d %g fake %d weight %g - pivs %d\n",
                   __LINE__, numberPrimalInfeasibilities_,
@@ -1994,8 +1997,8 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
           }
         }
         acceptablePivot_ = CoinAbs(acceptablePivot_);
-        if (factorization_->pivots() < 5 && acceptablePivot_ > 1.0e-8)
-          acceptablePivot_ = 1.0e-8;
+        if (factorization_->pivots() < 5 && acceptablePivot_ > FloatConst::OneEm8)
+          acceptablePivot_ = FloatConst::OneEm8;
         rowArray_[0]->clear();
         columnArray_[0]->clear();
         returnCode = 1;
@@ -2099,12 +2102,12 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
 #endif
               computePrimals(rowActivityWork_, columnActivityWork_);
 #ifndef NDEBUG_CLP
-              FloatT largest = 1.0e-5;
+              FloatT largest = FloatConst::OneEm5;
               int bad = -1;
               for (int i = 0; i < nTotal; i++) {
                 FloatT value = solution_[i];
                 FloatT larger = CoinMax(CoinAbs(value), CoinAbs(comp[i]));
-                FloatT tol = 1.0e-5 + 1.0e-5 * larger;
+                FloatT tol = FloatConst::OneEm5 + FloatConst::OneEm5 * larger;
                 FloatT diff = CoinAbs(value - comp[i]);
                 if (diff - tol > largest) {
                   bad = i;
@@ -2132,9 +2135,9 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
             if (!problemStatus_) {
               // make it look OK
               numberPrimalInfeasibilities_ = 0;
-              sumPrimalInfeasibilities_ = 0.0;
+              sumPrimalInfeasibilities_ = FloatConst::Zero;
               numberDualInfeasibilities_ = 0;
-              sumDualInfeasibilities_ = 0.0;
+              sumDualInfeasibilities_ = FloatConst::Zero;
               // May be perturbed
               if (perturbation_ == 101 || numberChanged_) {
                 numberChanged_ = 0; // Number of variables with changed costs
@@ -2190,7 +2193,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
                   arrayVector->setDenseVector(array);
                 }
               }
-              sumPrimalInfeasibilities_ = 0.0;
+              sumPrimalInfeasibilities_ = FloatConst::Zero;
             }
             if ((specialOptions_ & (1024 + 16384)) != 0 && !problemStatus_) {
               CoinIndexedVector *arrayVector = rowArray_[1];
@@ -2210,13 +2213,13 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
                     rowLowerWork_[i], rowUpperWork_[i],
                     rhs[i], rowActivityWork_[i]);
 #endif
-                } else if (CoinAbs(rhs[i] - rowActivityWork_[i]) > 1.0e-3) {
+                } else if (CoinAbs(rhs[i] - rowActivityWork_[i]) > FloatConst::OneEm3) {
 #ifdef CHECK_ACCURACY
                   bad = true;
                   printf("row %d correct %g bad %g\n", i, rhs[i], rowActivityWork_[i]);
 #endif
                 }
-                rhs[i] = 0.0;
+                rhs[i] = FloatConst::Zero;
               }
               for (i = 0; i < numberColumns_; i++) {
                 if (solution_[i] < columnLowerWork_[i] - primalTolerance_ || solution_[i] > columnUpperWork_[i] + primalTolerance_) {
@@ -2257,8 +2260,8 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
 #ifdef CLP_REPORT_PROGRESS
   if (ixxxxxx > ixxyyyy - 5) {
     int nTotal = numberColumns_ + numberRows_;
-    FloatT oldObj = 0.0;
-    FloatT newObj = 0.0;
+    FloatT oldObj = FloatConst::Zero;
+    FloatT newObj = FloatConst::Zero;
     for (int i = 0; i < nTotal; i++) {
       if (savePSol[i])
         oldObj += savePSol[i] * saveCost[i];
@@ -2281,7 +2284,7 @@ int ClpSimplexDual::whileIterating(FloatT *&givenDuals, int ifValuesPass)
       oldObj, newObj);
     memset(saveDj, 0, numberRows_ * sizeof(FloatT));
     times(1.0, savePSol, saveDj);
-    FloatT largest = 1.0e-6;
+    FloatT largest = FloatConst::OneEm6;
     int k = -1;
     for (int i = 0; i < numberRows_; i++) {
       saveDj[i] -= savePSol[i + numberColumns_];
@@ -2318,7 +2321,7 @@ updateDualBit(clpTempInfo &info)
   for (int i = 0; i < number; i++) {
     int iSequence = which[i];
     FloatT alphaI = work[i];
-    work[i] = 0.0;
+    work[i] = FloatConst::Zero;
 
     int iStatus = (statusArray[iSequence] & 3) - 1;
     if (iStatus) {
@@ -2350,6 +2353,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
   FloatT &objectiveChange,
   bool fullRecompute)
 {
+  COIN_PROFILE_REGION("updateDuals");
 
   outputArray->clear();
 
@@ -2359,11 +2363,11 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
   // get a tolerance
   FloatT tolerance = dualTolerance_;
   // we can't really trust infeasibilities if there is dual error
-  FloatT error = CoinMin(1.0e-2, largestDualError_);
+  FloatT error = CoinMin(FloatConst::OneEm2, largestDualError_);
   // allow tolerance at least slightly bigger than standard
   tolerance = tolerance + error;
 
-  FloatT changeObj = 0.0;
+  FloatT changeObj = FloatConst::Zero;
 
   // Coding is very similar but we can save a bit by splitting
   // Do rows
@@ -2385,7 +2389,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
     for (i = 0; i < number; i++) {
       int iSequence = which[i];
       FloatT alphaI = work[i];
-      work[i] = 0.0;
+      work[i] = FloatConst::Zero;
       int iStatus = (statusArray[iSequence] & 3) - 1;
       if (iStatus) {
         FloatT value = reducedCost[iSequence] - theta * alphaI;
@@ -2399,7 +2403,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           FloatT movement = mult * (lower[iSequence] - upper[iSequence]);
           which[numberInfeasibilities++] = iSequence;
 #ifndef NDEBUG
-          if (CoinAbs(movement) >= 1.0e30)
+          if (CoinAbs(movement) >= FloatConst::OneE30)
             resetFakeBounds(-1000 - iSequence);
 #endif
 #ifdef CLP_DEBUG
@@ -2448,9 +2452,9 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           n += chunk;
         }
         for (i = 0; i < numberThreads; i++) {
-          cilk_spawn updateDualBit(info[i]);
+          clp_spawn(updateDualBit, info[i]);
         }
-        cilk_sync;
+        clp_sync;
         for (i = 0; i < numberThreads; i++) {
           int n = info[i].numberInfeasibilities;
           FloatT *workV = info[i].work;
@@ -2458,10 +2462,10 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           for (int j = 0; j < n; j++) {
             int iSequence = whichV[j];
             FloatT movement = workV[j];
-            workV[j] = 0.0;
+            workV[j] = FloatConst::Zero;
             whichX[numberInfeasibilities++] = iSequence;
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
             changeObj += movement * cost[iSequence];
@@ -2473,7 +2477,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
         for (i = 0; i < number; i++) {
           int iSequence = which[i];
           FloatT alphaI = work[i];
-          work[i] = 0.0;
+          work[i] = FloatConst::Zero;
 
           int iStatus = (statusArray[iSequence] & 3) - 1;
           if (iStatus) {
@@ -2489,7 +2493,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
               FloatT movement = mult * (upper[iSequence] - lower[iSequence]);
               which[numberInfeasibilities++] = iSequence;
 #ifndef NDEBUG
-              if (CoinAbs(movement) >= 1.0e30)
+              if (CoinAbs(movement) >= FloatConst::OneE30)
                 resetFakeBounds(-1000 - iSequence);
 #endif
 #ifdef CLP_DEBUG
@@ -2509,20 +2513,20 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
       for (i = 0; i < number; i++) {
         int iSequence = which[i];
         FloatT alphaI = work[i];
-        work[i] = 0.0;
+        work[i] = FloatConst::Zero;
 
         Status status = getStatus(iSequence);
         if (status == atLowerBound) {
           FloatT value = reducedCost[iSequence] - theta * alphaI;
           reducedCost[iSequence] = value;
-          FloatT movement = 0.0;
+          FloatT movement = FloatConst::Zero;
 
           if (value < -tolerance) {
             // to upper bound
             which[numberInfeasibilities++] = iSequence;
             movement = upper[iSequence] - lower[iSequence];
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
 #ifdef CLP_DEBUG
@@ -2536,14 +2540,14 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
         } else if (status == atUpperBound) {
           FloatT value = reducedCost[iSequence] - theta * alphaI;
           reducedCost[iSequence] = value;
-          FloatT movement = 0.0;
+          FloatT movement = FloatConst::Zero;
 
           if (value > tolerance) {
             // to lower bound (if swap)
             which[numberInfeasibilities++] = iSequence;
             movement = lower[iSequence] - upper[iSequence];
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
 #ifdef CLP_DEBUG
@@ -2575,7 +2579,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
       Status status = getStatus(iSequence + numberColumns_);
       // more likely to be at upper bound ?
       if (status == atUpperBound) {
-        FloatT movement = 0.0;
+        FloatT movement = FloatConst::Zero;
         //#define NO_SWAP7
         if (value > tolerance) {
           // to lower bound (if swap)
@@ -2595,7 +2599,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
               numberFake_++;
 #ifndef NDEBUG
             } else {
-              if (CoinAbs(movement) >= 1.0e30)
+              if (CoinAbs(movement) >= FloatConst::OneE30)
                 resetFakeBounds(-1000 - iSequence);
 #endif
             }
@@ -2610,7 +2614,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           if (bound == ClpSimplexDual::upperFake) {
             movement = lower[iSequence] - upper[iSequence];
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
             setStatus(iSequence + numberColumns_, atLowerBound);
@@ -2622,7 +2626,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
 #endif
         }
       } else if (status == atLowerBound) {
-        FloatT movement = 0.0;
+        FloatT movement = FloatConst::Zero;
 
         if (value < -tolerance) {
           // to upper bound
@@ -2641,7 +2645,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
               numberFake_++;
 #ifndef NDEBUG
             } else {
-              if (CoinAbs(movement) >= 1.0e30)
+              if (CoinAbs(movement) >= FloatConst::OneE30)
                 resetFakeBounds(-1000 - iSequence);
 #endif
             }
@@ -2656,7 +2660,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           if (bound == ClpSimplexDual::lowerFake) {
             movement = upper[iSequence] - lower[iSequence];
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
             setStatus(iSequence + numberColumns_, atUpperBound);
@@ -2685,7 +2689,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
 
       Status status = getStatus(iSequence);
       if (status == atLowerBound) {
-        FloatT movement = 0.0;
+        FloatT movement = FloatConst::Zero;
 
         if (value < -tolerance) {
           // to upper bound
@@ -2704,7 +2708,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
               numberFake_++;
 #ifndef NDEBUG
             } else {
-              if (CoinAbs(movement) >= 1.0e30)
+              if (CoinAbs(movement) >= FloatConst::OneE30)
                 resetFakeBounds(-1000 - iSequence);
 #endif
             }
@@ -2719,7 +2723,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           if (bound == ClpSimplexDual::lowerFake) {
             movement = upper[iSequence] - lower[iSequence];
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
             setStatus(iSequence, atUpperBound);
@@ -2731,7 +2735,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
 #endif
         }
       } else if (status == atUpperBound) {
-        FloatT movement = 0.0;
+        FloatT movement = FloatConst::Zero;
 
         if (value > tolerance) {
           // to lower bound (if swap)
@@ -2750,7 +2754,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
               numberFake_++;
 #ifndef NDEBUG
             } else {
-              if (CoinAbs(movement) >= 1.0e30)
+              if (CoinAbs(movement) >= FloatConst::OneE30)
                 resetFakeBounds(-1000 - iSequence);
 #endif
             }
@@ -2765,7 +2769,7 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           if (bound == ClpSimplexDual::upperFake) {
             movement = lower[iSequence] - upper[iSequence];
 #ifndef NDEBUG
-            if (CoinAbs(movement) >= 1.0e30)
+            if (CoinAbs(movement) >= FloatConst::OneE30)
               resetFakeBounds(-1000 - iSequence);
 #endif
             setStatus(iSequence, atLowerBound);
@@ -2817,7 +2821,7 @@ void ClpSimplexDual::updateDualsInValuesPass(CoinIndexedVector *rowArray,
       int iSequence = which[i];
       FloatT alphaI = work[i];
       FloatT value = reducedCost[iSequence] - theta * alphaI;
-      work[i] = 0.0;
+      work[i] = FloatConst::Zero;
       reducedCost[iSequence] = value;
 
       Status status = getStatus(iSequence + numberColumns_);
@@ -2825,11 +2829,11 @@ void ClpSimplexDual::updateDualsInValuesPass(CoinIndexedVector *rowArray,
       if (status == atUpperBound) {
 
         if (value > tolerance)
-          reducedCost[iSequence] = 0.0;
+          reducedCost[iSequence] = FloatConst::Zero;
       } else if (status == atLowerBound) {
 
         if (value < -tolerance) {
-          reducedCost[iSequence] = 0.0;
+          reducedCost[iSequence] = FloatConst::Zero;
         }
       }
     }
@@ -2851,16 +2855,16 @@ void ClpSimplexDual::updateDualsInValuesPass(CoinIndexedVector *rowArray,
       int iSequence = which[i];
       FloatT alphaI = work[i];
       FloatT value = reducedCost[iSequence] - theta * alphaI;
-      work[i] = 0.0;
+      work[i] = FloatConst::Zero;
       reducedCost[iSequence] = value;
 
       Status status = getStatus(iSequence);
       if (status == atLowerBound) {
         if (value < -tolerance)
-          reducedCost[iSequence] = 0.0;
+          reducedCost[iSequence] = FloatConst::Zero;
       } else if (status == atUpperBound) {
         if (value > tolerance)
-          reducedCost[iSequence] = 0.0;
+          reducedCost[iSequence] = FloatConst::Zero;
       }
     }
   }
@@ -2874,6 +2878,7 @@ void ClpSimplexDual::updateDualsInValuesPass(CoinIndexedVector *rowArray,
 */
 void ClpSimplexDual::dualRow(int alreadyChosen)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::pricing);
   // get pivot row using whichever method it is
   int chosenRow = -1;
 #ifdef FORCE_FOLLOW
@@ -2927,21 +2932,21 @@ void ClpSimplexDual::dualRow(int alreadyChosen)
       FloatT *work = rowArray_[1]->denseVector();
       int number = rowArray_[1]->getNumElements();
       int *which = rowArray_[1]->getIndices();
-      FloatT bestFeasibleAlpha = 0.0;
+      FloatT bestFeasibleAlpha = FloatConst::Zero;
       int bestFeasibleRow = -1;
-      FloatT bestInfeasibleAlpha = 0.0;
+      FloatT bestInfeasibleAlpha = FloatConst::Zero;
       int bestInfeasibleRow = -1;
       int i;
 
       for (i = 0; i < number; i++) {
         int iRow = which[i];
         FloatT alpha = CoinAbs(work[iRow]);
-        if (alpha > 1.0e-3) {
+        if (alpha > FloatConst::OneEm3) {
           int iSequence = pivotVariable_[iRow];
           FloatT value = solution_[iSequence];
           FloatT lower = lower_[iSequence];
           FloatT upper = upper_[iSequence];
-          FloatT infeasibility = 0.0;
+          FloatT infeasibility = FloatConst::Zero;
           if (value > upper)
             infeasibility = value - upper;
           else if (value < lower)
@@ -2960,7 +2965,7 @@ void ClpSimplexDual::dualRow(int alreadyChosen)
       }
       if (bestInfeasibleRow >= 0)
         chosenRow = bestInfeasibleRow;
-      else if (bestFeasibleAlpha > 1.0e-2)
+      else if (bestFeasibleAlpha > FloatConst::OneEm2)
         chosenRow = bestFeasibleRow;
       if (chosenRow >= 0) {
         pivotRow_ = chosenRow;
@@ -3016,13 +3021,13 @@ void ClpSimplexDual::dualRow(int alreadyChosen)
 #else
         // odd (could be free) - it's feasible - improve obj
         printf("direction from alpha of %g is %d\n",
-          freeAlpha, freeAlpha > 0.0 ? 1 : -1);
+          freeAlpha, freeAlpha > FloatConst::Zero ? 1 : -1);
         if (valueOut_ - lowerOut_ > TOO_BIG_FLOAT)
           freeAlpha = 1.0;
         else if (upperOut_ - valueOut_ > TOO_BIG_FLOAT)
           freeAlpha = -1.0;
         //if (valueOut_-lowerOut_<upperOut_-valueOut_) {
-        if (freeAlpha < 0.0) {
+        if (freeAlpha < FloatConst::Zero) {
           directionOut_ = 1;
           dualOut_ = lowerOut_ - valueOut_;
         } else {
@@ -3040,8 +3045,8 @@ void ClpSimplexDual::dualRow(int alreadyChosen)
       // in values pass so just use sign of dj
       // We don't want to go through any barriers so set dualOut low
       // free variables will never be here
-      dualOut_ = 1.0e-6;
-      if (dj_[sequenceOut_] > 0.0) {
+      dualOut_ = FloatConst::OneEm6;
+      if (dj_[sequenceOut_] > FloatConst::Zero) {
         // this will give a -1 in pivot row (as slacks are -1.0)
         directionOut_ = 1;
       } else {
@@ -3068,7 +3073,7 @@ int ClpSimplexDual::changeBounds(int initialize,
     FloatT newBound;
     newBound = 5.0 * dualBound_;
     numberInfeasibilities = 0;
-    changeCost = 0.0;
+    changeCost = FloatConst::Zero;
     // put back original bounds and then check
     createRim1(false);
     int iSequence;
@@ -3183,13 +3188,13 @@ int ClpSimplexDual::changeBounds(int initialize,
             FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
             // lower
             FloatT value = columnLower_[iSequence];
-            if (value > -1.0e30) {
+            if (value > -FloatConst::OneE30) {
               value *= multiplier;
             }
             lower_[iSequence] = value;
             // upper
             value = columnUpper_[iSequence];
-            if (value < 1.0e30) {
+            if (value < FloatConst::OneE30) {
               value *= multiplier;
             }
             upper_[iSequence] = value;
@@ -3200,13 +3205,13 @@ int ClpSimplexDual::changeBounds(int initialize,
           // lower
           FloatT multiplier = rhsScale_ * rowScale_[iSequence];
           FloatT value = rowLower_[iSequence];
-          if (value > -1.0e30) {
+          if (value > -FloatConst::OneE30) {
             value *= multiplier;
           }
           lower_[iSequence + numberColumns_] = value;
           // upper
           value = rowUpper_[iSequence];
-          if (value < 1.0e30) {
+          if (value < FloatConst::OneE30) {
             value *= multiplier;
           }
           upper_[iSequence + numberColumns_] = value;
@@ -3237,7 +3242,7 @@ int ClpSimplexDual::changeBounds(int initialize,
         FloatT upperValue = upper_[iSequence];
         FloatT value = solution_[iSequence];
         if (lowerValue > -largeValue_ || upperValue < largeValue_) {
-          if (true || lowerValue - value > -0.5 * dualBound_ || upperValue - value < 0.5 * dualBound_) {
+          if (true || lowerValue - value > -FloatConst::Half * dualBound_ || upperValue - value < FloatConst::Half * dualBound_) {
             if (CoinAbs(lowerValue - value) <= CoinAbs(upperValue - value)) {
               if (upperValue > lowerValue + testBound) {
                 if (getFakeBound(iSequence) == ClpSimplexDual::noFake)
@@ -3256,8 +3261,8 @@ int ClpSimplexDual::changeBounds(int initialize,
           } else {
             if (getFakeBound(iSequence) == ClpSimplexDual::noFake)
               numberFake_++;
-            lower_[iSequence] = -0.5 * dualBound_;
-            upper_[iSequence] = 0.5 * dualBound_;
+            lower_[iSequence] = -FloatConst::Half * dualBound_;
+            upper_[iSequence] = FloatConst::Half * dualBound_;
             setFakeBound(iSequence, ClpSimplexDual::bothFake);
             abort();
           }
@@ -3270,30 +3275,30 @@ int ClpSimplexDual::changeBounds(int initialize,
           // I don't think we should ever get here
           // yes we can if basis goes singular twice in succession!
           //CoinAssert(!("should not be here"));
-          lower_[iSequence] = -0.5 * dualBound_;
-          upper_[iSequence] = 0.5 * dualBound_;
+          lower_[iSequence] = -FloatConst::Half * dualBound_;
+          upper_[iSequence] = FloatConst::Half * dualBound_;
           setFakeBound(iSequence, ClpSimplexDual::bothFake);
           numberFake_++;
           setStatus(iSequence, atUpperBound);
-          solution_[iSequence] = 0.5 * dualBound_;
+          solution_[iSequence] = FloatConst::Half * dualBound_;
         }
       } else if (status == basic) {
         // make sure not at fake bound and bounds correct
         setFakeBound(iSequence, ClpSimplexDual::noFake);
         FloatT gap = upper_[iSequence] - lower_[iSequence];
-        if (gap > 0.5 * dualBound_ && gap < 2.0 * dualBound_) {
+        if (gap > FloatConst::Half * dualBound_ && gap < 2.0 * dualBound_) {
           if (iSequence < numberColumns_) {
             if (columnScale_) {
               FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
               // lower
               FloatT value = columnLower_[iSequence];
-              if (value > -1.0e30) {
+              if (value > -FloatConst::OneE30) {
                 value *= multiplier;
               }
               lower_[iSequence] = value;
               // upper
               value = columnUpper_[iSequence];
-              if (value < 1.0e30) {
+              if (value < FloatConst::OneE30) {
                 value *= multiplier;
               }
               upper_[iSequence] = value;
@@ -3309,13 +3314,13 @@ int ClpSimplexDual::changeBounds(int initialize,
               // lower
               FloatT multiplier = rhsScale_ * rowScale_[iRow];
               FloatT value = rowLower_[iRow];
-              if (value > -1.0e30) {
+              if (value > -FloatConst::OneE30) {
                 value *= multiplier;
               }
               lower_[iSequence] = value;
               // upper
               value = rowUpper_[iRow];
-              if (value < 1.0e30) {
+              if (value < FloatConst::OneE30) {
                 value *= multiplier;
               }
               upper_[iSequence] = value;
@@ -3341,7 +3346,7 @@ int ClpSimplexDual::changeBounds(int initialize,
           if ((static_cast< int >(fakeStatus) & 1) != 0) {
             // lower
             FloatT value = columnLower_[iSequence];
-            if (value > -1.0e30) {
+            if (value > -FloatConst::OneE30) {
               FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
               value *= multiplier;
             }
@@ -3350,7 +3355,7 @@ int ClpSimplexDual::changeBounds(int initialize,
           if ((static_cast< int >(fakeStatus) & 2) != 0) {
             // upper
             FloatT value = columnUpper_[iSequence];
-            if (value < 1.0e30) {
+            if (value < FloatConst::OneE30) {
               FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
               value *= multiplier;
             }
@@ -3364,7 +3369,7 @@ int ClpSimplexDual::changeBounds(int initialize,
           if ((static_cast< int >(fakeStatus) & 1) != 0) {
             // lower
             FloatT value = rowLower_[iSequence];
-            if (value > -1.0e30) {
+            if (value > -FloatConst::OneE30) {
               FloatT multiplier = rhsScale_ * rowScale_[iSequence];
               value *= multiplier;
             }
@@ -3373,7 +3378,7 @@ int ClpSimplexDual::changeBounds(int initialize,
           if ((static_cast< int >(fakeStatus) & 2) != 0) {
             // upper
             FloatT value = rowUpper_[iSequence];
-            if (value < 1.0e30) {
+            if (value < FloatConst::OneE30) {
               FloatT multiplier = rhsScale_ * rowScale_[iSequence];
               value *= multiplier;
             }
@@ -3460,7 +3465,7 @@ dualColumn00(clpTempInfo &info)
     if (wanted) {
       FloatT mult = multiplier[wanted - 1];
       FloatT alpha = work[i] * mult;
-      if (alpha > 0.0) {
+      if (alpha > FloatConst::Zero) {
         FloatT oldValue = reducedCost[iSequence] * mult;
         FloatT value = oldValue - tentativeTheta * alpha;
         if (value < dualT) {
@@ -3482,9 +3487,9 @@ static void
 dualColumn000(int numberThreads, clpTempInfo *info)
 {
   for (int i = 0; i < numberThreads; i++) {
-    cilk_spawn dualColumn00(info[i]);
+    clp_spawn(dualColumn00, info[i]);
   }
-  cilk_sync;
+  clp_sync;
 }
 void moveAndZero(clpTempInfo *info, int type, void *extra)
 {
@@ -3579,7 +3584,7 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
   FloatT freePivot = acceptablePivot;
   int numberRemaining = 0;
   int i;
-  badFree = 0.0;
+  badFree = FloatConst::Zero;
   if ((moreSpecialOptions_ & 8) != 0) {
     // No free or super basic
     // bestPossible will re recomputed if necessary
@@ -3627,7 +3632,7 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
         if (iStatus) {
           FloatT mult = multiplier[iStatus - 1];
           alpha = work[i] * mult;
-          if (alpha > 0.0) {
+          if (alpha > FloatConst::Zero) {
             oldValue = reducedCost[iSequence] * mult;
             value = oldValue - tentativeTheta * alpha;
             if (value < dualT) {
@@ -3666,14 +3671,14 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
       int nBlocks = (number + CHECK_CHUNK - 1) / CHECK_CHUNK;
       int n = nBlocks * CHECK_CHUNK + 1;
       for (int i = number; i < n; i++) {
-        workX[i] = 0.0;
+        workX[i] = FloatConst::Zero;
         whichX[i] = 0; // alpha will be zero so not chosen
       }
       bool acceptableX[CHECK_CHUNK + 1];
       FloatT oldValueX[CHECK_CHUNK + 1];
       FloatT newValueX[CHECK_CHUNK + 1];
       FloatT alphaX[CHECK_CHUNK + 1];
-      newValueX[CHECK_CHUNK] = 0.0;
+      newValueX[CHECK_CHUNK] = FloatConst::Zero;
 #define USE_USE_AVX
       //#define CHECK_H 1
 #ifdef USE_USE_AVX
@@ -3697,10 +3702,10 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
 #endif
       for (int iBlock = 0; iBlock < nBlocks; iBlock++) {
         bool store = false;
-        FloatT alpha = 0.0;
-        FloatT oldValue = 0.0;
-        FloatT newValue = 0.0;
-        FloatT trueAlpha = 0.0;
+        FloatT alpha = FloatConst::Zero;
+        FloatT oldValue = FloatConst::Zero;
+        FloatT newValue = FloatConst::Zero;
+        FloatT trueAlpha = FloatConst::Zero;
         int jSequence = 0;
 #ifndef USE_USE_AVX
         for (int i = 0; i < CHECK_CHUNK + 1; i++) {
@@ -3751,12 +3756,12 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
           assert(alphaX[i] == alphaY[i]);
         }
         for (int i = 0; i < CHECK_CHUNK; i++) {
-          bool g1 = newValueX[i] < 0.0;
+          bool g1 = newValueX[i] < FloatConst::Zero;
           bool g2 = goodDj[i] != 0;
           if (g1 != g2)
             abort();
           //if(acceptableX[i]!=(acceptableY[i]))abort();
-          if (CoinAbs(oldValueX[i] - oldValueY[i]) > 1.0e-5 + +(1.0e-10 * CoinAbs(oldValueX[i])))
+          if (CoinAbs(oldValueX[i] - oldValueY[i]) > FloatConst::OneEm5 + +(1.0e-10 * CoinAbs(oldValueX[i])))
             abort();
           if (alphaX[i] != alphaY[i])
             abort();
@@ -3766,7 +3771,7 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
         for (int i = 0; i < CHECK_CHUNK + 1; i++) {
 #ifndef USE_USE_AVX
           FloatT newValue = newValueX[i];
-          bool newStore = newValue < 0.0;
+          bool newStore = newValue < FloatConst::Zero;
           if (store) {
             // add to list
             bool acceptable = acceptableX[i - 1];
@@ -3876,7 +3881,7 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
           } else if (oldValue < -dualTolerance_) {
             keep = true;
           } else {
-            if (CoinAbs(alpha) > CoinMax(10.0 * acceptablePivot, 1.0e-5)) {
+            if (CoinAbs(alpha) > CoinMax(10.0 * acceptablePivot, FloatConst::OneEm5)) {
               keep = true;
             } else {
               keep = false;
@@ -3968,16 +3973,17 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
   FloatT acceptablePivot,
   CoinBigIndex * /*dubiousWeights*/)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::ratioTest);
   int numberPossiblySwapped = 0;
   int numberRemaining = 0;
 
-  FloatT totalThru = 0.0; // for when variables flip
+  FloatT totalThru = FloatConst::Zero; // for when variables flip
   //FloatT saveAcceptable=acceptablePivot;
   //acceptablePivot=1.0e-9;
 
   FloatT bestEverPivot = acceptablePivot;
   int lastSequence = -1;
-  FloatT lastPivot = 0.0;
+  FloatT lastPivot = FloatConst::Zero;
   FloatT upperTheta;
   FloatT newTolerance = dualTolerance_;
   //newTolerance = dualTolerance_+1.0e-6*dblParam_[ClpDualTolerance];
@@ -3986,7 +3992,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
   // If we think we need to modify costs (not if something from broad sweep)
   bool modifyCosts = false;
   // Increase in objective due to swapping bounds (may be negative)
-  FloatT increaseInObjective = 0.0;
+  FloatT increaseInObjective = FloatConst::Zero;
 
   // use spareArrays to put ones looked at in
   // we are going to flip flop between
@@ -4038,8 +4044,8 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
   // do first pass to get possibles
   upperTheta = 1.0e31;
   FloatT bestPossible = 1.0;
-  FloatT badFree = 0.0;
-  alpha_ = 0.0;
+  FloatT badFree = FloatConst::Zero;
+  alpha_ = FloatConst::Zero;
   if (spareIntArray_[0] >= 0) {
     numberRemaining = dualColumn0(rowArray, columnArray, spareArray,
       acceptablePivot, upperTheta, badFree);
@@ -4095,14 +4101,14 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
     // free variable - always choose
   } else {
 
-    theta_ = 1.0e50;
+    theta_ = FloatConst::OneE50;
     // now flip flop between spare arrays until reasonable theta
-    tentativeTheta = CoinMax(10.0 * upperTheta, 1.0e-7);
+    tentativeTheta = CoinMax(10.0 * upperTheta, FloatConst::OneEm7);
 
     // loops increasing tentative theta until can't go through
 
     while (tentativeTheta < 1.0e22) {
-      FloatT thruThis = 0.0;
+      FloatT thruThis = FloatConst::Zero;
 
       FloatT bestPivot = acceptablePivot;
       int bestSequence = -1;
@@ -4110,7 +4116,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
       numberPossiblySwapped = numberColumns_;
       numberRemaining = 0;
 
-      upperTheta = 1.0e50;
+      upperTheta = FloatConst::OneE50;
 
       spare = array[iFlip];
       index = indices[iFlip];
@@ -4123,7 +4129,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
       // 3 bias by all - tolerance
 #define TRYBIAS 3
 
-      FloatT increaseInThis = 0.0; //objective increase in this loop
+      FloatT increaseInThis = FloatConst::Zero; //objective increase in this loop
 
       for (i = 0; i < interesting[iFlip]; i++) {
         int iSequence = index[i];
@@ -4131,13 +4137,13 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
         FloatT oldValue = dj_[iSequence];
         FloatT value = oldValue - tentativeTheta * alpha;
 
-        if (alpha < 0.0) {
+        if (alpha < FloatConst::Zero) {
           //at upper bound
           if (value > newTolerance) {
             FloatT range = upper_[iSequence] - lower_[iSequence];
             thruThis -= range * alpha;
 #if TRYBIAS == 1
-            if (oldValue > 0.0)
+            if (oldValue > FloatConst::Zero)
               increaseInThis -= oldValue * range;
 #elif TRYBIAS == 2
             increaseInThis -= oldValue * range;
@@ -4165,7 +4171,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
             thruThis += range * alpha;
             //?? is this correct - and should we look at good ones
 #if TRYBIAS == 1
-            if (oldValue < 0.0)
+            if (oldValue < FloatConst::Zero)
               increaseInThis += oldValue * range;
 #elif TRYBIAS == 2
             increaseInThis += oldValue * range;
@@ -4195,8 +4201,8 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
 
       FloatT check = CoinAbs(totalThru + thruThis);
       // add a bit
-      check += 1.0e-8 + 1.0e-10 * check;
-      if (check >= CoinAbs(dualOut_) || increaseInObjective + increaseInThis < 0.0) {
+      check += FloatConst::OneEm8 + 1.0e-10 * check;
+      if (check >= CoinAbs(dualOut_) || increaseInObjective + increaseInThis < FloatConst::Zero) {
         // We should be pivoting in this batch
         // so compress down to this lot
         numberRemaining = 0;
@@ -4210,13 +4216,13 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
         // first get ratio with tolerance
         for (iTry = 0; iTry < MAXTRY; iTry++) {
 
-          upperTheta = 1.0e50;
+          upperTheta = FloatConst::OneE50;
           numberPossiblySwapped = numberColumns_;
           numberRemaining = 0;
 
-          increaseInThis = 0.0; //objective increase in this loop
+          increaseInThis = FloatConst::Zero; //objective increase in this loop
 
-          thruThis = 0.0;
+          thruThis = FloatConst::Zero;
 
           spare = array[iFlip];
           index = indices[iFlip];
@@ -4228,7 +4234,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
             FloatT oldValue = dj_[iSequence];
             FloatT value = oldValue - upperTheta * alpha;
 
-            if (alpha < 0.0) {
+            if (alpha < FloatConst::Zero) {
               //at upper bound
               if (value > newTolerance) {
                 if (-alpha >= acceptablePivot) {
@@ -4254,7 +4260,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
           //printf("XX it %d number %d\n",numberIterations_,interesting[iFlip]);
           // Sum of bad small pivots
 #ifdef MORE_CAREFUL
-          FloatT sumBadPivots = 0.0;
+          FloatT sumBadPivots = FloatConst::Zero;
           badSumPivots = false;
 #endif
           // Make sure upperTheta will work (-O2 and above gives problems)
@@ -4263,13 +4269,13 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
             int iSequence = index[i];
             FloatT alpha = spare[i];
             FloatT value = dj_[iSequence] - upperTheta * alpha;
-            FloatT badDj = 0.0;
+            FloatT badDj = FloatConst::Zero;
 
             bool addToSwapped = false;
 
-            if (alpha < 0.0) {
+            if (alpha < FloatConst::Zero) {
               //at upper bound
-              if (value >= 0.0) {
+              if (value >= FloatConst::Zero) {
                 addToSwapped = true;
 #if TRYBIAS == 1
                 badDj = -CoinMax(dj_[iSequence], 0.0);
@@ -4281,7 +4287,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
               }
             } else {
               // at lower bound
-              if (value <= 0.0) {
+              if (value <= FloatConst::Zero) {
                 addToSwapped = true;
 #if TRYBIAS == 1
                 badDj = CoinMin(dj_[iSequence], 0.0);
@@ -4310,7 +4316,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
                 weight = dubiousWeights[iSequence];
               else
                 weight = 1.0;
-              weight += randomNumberGenerator_.randomDouble() * 1.0e-2;
+              weight += randomNumberGenerator_.randomDouble() * FloatConst::OneEm2;
               if (absAlpha > 2.0 * bestPivot) {
                 take = true;
               } else if (absAlpha > largestPivot) {
@@ -4324,7 +4330,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
 #endif
 #ifdef MORE_CAREFUL
               if (absAlpha < acceptablePivot && upperTheta < TOO_BIG_FLOAT) {
-                if (alpha < 0.0) {
+                if (alpha < FloatConst::Zero) {
                   //at upper bound
                   if (value > dualTolerance_) {
                     FloatT gap = upper_[iSequence] - lower_[iSequence];
@@ -4359,7 +4365,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
                 sequenceIn_ = numberPossiblySwapped;
                 bestPivot = absAlpha;
                 theta_ = dj_[iSequence] / alpha;
-                largestPivot = CoinMax(largestPivot, 0.5 * bestPivot);
+                largestPivot = CoinMax(largestPivot, FloatConst::Half * bestPivot);
 #ifdef DUBIOUS_WEIGHTS
                 bestWeight = weight;
 #endif
@@ -4392,19 +4398,19 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
           // If we stop now this will be increase in objective (I think)
           FloatT increase = (CoinAbs(dualOut_) - totalThru) * theta_;
           increase += increaseInObjective;
-          if (theta_ < 0.0)
+          if (theta_ < FloatConst::Zero)
             thruThis += CoinAbs(dualOut_); // force using this one
-          if (increaseInObjective < 0.0 && increase < 0.0 && lastSequence >= 0) {
+          if (increaseInObjective < FloatConst::Zero && increase < FloatConst::Zero && lastSequence >= 0) {
             // back
             // We may need to be more careful - we could do by
             // switch so we always do fine grained?
-            bestPivot = 0.0;
+            bestPivot = FloatConst::Zero;
           } else {
             // add in
             totalThru += thruThis;
             increaseInObjective += increaseInThis;
           }
-          if (bestPivot < 0.1 * bestEverPivot && bestEverPivot > 1.0e-6 && (bestPivot < 1.0e-3 || totalThru * 2.0 > CoinAbs(dualOut_))) {
+          if (bestPivot < 0.1 * bestEverPivot && bestEverPivot > FloatConst::OneEm6 && (bestPivot < FloatConst::OneEm3 || totalThru * 2.0 > CoinAbs(dualOut_))) {
             // back to previous one
             sequenceIn_ = lastSequence;
             // swap regions
@@ -4436,7 +4442,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
         break;
       } else {
         // skip this lot
-        if (bestPivot > 1.0e-3 || bestPivot > bestEverPivot) {
+        if (bestPivot > FloatConst::OneEm3 || bestPivot > bestEverPivot) {
           bestEverPivot = bestPivot;
           lastSequence = bestSequence;
         } else {
@@ -4470,7 +4476,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
     if (upperOut_ > lowerOut_)
       minimumTheta = MINIMUMTHETA;
     else
-      minimumTheta = 0.0;
+      minimumTheta = FloatConst::Zero;
     if (sequenceIn_ >= 0) {
       // at this stage sequenceIn_ is just pointer into index array
       // flip just so we can use iFlip
@@ -4509,7 +4515,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
 
           // can't be free here
 
-          if (alpha < 0.0) {
+          if (alpha < FloatConst::Zero) {
             //at upper bound
             if (value > dualTolerance_) {
               //thisIncrease = true;
@@ -4522,14 +4528,14 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
                 + newTolerance;
               if ((specialOptions_ & (2048 + 4096 + 16384)) != 0) {
                 if ((specialOptions_ & 16384) != 0) {
-                  if (CoinAbs(modification) < 1.0e-8)
-                    modification = 0.0;
+                  if (CoinAbs(modification) < FloatConst::OneEm8)
+                    modification = FloatConst::Zero;
                 } else if ((specialOptions_ & 2048) != 0) {
                   if (CoinAbs(modification) < 1.0e-10)
-                    modification = 0.0;
+                    modification = FloatConst::Zero;
                 } else {
-                  if (CoinAbs(modification) < 1.0e-12)
-                    modification = 0.0;
+                  if (CoinAbs(modification) < FloatConst::OneEm12)
+                    modification = FloatConst::Zero;
                 }
               }
               dj_[iSequence] += modification;
@@ -4552,10 +4558,10 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
               if ((specialOptions_ & (2048 + 4096)) != 0) {
                 if ((specialOptions_ & 2048) != 0) {
                   if (CoinAbs(modification) < 1.0e-10)
-                    modification = 0.0;
+                    modification = FloatConst::Zero;
                 } else {
-                  if (CoinAbs(modification) < 1.0e-12)
-                    modification = 0.0;
+                  if (CoinAbs(modification) < FloatConst::OneEm12)
+                    modification = FloatConst::Zero;
                 }
               }
               dj_[iSequence] += modification;
@@ -4745,27 +4751,27 @@ int ClpSimplexDual::checkUnbounded(CoinIndexedVector *ray,
     changeCost -= cost(iPivot) * array[iRow];
   }
   FloatT way;
-  if (changeCost > 0.0) {
+  if (changeCost > FloatConst::Zero) {
     //try going down
     way = 1.0;
-  } else if (changeCost < 0.0) {
+  } else if (changeCost < FloatConst::Zero) {
     //try going up
     way = -1.0;
   } else {
 #ifdef CLP_DEBUG
     printf("can't decide on up or down\n");
 #endif
-    way = 0.0;
+    way = FloatConst::Zero;
     status = -3;
   }
-  FloatT movement = 1.0e10 * way; // some largish number
+  FloatT movement = FloatConst::OneE10 * way; // some largish number
   FloatT zeroTolerance = 1.0e-14 * dualBound_;
   for (i = 0; i < number; i++) {
     int iRow = index[i];
     int iPivot = pivotVariable_[iRow];
     FloatT arrayValue = array[iRow];
     if (CoinAbs(arrayValue) < zeroTolerance)
-      arrayValue = 0.0;
+      arrayValue = FloatConst::Zero;
     FloatT newValue = solution(iPivot) + movement * arrayValue;
     if (newValue > upper(iPivot) + primalTolerance_ || newValue < lower(iPivot) - primalTolerance_)
       status = -3; // not unbounded
@@ -4802,7 +4808,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
   bool arraysNotCreated = (type == 0);
   // If lots of iterations then adjust costs if large ones
   if (numberIterations_ > 4 * (numberRows_ + numberColumns_) && objectiveScale_ == 1.0) {
-    FloatT largest = 0.0;
+    FloatT largest = FloatConst::Zero;
     for (int i = 0; i < numberRows_; i++) {
       int iColumn = pivotVariable_[i];
       largest = CoinMax(largest, CoinAbs(cost_[iColumn]));
@@ -4814,7 +4820,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     }
   }
   int numberPivots = factorization_->pivots();
-  FloatT realDualInfeasibilities = 0.0;
+  FloatT realDualInfeasibilities = FloatConst::Zero;
   if (type == 2) {
     if (alphaAccuracy_ != -1.0)
       alphaAccuracy_ = -2.0;
@@ -4842,7 +4848,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     type = 1;
     dontFactorizePivots = 1;
   }
-  if (alphaAccuracy_ < 0.0 || !numberPivots || alphaAccuracy_ > 1.0e4 || numberPivots > 20) {
+  if (alphaAccuracy_ < FloatConst::Zero || !numberPivots || alphaAccuracy_ > 1.0e4 || numberPivots > 20) {
     if (problemStatus_ > -3 || numberPivots > dontFactorizePivots) {
       // factorize
       // later on we will need to recover from singularities
@@ -4927,11 +4933,11 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     //if ((count_alpha%5000)==0)
     //printf("count alpha %d\n",count_alpha);
   }
-  if (progress_.infeasibility_[0] < 1.0e-1 && primalTolerance_ == 1.0e-7 && progress_.iterationNumber_[0] > 0 && progress_.iterationNumber_[CLP_PROGRESS - 1] - progress_.iterationNumber_[0] > 25) {
+  if (progress_.infeasibility_[0] < 1.0e-1 && primalTolerance_ == FloatConst::OneEm7 && progress_.iterationNumber_[0] > 0 && progress_.iterationNumber_[CLP_PROGRESS - 1] - progress_.iterationNumber_[0] > 25) {
     // default - so user did not set
     int iP;
     FloatT minAverage = COIN_DBL_MAX;
-    FloatT maxAverage = 0.0;
+    FloatT maxAverage = FloatConst::Zero;
     for (iP = 0; iP < CLP_PROGRESS; iP++) {
       int n = progress_.numberInfeasibilities_[iP];
       if (!n) {
@@ -4945,14 +4951,14 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
         maxAverage = CoinMax(maxAverage, average);
       }
     }
-    if (iP == CLP_PROGRESS && minAverage < 1.0e-5 && maxAverage < 1.0e-3) {
+    if (iP == CLP_PROGRESS && minAverage < FloatConst::OneEm5 && maxAverage < FloatConst::OneEm3) {
       // change tolerance
 #if CBC_USEFUL_PRINTING > 0
       printf("CCchanging tolerance\n");
 #endif
-      primalTolerance_ = 1.0e-6;
+      primalTolerance_ = FloatConst::OneEm6;
       minimumPrimalTolerance_ = primalTolerance_;
-      dblParam_[ClpPrimalTolerance] = 1.0e-6;
+      dblParam_[ClpPrimalTolerance] = FloatConst::OneEm6;
       moreSpecialOptions_ |= 4194304;
     }
   }
@@ -4963,7 +4969,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
           int numberTotal = numberRows_ + numberColumns_;
           FloatT * saveSol = CoinCopyOfArray(solution_, numberTotal);
           FloatT * saveDj = CoinCopyOfArray(dj_, numberTotal);
-          FloatT tolerance = type ? 1.0e-4 : 1.0e-8;
+          FloatT tolerance = type ? FloatConst::OneEm4 : FloatConst::OneEm8;
           // always if values pass
           FloatT saveObj = objectiveValue_;
           FloatT sumPrimal = sumPrimalInfeasibilities_;
@@ -4991,11 +4997,11 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
                }
           }
           if (!type) {
-               if (CoinAbs(saveObj - objectiveValue_) > 1.0e-5 ||
+               if (CoinAbs(saveObj - objectiveValue_) > FloatConst::OneEm5 ||
                          numberPrimal != numberPrimalInfeasibilities_ || numberPrimal != 1 ||
-                         CoinAbs(sumPrimal - sumPrimalInfeasibilities_) > 1.0e-5 || iPrimal >= 0 ||
+                         CoinAbs(sumPrimal - sumPrimalInfeasibilities_) > FloatConst::OneEm5 || iPrimal >= 0 ||
                          numberDual != numberDualInfeasibilities_ || numberDual != 0 ||
-                         CoinAbs(sumDual - sumDualInfeasibilities_) > 1.0e-5 || iDual >= 0)
+                         CoinAbs(sumDual - sumDualInfeasibilities_) > FloatConst::OneEm5 || iDual >= 0)
                     printf("type %d its %d pivots %d primal n(%d,%d) s(%g,%g) diff(%g,%d) dual n(%d,%d) s(%g,%g) diff(%g,%d) obj(%g,%g)\n",
                            type, numberIterations_, numberPivots,
                            numberPrimal, numberPrimalInfeasibilities_, sumPrimal, sumPrimalInfeasibilities_,
@@ -5004,7 +5010,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
                            largestDual, iDual,
                            saveObj, objectiveValue_);
           } else {
-               if (CoinAbs(saveObj - objectiveValue_) > 1.0e-5 ||
+               if (CoinAbs(saveObj - objectiveValue_) > FloatConst::OneEm5 ||
                          numberPrimalInfeasibilities_ || iPrimal >= 0 ||
                          numberDualInfeasibilities_ || iDual >= 0)
                     printf("type %d its %d pivots %d primal n(%d,%d) s(%g,%g) diff(%g,%d) dual n(%d,%d) s(%g,%g) diff(%g,%d) obj(%g,%g)\n",
@@ -5120,7 +5126,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
   if (progress_.lastIterationNumber(0) == numberIterations_) {
     if (dualRowPivot_->looksOptimal()) {
       numberPrimalInfeasibilities_ = 0;
-      sumPrimalInfeasibilities_ = 0.0;
+      sumPrimalInfeasibilities_ = FloatConst::Zero;
     }
 #if 1
   } else {
@@ -5277,7 +5283,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
 #endif
           problemStatus_ = 3;
         }
-      } else if (lastObj < thisObj - 1.0e-5 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj)) - 1.0e-3) {
+      } else if (lastObj < thisObj - FloatConst::OneEm5 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj)) - FloatConst::OneEm3) {
         numberTimesOptimal_ = 0;
       }
     }
@@ -5315,7 +5321,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     if (!problemStatus_) {
       // declaring victory
       numberPrimalInfeasibilities_ = 0;
-      sumPrimalInfeasibilities_ = 0.0;
+      sumPrimalInfeasibilities_ = FloatConst::Zero;
     } else {
       problemStatus_ = 10; // instead - try other algorithm
 #if COIN_DEVELOP > 2
@@ -5348,9 +5354,9 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
   if (handler_->detail(CLP_SIMPLEX_STATUS, messages_) < 100) {
     handler_->message(CLP_SIMPLEX_STATUS, messages_)
       << numberIterations_ << objectiveValue();
-    handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+    handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
       << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-    handler_->printing(sumDualInfeasibilities_ > 0.0)
+    handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
       << sumDualInfeasibilities_ << numberDualInfeasibilities_;
     handler_->printing(numberDualInfeasibilitiesWithoutFree_
       < numberDualInfeasibilities_)
@@ -5360,7 +5366,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
 #if 0
      count_status++;
      if (!numberIterations_)
-       obj_status=-1.0e30;
+       obj_status=-FloatConst::OneE30;
      if (objectiveValue()<obj_status-0.01) {
        printf("Backward obj at %d from %g to %g\n",
 	      count_status,obj_status,objectiveValue());
@@ -5423,12 +5429,12 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
       doOriginalTolerance = 1;
     // check optimal
     // give code benefit of doubt
-    if (sumOfRelaxedDualInfeasibilities_ == 0.0 && sumOfRelaxedPrimalInfeasibilities_ == 0.0) {
+    if (sumOfRelaxedDualInfeasibilities_ == FloatConst::Zero && sumOfRelaxedPrimalInfeasibilities_ == FloatConst::Zero) {
       // say optimal (with these bounds etc)
       numberDualInfeasibilities_ = 0;
-      sumDualInfeasibilities_ = 0.0;
+      sumDualInfeasibilities_ = FloatConst::Zero;
       numberPrimalInfeasibilities_ = 0;
-      sumPrimalInfeasibilities_ = 0.0;
+      sumPrimalInfeasibilities_ = FloatConst::Zero;
     }
     //if (dualFeasible()||problemStatus_==-4||(primalFeasible()&&!numberDualInfeasibilitiesWithoutFree_)) {
     if (dualFeasible() || problemStatus_ == -4) {
@@ -5441,11 +5447,11 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
           sumDualInfeasibilities_ * dualBound_);
 #endif
       // see if cutoff reached
-      FloatT limit = 0.0;
+      FloatT limit = FloatConst::Zero;
       getDblParam(ClpDualObjectiveLimit, limit);
 #if 0
-               if(CoinAbs(limit) < 1.0e30 && objectiveValue()*optimizationDirection_ >
-                         limit + 1.0e-7 + 1.0e-8 * CoinAbs(limit) && !numberAtFakeBound()) {
+               if(CoinAbs(limit) < FloatConst::OneE30 && objectiveValue()*optimizationDirection_ >
+                         limit + FloatConst::OneEm7 + FloatConst::OneEm8 * CoinAbs(limit) && !numberAtFakeBound()) {
                     //looks infeasible on objective
                     if (perturbation_ == 101) {
                          cleanDuals = 1;
@@ -5459,7 +5465,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
                          computeDuals(givenDuals);
                          checkDualSolution();
                          if(objectiveValue()*optimizationDirection_ >
-                                   limit + 1.0e-7 + 1.0e-8 * CoinAbs(limit) && !numberDualInfeasibilities_) {
+                                   limit + FloatConst::OneEm7 + FloatConst::OneEm8 * CoinAbs(limit) && !numberDualInfeasibilities_) {
                               perturbation_ = 102; // stop any perturbations
                               printf("cutoff test succeeded\n");
                          } else {
@@ -5591,7 +5597,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
               sequenceIn_ = iSave;
               // if dual infeasibilities then must be free vector so add in dual
               if (numberDualInfeasibilities_) {
-                if (CoinAbs(changeCost) > 1.0e-5)
+                if (CoinAbs(changeCost) > FloatConst::OneEm5)
                   COIN_DETAIL_PRINT(printf("Odd free/unbounded combo\n"));
                 changeCost += cost_[iChosen];
               }
@@ -5645,7 +5651,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
           createRim4(false);
           progress_.modifyObjective(-COIN_DBL_MAX);
         }
-        if ((numberChangedBounds <= 0 || dualBound_ > TOO_BIG_FLOAT || (largestPrimalError_ > 1.0 && dualBound_ > 1.0e17)) && (numberPivots < 4 || sumPrimalInfeasibilities_ > 1.0e-6)) {
+        if ((numberChangedBounds <= 0 || dualBound_ > TOO_BIG_FLOAT || (largestPrimalError_ > 1.0 && dualBound_ > 1.0e17)) && (numberPivots < 4 || sumPrimalInfeasibilities_ > FloatConst::OneEm6)) {
           problemStatus_ = 1; // infeasible
           if (perturbation_ == 101) {
             perturbation_ = 102; // stop any perturbations
@@ -5769,7 +5775,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
         // look at all rows and columns
         rowArray_[0]->clear();
         columnArray_[0]->clear();
-        FloatT objectiveChange = 0.0;
+        FloatT objectiveChange = FloatConst::Zero;
         FloatT savePrimalInfeasibilities = sumPrimalInfeasibilities_;
         if (!numberIterations_) {
           int nTotal = numberRows_ + numberColumns_;
@@ -5800,7 +5806,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
                     CoinMemcpyN(solution_, (numberRows_ + numberColumns_), xsolution);
 #endif
         if (givenDuals)
-          dualTolerance_ = 1.0e50;
+          dualTolerance_ = FloatConst::OneE50;
 #if CLP_CAN_HAVE_ZERO_OBJ > 1
         if ((specialOptions_ & 16777216) == 0) {
 #endif
@@ -5842,7 +5848,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
         // for now - recompute all
         gutsOfSolution(NULL, NULL);
         if (givenDuals)
-          dualTolerance_ = 1.0e50;
+          dualTolerance_ = FloatConst::OneE50;
 #if CLP_CAN_HAVE_ZERO_OBJ > 1
         if ((specialOptions_ & 16777216) == 0) {
 #endif
@@ -5943,11 +5949,11 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
   }
   if (problemStatus_ < 0) {
     if (needCleanFake) {
-      FloatT dummyChangeCost = 0.0;
+      FloatT dummyChangeCost = FloatConst::Zero;
       changeBounds(3, NULL, dummyChangeCost);
     }
 #if 0
-          if (objectiveValue_ < lastObjectiveValue_ - 1.0e-8 *
+          if (objectiveValue_ < lastObjectiveValue_ - FloatConst::OneEm8 *
                     CoinMax(CoinAbs(objectivevalue_), CoinAbs(lastObjectiveValue_))) {
           } else {
                lastObjectiveValue_ = objectiveValue_;
@@ -5986,18 +5992,18 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     }
   }
   // see if cutoff reached
-  FloatT limit = 0.0;
+  FloatT limit = FloatConst::Zero;
   getDblParam(ClpDualObjectiveLimit, limit);
 #if 0
-     if(CoinAbs(limit) < 1.0e30 && objectiveValue()*optimizationDirection_ >
+     if(CoinAbs(limit) < FloatConst::OneE30 && objectiveValue()*optimizationDirection_ >
                limit + 100.0) {
           printf("lim %g obj %g %g - wo perturb %g sum dual %g\n",
                  limit, objectiveValue_, objectiveValue(), computeInternalObjectiveValue(), sumDualInfeasibilities_);
      }
 #endif
-  if (CoinAbs(limit) < 1.0e30 && objectiveValue() * optimizationDirection_ > limit && !numberAtFakeBound()) {
+  if (CoinAbs(limit) < FloatConst::OneE30 && objectiveValue() * optimizationDirection_ > limit && !numberAtFakeBound()) {
     bool looksInfeasible = !numberDualInfeasibilities_;
-    if (objectiveValue() * optimizationDirection_ > limit + CoinAbs(0.1 * limit) + 1.0e2 * sumDualInfeasibilities_ + 1.0e4 && sumDualInfeasibilities_ < largestDualError_ && numberIterations_ > 0.5 * numberRows_ + 1000)
+    if (objectiveValue() * optimizationDirection_ > limit + CoinAbs(0.1 * limit) + 1.0e2 * sumDualInfeasibilities_ + 1.0e4 && sumDualInfeasibilities_ < largestDualError_ && numberIterations_ > FloatConst::Half * numberRows_ + 1000)
       looksInfeasible = true;
     if (looksInfeasible) {
       // Even if not perturbed internal costs may have changed
@@ -6018,7 +6024,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     int looksBad = 0;
     if (largestPrimalError_ * largestDualError_ > 1.0e2) {
       looksBad = 1;
-    } else if (largestPrimalError_ > 1.0e-2
+    } else if (largestPrimalError_ > FloatConst::OneEm2
       && objectiveValue_ > CoinMin(1.0e15, 1.0e3 * limit)) {
       looksBad = 2;
     }
@@ -6034,9 +6040,9 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
       } else if (largestPrimalError_ > 1.0e5) {
         {
           //int iBigB = -1;
-          FloatT bigB = 0.0;
+          FloatT bigB = FloatConst::Zero;
           //int iBigN = -1;
-          FloatT bigN = 0.0;
+          FloatT bigN = FloatConst::Zero;
           for (int i = 0; i < numberRows_ + numberColumns_; i++) {
             FloatT value = CoinAbs(solution_[i]);
             if (getStatus(i) == basic) {
@@ -6084,7 +6090,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     printf("objectiveValue_ %g\n", objectiveValue_);
     handler_->setLogLevel(63);
     int nTotal = numberColumns_ + numberRows_;
-    FloatT newObj = 0.0;
+    FloatT newObj = FloatConst::Zero;
     for (int i = 0; i < nTotal; i++) {
       if (solution_[i])
         newObj += solution_[i] * cost_[i];
@@ -6092,7 +6098,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
     printf("xxx obj %g\n", newObj);
     // for now - recompute all
     gutsOfSolution(NULL, NULL);
-    newObj = 0.0;
+    newObj = FloatConst::Zero;
     for (int i = 0; i < nTotal; i++) {
       if (solution_[i])
         newObj += solution_[i] * cost_[i];
@@ -6105,7 +6111,7 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
 #if 1
   FloatT thisObj = progress_.lastObjective(0);
   FloatT lastObj = progress_.lastObjective(1);
-  if (lastObj > thisObj + 1.0e-4 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj)) + 1.0e-4
+  if (lastObj > thisObj + FloatConst::OneEm4 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj)) + FloatConst::OneEm4
     && givenDuals == NULL && firstFree_ < 0) {
     int maxFactor = factorization_->maximumPivots();
     if (maxFactor > 10) {
@@ -6119,13 +6125,13 @@ void ClpSimplexDual::statusOfProblemInDual(int &lastCleaned, int type,
   // Allow matrices to be sorted etc
   int fake = -999; // signal sort
   matrix_->correctSequence(this, fake, fake);
-  if (alphaAccuracy_ > 0.0)
+  if (alphaAccuracy_ > FloatConst::Zero)
     alphaAccuracy_ = 1.0;
   // If we are stopping - use plausible objective
   // Maybe only in fast dual
   if (problemStatus_ > 2)
     objectiveValue_ = approximateObjective;
-  if (problemStatus_ == 1 && (progressFlag_ & 8) != 0 && CoinAbs(objectiveValue_) > 1.0e10)
+  if (problemStatus_ == 1 && (progressFlag_ & 8) != 0 && CoinAbs(objectiveValue_) > FloatConst::OneE10)
     problemStatus_ = 10; // infeasible - but has looked feasible
 }
 /* While updateDualsInDual sees what effect is of flip
@@ -6201,14 +6207,14 @@ void ClpSimplexDual::originalBound(int iSequence)
       rowLowerWork_[iRow] = rowLower_[iRow];
       rowUpperWork_[iRow] = rowUpper_[iRow];
       if (rowScale_) {
-        if (rowLowerWork_[iRow] > -1.0e50)
+        if (rowLowerWork_[iRow] > -FloatConst::OneE50)
           rowLowerWork_[iRow] *= rowScale_[iRow] * rhsScale_;
-        if (rowUpperWork_[iRow] < 1.0e50)
+        if (rowUpperWork_[iRow] < FloatConst::OneE50)
           rowUpperWork_[iRow] *= rowScale_[iRow] * rhsScale_;
       } else if (rhsScale_ != 1.0) {
-        if (rowLowerWork_[iRow] > -1.0e50)
+        if (rowLowerWork_[iRow] > -FloatConst::OneE50)
           rowLowerWork_[iRow] *= rhsScale_;
-        if (rowUpperWork_[iRow] < 1.0e50)
+        if (rowUpperWork_[iRow] < FloatConst::OneE50)
           rowUpperWork_[iRow] *= rhsScale_;
       }
     } else {
@@ -6217,14 +6223,14 @@ void ClpSimplexDual::originalBound(int iSequence)
       columnUpperWork_[iSequence] = columnUpper_[iSequence];
       if (rowScale_) {
         FloatT multiplier = 1.0 * inverseColumnScale_[iSequence];
-        if (columnLowerWork_[iSequence] > -1.0e50)
+        if (columnLowerWork_[iSequence] > -FloatConst::OneE50)
           columnLowerWork_[iSequence] *= multiplier * rhsScale_;
-        if (columnUpperWork_[iSequence] < 1.0e50)
+        if (columnUpperWork_[iSequence] < FloatConst::OneE50)
           columnUpperWork_[iSequence] *= multiplier * rhsScale_;
       } else if (rhsScale_ != 1.0) {
-        if (columnLowerWork_[iSequence] > -1.0e50)
+        if (columnLowerWork_[iSequence] > -FloatConst::OneE50)
           columnLowerWork_[iSequence] *= rhsScale_;
-        if (columnUpperWork_[iSequence] < 1.0e50)
+        if (columnUpperWork_[iSequence] < FloatConst::OneE50)
           columnUpperWork_[iSequence] *= rhsScale_;
       }
     }
@@ -6278,9 +6284,9 @@ static void breakdown(const char *name, int numberLook, const FloatT *region)
     -COIN_DBL_MAX,
     -1.0e15, -1.0e11, -1.0e8, -1.0e5, -1.0e4, -1.0e3, -1.0e2, -1.0e1,
     -1.0,
-    -1.0e-1, -1.0e-2, -1.0e-3, -1.0e-4, -1.0e-5, -1.0e-8, -1.0e-11, -1.0e-15,
+    -1.0e-1, -FloatConst::OneEm2, -FloatConst::OneEm3, -FloatConst::OneEm4, -FloatConst::OneEm5, -FloatConst::OneEm8, -1.0e-11, -1.0e-15,
     0.0,
-    1.0e-15, 1.0e-11, 1.0e-8, 1.0e-5, 1.0e-4, 1.0e-3, 1.0e-2, 1.0e-1,
+    1.0e-15, 1.0e-11, FloatConst::OneEm8, FloatConst::OneEm5, FloatConst::OneEm4, FloatConst::OneEm3, FloatConst::OneEm2, 1.0e-1,
     1.0,
     1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e8, 1.0e11, 1.0e15,
     COIN_DBL_MAX
@@ -6331,11 +6337,11 @@ int ClpSimplexDual::perturb()
   // dual perturbation
   FloatT perturbation = 1.0e-20;
   // maximum fraction of cost to perturb
-  FloatT maximumFraction = 1.0e-5;
+  FloatT maximumFraction = FloatConst::OneEm5;
   FloatT constantPerturbation = 100.0 * dualTolerance_;
   int maxLength = 0;
   int minLength = numberRows_;
-  FloatT averageCost = 0.0;
+  FloatT averageCost = FloatConst::Zero;
 #if 0
      // look at element range
      FloatT smallestNegative;
@@ -6416,7 +6422,7 @@ int ClpSimplexDual::perturb()
   if (perturbation_ > 50) {
     // Experiment
     // maximumFraction could be 1.0e-10 to 1.0
-    FloatT m[] = { 1.0e-10, 1.0e-9, 1.0e-8, 1.0e-7, 1.0e-6, 1.0e-5, 1.0e-4, 1.0e-3, 1.0e-2, 1.0e-1, 1.0 };
+    FloatT m[] = { 1.0e-10, 1.0e-9, FloatConst::OneEm8, FloatConst::OneEm7, FloatConst::OneEm6, FloatConst::OneEm5, FloatConst::OneEm4, FloatConst::OneEm3, FloatConst::OneEm2, 1.0e-1, 1.0 };
     int whichOne = perturbation_ - 51;
     //if (inCbcOrOther&&whichOne>0)
     //whichOne--;
@@ -6425,14 +6431,14 @@ int ClpSimplexDual::perturb()
     //maximumFraction = 1.0e-6;
   }
   int iRow;
-  FloatT smallestNonZero = 1.0e100;
+  FloatT smallestNonZero = FloatConst::OneE100;
   numberNonZero = 0;
   if (perturbation_ >= 50) {
-    perturbation = 1.0e-8;
+    perturbation = FloatConst::OneEm8;
     if (perturbation_ > 50 && perturbation_ < 60)
-      perturbation = CoinMax(1.0e-8, maximumFraction);
+      perturbation = CoinMax(FloatConst::OneEm8, maximumFraction);
     bool allSame = true;
-    FloatT lastValue = 0.0;
+    FloatT lastValue = FloatConst::Zero;
     for (iRow = 0; iRow < numberRows_; iRow++) {
       FloatT lo = rowLowerWork_[iRow];
       FloatT up = rowUpperWork_[iRow];
@@ -6444,24 +6450,24 @@ int ClpSimplexDual::perturb()
           smallestNonZero = CoinMin(smallestNonZero, value);
         }
       }
-      if (lo && lo > -1.0e10) {
+      if (lo && lo > -FloatConst::OneE10) {
         numberNonZero++;
         lo = CoinAbs(lo);
         if (!lastValue)
           lastValue = lo;
-        else if (CoinAbs(lo - lastValue) > 1.0e-7)
+        else if (CoinAbs(lo - lastValue) > FloatConst::OneEm7)
           allSame = false;
       }
-      if (up && up < 1.0e10) {
+      if (up && up < FloatConst::OneE10) {
         numberNonZero++;
         up = CoinAbs(up);
         if (!lastValue)
           lastValue = up;
-        else if (CoinAbs(up - lastValue) > 1.0e-7)
+        else if (CoinAbs(up - lastValue) > FloatConst::OneEm7)
           allSame = false;
       }
     }
-    FloatT lastValue2 = 0.0;
+    FloatT lastValue2 = FloatConst::Zero;
     for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
       FloatT lo = columnLowerWork_[iColumn];
       FloatT up = columnUpperWork_[iColumn];
@@ -6472,20 +6478,20 @@ int ClpSimplexDual::perturb()
           smallestNonZero = CoinMin(smallestNonZero, value);
         }
       }
-      if (lo && lo > -1.0e10) {
+      if (lo && lo > -FloatConst::OneE10) {
         //numberNonZero++;
         lo = CoinAbs(lo);
         if (!lastValue2)
           lastValue2 = lo;
-        else if (CoinAbs(lo - lastValue2) > 1.0e-7)
+        else if (CoinAbs(lo - lastValue2) > FloatConst::OneEm7)
           allSame = false;
       }
-      if (up && up < 1.0e10) {
+      if (up && up < FloatConst::OneE10) {
         //numberNonZero++;
         up = CoinAbs(up);
         if (!lastValue2)
           lastValue2 = up;
-        else if (CoinAbs(up - lastValue2) > 1.0e-7)
+        else if (CoinAbs(up - lastValue2) > FloatConst::OneEm7)
           allSame = false;
       }
     }
@@ -6499,7 +6505,7 @@ int ClpSimplexDual::perturb()
         smallestPositive, largestPositive);
       if (smallestNegative == largestNegative && smallestPositive == largestPositive) {
         // Really hit perturbation
-        FloatT adjust = CoinMin(100.0 * maximumFraction, 1.0e-3 * CoinMax(lastValue, lastValue2));
+        FloatT adjust = CoinMin(100.0 * maximumFraction, FloatConst::OneEm3 * CoinMax(lastValue, lastValue2));
         maximumFraction = CoinMax(adjust, maximumFraction);
       }
     }
@@ -6527,9 +6533,9 @@ int ClpSimplexDual::perturb()
     }
     perturbation = pow(10.0, perturbation_);
   }
-  FloatT largestZero = 0.0;
-  FloatT largest = 0.0;
-  FloatT largestPerCent = 0.0;
+  FloatT largestZero = FloatConst::Zero;
+  FloatT largest = FloatConst::Zero;
+  FloatT largestPerCent = FloatConst::Zero;
   // modify costs
   bool printOut = (handler_->logLevel() == 63);
   printOut = false;
@@ -6540,7 +6546,7 @@ int ClpSimplexDual::perturb()
       if (rowLowerWork_[iRow] < rowUpperWork_[iRow]) {
         FloatT value = perturbation;
         FloatT currentValue = rowObjectiveWork_[iRow];
-        value = CoinMin(value, maximumFraction * (CoinAbs(currentValue) + 1.0e-1 * perturbation + 1.0e-3));
+        value = CoinMin(value, maximumFraction * (CoinAbs(currentValue) + 1.0e-1 * perturbation + FloatConst::OneEm3));
         if (rowLowerWork_[iRow] > -largeValue_) {
           if (CoinAbs(rowLowerWork_[iRow]) < CoinAbs(rowUpperWork_[iRow]))
             value *= randomNumberGenerator_.randomDouble();
@@ -6549,7 +6555,7 @@ int ClpSimplexDual::perturb()
         } else if (rowUpperWork_[iRow] < largeValue_) {
           value *= -randomNumberGenerator_.randomDouble();
         } else {
-          value = 0.0;
+          value = FloatConst::Zero;
         }
         if (currentValue) {
           largest = CoinMax(largest, CoinAbs(value));
@@ -6566,11 +6572,11 @@ int ClpSimplexDual::perturb()
   }
   // more its but faster FloatT weight[]={1.0e-4,1.0e-2,1.0e-1,1.0,2.0,10.0,100.0,200.0,400.0,600.0,1000.0};
   // good its FloatT weight[]={1.0e-4,1.0e-2,5.0e-1,1.0,2.0,5.0,10.0,20.0,30.0,40.0,100.0};
-  FloatT weight[] = { 1.0e-4, 1.0e-2, 5.0e-1, 1.0, 2.0, 5.0, 10.0, 20.0, 30.0, 40.0, 100.0 };
+  FloatT weight[] = { FloatConst::OneEm4, FloatConst::OneEm2, 5.0e-1, 1.0, 2.0, 5.0, 10.0, 20.0, 30.0, 40.0, 100.0 };
   //FloatT weight[]={1.0e-4,1.0e-2,5.0e-1,1.0,20.0,50.0,100.0,120.0,130.0,140.0,200.0};
   //FloatT extraWeight = 10.0;
   // Scale back if wanted
-  FloatT weight2[] = { 1.0e-4, 1.0e-2, 5.0e-1, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+  FloatT weight2[] = { FloatConst::OneEm4, FloatConst::OneEm2, 5.0e-1, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
   if (constantPerturbation < 99.0 * dualTolerance_) {
     perturbation *= 0.1;
     //extraWeight = 0.5;
@@ -6583,7 +6589,7 @@ int ClpSimplexDual::perturb()
   }
   // Make variables with more elements more expensive
   const FloatT m1 = 0.5;
-  FloatT smallestAllowed = CoinMin(1.0e-2 * dualTolerance_, maximumFraction);
+  FloatT smallestAllowed = CoinMin(FloatConst::OneEm2 * dualTolerance_, maximumFraction);
   FloatT largestAllowed = CoinMax(1.0e3 * dualTolerance_, fd(maximumFraction * averageCost));
   // smaller if in BAB
   //if (inCbcOrOther)
@@ -6604,7 +6610,7 @@ int ClpSimplexDual::perturb()
     if (columnLowerWork_[iColumn] < columnUpperWork_[iColumn] && getStatus(iColumn) != basic) {
       FloatT value = perturbation;
       FloatT currentValue = objectiveWork_[iColumn];
-      value = CoinMin(value, constantPerturbation + maximumFraction * (CoinAbs(currentValue) + 1.0e-1 * perturbation + 1.0e-8));
+      value = CoinMin(value, constantPerturbation + maximumFraction * (CoinAbs(currentValue) + 1.0e-1 * perturbation + FloatConst::OneEm8));
       //value = CoinMin(value,constantPerturbation;+maximumFraction*CoinAbs(currentValue));
       FloatT value2 = constantPerturbation + 1.0e-1 * smallestNonZero;
       if (uniformChange) {
@@ -6623,7 +6629,7 @@ int ClpSimplexDual::perturb()
         } else {
           //value *= -(1.0-m1+m1*randomNumberGenerator_.randomDouble());
           //value2 *= -(1.0-m1+m1*randomNumberGenerator_.randomDouble());
-          value = 0.0;
+          value = FloatConst::Zero;
         }
       } else if (columnUpperWork_[iColumn] < largeValue_) {
 #ifndef SAVE_PERT
@@ -6634,7 +6640,7 @@ int ClpSimplexDual::perturb()
         value2 *= -(1.0 - m1 + m1 * perturbationArray_[2 * iColumn + 1]);
 #endif
       } else {
-        value = 0.0;
+        value = FloatConst::Zero;
       }
       if (value) {
         int length = columnLength[iColumn];
@@ -6653,13 +6659,13 @@ int ClpSimplexDual::perturb()
           multiplier = weight[length];
         else
           multiplier = weight[10] + extraWeight * (length - 10);
-        multiplier *= 0.5;
+        multiplier *= FloatConst::Half;
 #endif
         value *= multiplier;
         value = CoinMin(value, value2);
         if (savePerturbation < 50 || savePerturbation > 60) {
           if (CoinAbs(value) <= dualTolerance_)
-            value = 0.0;
+            value = FloatConst::Zero;
         } else if (value) {
           // get in range
           if (CoinAbs(value) <= smallestAllowed) {
@@ -6691,14 +6697,14 @@ int ClpSimplexDual::perturb()
   if (largestZero > 1.0 * largest && largest) {
     //printf("largest zero perturbation of %g too big (nonzero %g)\n",
     //     largestZero,largest);
-    largestZero = 0.0;
+    largestZero = FloatConst::Zero;
     const FloatT *obj = objective();
-    FloatT test = CoinMax(1.0e-8, largest);
+    FloatT test = CoinMax(FloatConst::OneEm8, largest);
     for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
       if (!obj[iColumn]) {
         FloatT cost = cost_[iColumn];
         while (CoinAbs(cost) > test)
-          cost *= 0.5;
+          cost *= FloatConst::Half;
         cost_[iColumn] = cost;
         largestZero = CoinMax(largestZero, CoinAbs(cost));
       }
@@ -6713,7 +6719,7 @@ int ClpSimplexDual::perturb()
   // say perturbed
 #ifdef PERT_STATISTICS
   {
-    FloatT averageCost = 0.0;
+    FloatT averageCost = FloatConst::Zero;
     int numberNonZero = 0;
     FloatT *COIN_RESTRICT sort = new FloatT[numberColumns_];
     for (int i = 0; i < numberColumns_; i++) {
@@ -6844,7 +6850,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
       upper_[iColumn] = (newUpper[i] * inverseColumnScale_[iColumn]) * rhsScale_; // scale
     // Start of fast iterations
     int status = fastDual(alwaysFinish);
-    CoinAssert(problemStatus_ || objectiveValue_ < 1.0e50);
+    CoinAssert(problemStatus_ || objectiveValue_ < FloatConst::OneE50);
 #ifdef CLP_DEBUG
     printf("first status %d obj %g\n", problemStatus_, objectiveValue_);
 #endif
@@ -6855,7 +6861,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
     if (status && problemStatus_ != 3) {
       // not finished - might be optimal
       checkPrimalSolution(rowActivityWork_, columnActivityWork_);
-      FloatT limit = 0.0;
+      FloatT limit = FloatConst::Zero;
       getDblParam(ClpDualObjectiveLimit, limit);
       if (!numberPrimalInfeasibilities_ && obj < limit) {
         problemStatus_ = 0;
@@ -6867,7 +6873,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
     if (status || (problemStatus_ == 0 && !isDualObjectiveLimitReached())) {
       objectiveChange = obj - saveObjectiveValue;
     } else {
-      objectiveChange = 1.0e100;
+      objectiveChange = FloatConst::OneE100;
       status = 1;
     }
     if (outputSolution) {
@@ -6916,7 +6922,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
       lower_[iColumn] = (newLower[i] * inverseColumnScale_[iColumn]) * rhsScale_; // scale
     // Start of fast iterations
     status = fastDual(alwaysFinish);
-    CoinAssert(problemStatus_ || objectiveValue_ < 1.0e50);
+    CoinAssert(problemStatus_ || objectiveValue_ < FloatConst::OneE50);
 #ifdef CLP_DEBUG
     printf("second status %d obj %g\n", problemStatus_, objectiveValue_);
 #endif
@@ -6927,7 +6933,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
     if (status && problemStatus_ != 3) {
       // not finished - might be optimal
       checkPrimalSolution(rowActivityWork_, columnActivityWork_);
-      FloatT limit = 0.0;
+      FloatT limit = FloatConst::Zero;
       getDblParam(ClpDualObjectiveLimit, limit);
       if (!numberPrimalInfeasibilities_ && obj < limit) {
         problemStatus_ = 0;
@@ -6939,7 +6945,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
     if (status || (problemStatus_ == 0 && !isDualObjectiveLimitReached())) {
       objectiveChange = obj - saveObjectiveValue;
     } else {
-      objectiveChange = 1.0e100;
+      objectiveChange = FloatConst::OneE100;
       status = 1;
     }
     if (outputSolution) {
@@ -6983,8 +6989,8 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
              Neither side feasible - set objective high and exit if desired
              One side feasible - change bounds and resolve
           */
-    if (newUpper[i] < 1.0e100) {
-      if (newLower[i] < 1.0e100) {
+    if (newUpper[i] < FloatConst::OneE100) {
+      if (newLower[i] < FloatConst::OneE100) {
         // feasible - no action
       } else {
         // up feasible, down infeasible
@@ -6993,7 +6999,7 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
           break;
       }
     } else {
-      if (newLower[i] < 1.0e100) {
+      if (newLower[i] < FloatConst::OneE100) {
         // down feasible, up infeasible
         returnCode = 1;
         if (stopOnFirstInfeasible)
@@ -7061,7 +7067,7 @@ int ClpSimplexDual::fastDual(bool alwaysFinish)
           int numberTotal = numberRows_ + numberColumns_;
           FloatT * saveSol = CoinCopyOfArray(solution_, numberTotal);
           FloatT * saveDj = CoinCopyOfArray(dj_, numberTotal);
-          FloatT tolerance = 1.0e-8;
+          FloatT tolerance = FloatConst::OneEm8;
           gutsOfSolution(NULL, NULL);
           int j;
           FloatT largestPrimal = tolerance;
@@ -7171,9 +7177,9 @@ int ClpSimplexDual::fastDual(bool alwaysFinish)
       if (handler_->logLevel() > 2) {
         handler_->message(CLP_SIMPLEX_STATUS, messages_)
           << numberIterations_ << objectiveValue();
-        handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+        handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
           << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-        handler_->printing(sumDualInfeasibilities_ > 0.0)
+        handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
           << sumDualInfeasibilities_ << numberDualInfeasibilities_;
         handler_->printing(numberDualInfeasibilitiesWithoutFree_
           < numberDualInfeasibilities_)
@@ -7255,9 +7261,9 @@ int ClpSimplexDual::fastDual(bool alwaysFinish)
   specialOptions_ &= ~131072;
   if (!problemStatus_) {
     // see if cutoff reached
-    FloatT limit = 0.0;
+    FloatT limit = FloatConst::Zero;
     getDblParam(ClpDualObjectiveLimit, limit);
-    if (CoinAbs(limit) < 1.0e30 && objectiveValue() * optimizationDirection_ > limit + 1.0e-7 + 1.0e-8 * CoinAbs(limit)) {
+    if (CoinAbs(limit) < FloatConst::OneE30 && objectiveValue() * optimizationDirection_ > limit + FloatConst::OneEm7 + FloatConst::OneEm8 * CoinAbs(limit)) {
       // actually infeasible on objective
       problemStatus_ = 1;
       secondaryStatus_ = 1;
@@ -7502,7 +7508,7 @@ int ClpSimplexDual::pivotResultPart1()
     columnScale_ = saveC;
   }
   // do ratio test for normal iteration
-  dualOut_ *= 1.0e-8;
+  dualOut_ *= FloatConst::OneEm8;
   bestPossiblePivot = dualColumn(rowArray_[0], columnArray_[0], rowArray_[3],
 #ifdef LONG_REGION_2
     rowArray_[2],
@@ -7512,7 +7518,7 @@ int ClpSimplexDual::pivotResultPart1()
     acceptablePivot,
     NULL /*dubiousWeights*/);
   dualOut_ *= 1.0e8;
-  if (CoinAbs(bestPossiblePivot) < 1.0e-6)
+  if (CoinAbs(bestPossiblePivot) < FloatConst::OneEm6)
     return -1;
   else
     return 0;
@@ -7542,7 +7548,7 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
   int sequenceUp = sequenceOut_;
 
   FloatT djBasic = dj_[sequenceOut_];
-  if (djBasic > 0.0) {
+  if (djBasic > FloatConst::Zero) {
     // basic at lower bound so directionOut_ 1 and -1 in pivot row
     // dj will go to zero on other way
     thetaUp = djBasic;
@@ -7556,8 +7562,8 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
   bestAlphaUp = 1.0;
   int addSequence;
 
-  FloatT alphaUp = 0.0;
-  FloatT alphaDown = 0.0;
+  FloatT alphaUp = FloatConst::Zero;
+  FloatT alphaDown = FloatConst::Zero;
 
   for (iSection = 0; iSection < 2; iSection++) {
 
@@ -7594,8 +7600,8 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
         alpha = work[i];
         // dj must be effectively zero as dual feasible
         if (CoinAbs(alpha) > bestAlphaUp) {
-          thetaDown = 0.0;
-          thetaUp = 0.0;
+          thetaDown = FloatConst::Zero;
+          thetaUp = FloatConst::Zero;
           bestAlphaDown = CoinAbs(alpha);
           bestAlphaUp = bestAlphaDown;
           sequenceDown = iSequence2;
@@ -7666,7 +7672,7 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
   thetaUp *= -1.0;
   FloatT changeUp = -thetaUp * changeDown;
   changeDown = -thetaDown * changeDown;
-  if (CoinMax(CoinAbs(thetaDown), CoinAbs(thetaUp)) < 1.0e-8) {
+  if (CoinMax(CoinAbs(thetaDown), CoinAbs(thetaUp)) < FloatConst::OneEm8) {
     // largest
     if (CoinAbs(alphaDown) < CoinAbs(alphaUp)) {
       sequenceDown = -1;
@@ -7676,7 +7682,7 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
   sequenceIn_ = -1;
   if (changeDown > changeUp && sequenceDown >= 0) {
     theta_ = thetaDown;
-    if (CoinAbs(changeDown) < 1.0e30)
+    if (CoinAbs(changeDown) < FloatConst::OneE30)
       sequenceIn_ = sequenceDown;
     alpha_ = alphaDown;
 #ifdef CLP_DEBUG
@@ -7686,7 +7692,7 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
 #endif
   } else {
     theta_ = thetaUp;
-    if (CoinAbs(changeUp) < 1.0e30)
+    if (CoinAbs(changeUp) < FloatConst::OneE30)
       sequenceIn_ = sequenceUp;
     alpha_ = alphaUp;
     if (sequenceIn_ != sequenceOut_) {
@@ -7709,7 +7715,7 @@ void ClpSimplexDual::checkPossibleValuesMove(CoinIndexedVector *rowArray,
     valueIn_ = solution_[sequenceIn_];
     dualIn_ = dj_[sequenceIn_];
 
-    if (alpha_ < 0.0) {
+    if (alpha_ < FloatConst::Zero) {
       // as if from upper bound
       directionIn_ = -1;
       upperIn_ = valueIn_;
@@ -7747,11 +7753,11 @@ void ClpSimplexDual::checkPossibleCleanup(CoinIndexedVector *rowArray,
   if (getRowStatus(pivotRow_) == basic)
     djSlack = COIN_DBL_MAX;
   if (CoinAbs(djSlack) < tolerance)
-    djSlack = 0.0;
+    djSlack = FloatConst::Zero;
   int addSequence;
 
-  FloatT alphaUp = 0.0;
-  FloatT alphaDown = 0.0;
+  FloatT alphaUp = FloatConst::Zero;
+  FloatT alphaDown = FloatConst::Zero;
   for (iSection = 0; iSection < 2; iSection++) {
 
     int i;
@@ -7813,8 +7819,8 @@ void ClpSimplexDual::checkPossibleCleanup(CoinIndexedVector *rowArray,
         alpha = work[i];
         // dj must be effectively zero as dual feasible
         if (CoinAbs(alpha) > bestAlphaUp) {
-          thetaDown = 0.0;
-          thetaUp = 0.0;
+          thetaDown = FloatConst::Zero;
+          thetaUp = FloatConst::Zero;
           bestAlphaDown = CoinAbs(alpha);
           bestAlphaUp = bestAlphaDown;
           sequenceDown = iSequence2;
@@ -7914,7 +7920,7 @@ void ClpSimplexDual::checkPossibleCleanup(CoinIndexedVector *rowArray,
     valueIn_ = solution_[sequenceIn_];
     dualIn_ = dj_[sequenceIn_];
 
-    if (alpha_ < 0.0) {
+    if (alpha_ < FloatConst::Zero) {
       // as if from upper bound
       directionIn_ = -1;
       upperIn_ = valueIn_;
@@ -7948,12 +7954,12 @@ void ClpSimplexDual::doEasyOnesInValuesPass(FloatT *dj)
   int iRow;
 #ifdef CLP_DEBUG
   {
-    FloatT value5 = 0.0;
+    FloatT value5 = FloatConst::Zero;
     int i;
     for (i = 0; i < numberRows_ + numberColumns_; i++) {
-      if (dj[i] < -1.0e-6)
+      if (dj[i] < -FloatConst::OneEm6)
         value5 += dj[i] * upper_[i];
-      else if (dj[i] > 1.0e-6)
+      else if (dj[i] > FloatConst::OneEm6)
         value5 += dj[i] * lower_[i];
     }
     printf("Values objective Value before %g\n", value5);
@@ -7971,7 +7977,7 @@ void ClpSimplexDual::doEasyOnesInValuesPass(FloatT *dj)
 
       FloatT changeUp;
       // always -1 in pivot row
-      if (djBasic > 0.0) {
+      if (djBasic > FloatConst::Zero) {
         // basic at lower bound
         changeUp = -lower_[iSequence];
       } else {
@@ -8002,14 +8008,14 @@ void ClpSimplexDual::doEasyOnesInValuesPass(FloatT *dj)
         switch (getStatus(iColumn)) {
 
         case basic:
-          if (dj[iColumn] < -tolerance && CoinAbs(solution_[iColumn] - upper_[iColumn]) < 1.0e-8) {
+          if (dj[iColumn] < -tolerance && CoinAbs(solution_[iColumn] - upper_[iColumn]) < FloatConst::OneEm8) {
             // at ub
             changeUp += alpha * upper_[iColumn];
             // might do other way
             value = oldValue + djBasic * alpha;
             if (value > tolerance)
               canMove = false;
-          } else if (dj[iColumn] > tolerance && CoinAbs(solution_[iColumn] - lower_[iColumn]) < 1.0e-8) {
+          } else if (dj[iColumn] > tolerance && CoinAbs(solution_[iColumn] - lower_[iColumn]) < FloatConst::OneEm8) {
             changeUp += alpha * lower_[iColumn];
             // might do other way
             value = oldValue + djBasic * alpha;
@@ -8043,22 +8049,22 @@ void ClpSimplexDual::doEasyOnesInValuesPass(FloatT *dj)
         }
       }
       if (canMove) {
-        if (changeUp * djBasic > 1.0e-12 || CoinAbs(changeUp) < 1.0e-8) {
+        if (changeUp * djBasic > FloatConst::OneEm12 || CoinAbs(changeUp) < FloatConst::OneEm8) {
           // move
           for (i = 0; i < rowLength[iRow]; i++) {
             int iColumn = thisIndices[i];
             FloatT alpha = thisElements[i];
             dj[iColumn] += djBasic * alpha;
           }
-          dj[iSequence] = 0.0;
+          dj[iSequence] = FloatConst::Zero;
 #ifdef CLP_DEBUG
           {
-            FloatT value5 = 0.0;
+            FloatT value5 = FloatConst::Zero;
             int i;
             for (i = 0; i < numberRows_ + numberColumns_; i++) {
-              if (dj[i] < -1.0e-6)
+              if (dj[i] < -FloatConst::OneEm6)
                 value5 += dj[i] * upper_[i];
-              else if (dj[i] > 1.0e-6)
+              else if (dj[i] > FloatConst::OneEm6)
                 value5 += dj[i] * lower_[i];
             }
             printf("Values objective Value after row %d old dj %g %g\n",
@@ -8094,7 +8100,7 @@ void ClpSimplexDual::resetFakeBounds(int type)
   if (type == 0) {
     // put back original bounds and then check
     createRim1(false);
-    FloatT dummyChangeCost = 0.0;
+    FloatT dummyChangeCost = FloatConst::Zero;
     changeBounds(3, NULL, dummyChangeCost);
   } else if (type < 0) {
 #ifndef NDEBUG
@@ -8108,14 +8114,14 @@ void ClpSimplexDual::resetFakeBounds(int type)
       for (iSequence = 0; iSequence < numberColumns_; iSequence++) {
         // lower
         FloatT value = columnLower_[iSequence];
-        if (value > -1.0e30) {
+        if (value > -FloatConst::OneE30) {
           FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
           value *= multiplier;
         }
         tempLower[iSequence] = value;
         // upper
         value = columnUpper_[iSequence];
-        if (value < 1.0e30) {
+        if (value < FloatConst::OneE30) {
           FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
           value *= multiplier;
         }
@@ -8124,14 +8130,14 @@ void ClpSimplexDual::resetFakeBounds(int type)
       for (iSequence = 0; iSequence < numberRows_; iSequence++) {
         // lower
         FloatT value = rowLower_[iSequence];
-        if (value > -1.0e30) {
+        if (value > -FloatConst::OneE30) {
           FloatT multiplier = rhsScale_ * rowScale_[iSequence];
           value *= multiplier;
         }
         tempLower[iSequence + numberColumns_] = value;
         // upper
         value = rowUpper_[iSequence];
-        if (value < 1.0e30) {
+        if (value < FloatConst::OneE30) {
           FloatT multiplier = rhsScale_ * rowScale_[iSequence];
           value *= multiplier;
         }
@@ -8299,13 +8305,13 @@ void ClpSimplexDual::resetFakeBounds(int type)
         FloatT multiplier = rhsScale_ * inverseColumnScale_[iSequence];
         // lower
         FloatT value = columnLower_[iSequence];
-        if (value > -1.0e30) {
+        if (value > -FloatConst::OneE30) {
           value *= multiplier;
         }
         lower_[iSequence] = value;
         // upper
         value = columnUpper_[iSequence];
-        if (value < 1.0e30) {
+        if (value < FloatConst::OneE30) {
           value *= multiplier;
         }
         upper_[iSequence] = value;
@@ -8314,13 +8320,13 @@ void ClpSimplexDual::resetFakeBounds(int type)
         // lower
         FloatT multiplier = rhsScale_ * rowScale_[iSequence];
         FloatT value = rowLower_[iSequence];
-        if (value > -1.0e30) {
+        if (value > -FloatConst::OneE30) {
           value *= multiplier;
         }
         lower_[iSequence + numberColumns_] = value;
         // upper
         value = rowUpper_[iSequence];
-        if (value < 1.0e30) {
+        if (value < FloatConst::OneE30) {
           value *= multiplier;
         }
         upper_[iSequence + numberColumns_] = value;
@@ -8375,8 +8381,8 @@ void ClpSimplexDual::resetFakeBounds(int type)
             upper_[iSequence] = value;
             lower_[iSequence] = value - dualBound_;
           } else if (status == ClpSimplex::isFree || status == ClpSimplex::superBasic) {
-            lower_[iSequence] = value - 0.5 * dualBound_;
-            upper_[iSequence] = value + 0.5 * dualBound_;
+            lower_[iSequence] = value - FloatConst::Half * dualBound_;
+            upper_[iSequence] = value + FloatConst::Half * dualBound_;
           } else {
             printf("Unknown status %d for variable %d in %s line %d\n",
               status, iSequence, __FILE__, __LINE__);
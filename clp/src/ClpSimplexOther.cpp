@@ -2322,7 +2322,7 @@ int ClpSimplexOther::parametrics(const char *dataFile)
     if (!comma)
       break;
     *comma = '\0';
-    startTheta = FloatT(pos);
+    startTheta = toFloat(pos);
     *comma = ',';
     pos = comma + 1;
     // check upper theta
@@ -2330,14 +2330,14 @@ int ClpSimplexOther::parametrics(const char *dataFile)
     good = true;
     if (comma)
       *comma = '\0';
-    endTheta = FloatT(pos);
+    endTheta = toFloat(pos);
     if (comma) {
       *comma = ',';
       pos = comma + 1;
       comma = strchr(pos, ',');
       if (comma)
         *comma = '\0';
-      intervalTheta = FloatT(pos);
+      intervalTheta = toFloat(pos);
       if (comma) {
         *comma = ',';
         pos = comma + 1;
@@ -2497,15 +2497,15 @@ int ClpSimplexOther::parametrics(const char *dataFile)
             break;
             // lower
           case 2:
-            upper = FloatT(pos);
+            upper = toFloat(pos);
             break;
             // upper
           case 3:
-            lower = FloatT(pos);
+            lower = toFloat(pos);
             break;
             // rhs
           case 4:
-            lower = FloatT(pos);
+            lower = toFloat(pos);
             upper = lower;
             break;
           }
@@ -2670,15 +2670,15 @@ int ClpSimplexOther::parametrics(const char *dataFile)
               break;
               // lower
             case 2:
-              upper = FloatT(pos);
+              upper = toFloat(pos);
               break;
               // upper
             case 3:
-              lower = FloatT(pos);
+              lower = toFloat(pos);
               break;
               // objective
             case 4:
-              obj = FloatT(pos);
+              obj = toFloat(pos);
               upper = lower;
               break;
             }
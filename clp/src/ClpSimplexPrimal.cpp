@@ -78,6 +78,7 @@
  */
 
 #include "CoinPragma.hpp"
+#include "CoinProfile.hpp"
 
 #include <math.h>
 //#define FAKE_CILK
@@ -91,6 +92,7 @@
 #include "ClpPrimalColumnPivot.hpp"
 #include "ClpMessage.hpp"
 #include "ClpEventHandler.hpp"
+#include "ClpSolveStats.hpp"
 #include <cfloat>
 #include <cassert>
 #include <string>
@@ -133,6 +135,7 @@ void userChoiceWasGood(ClpSimplex *model);
 // primal
 int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
 {
+  COIN_PROFILE_REGION("primal");
 
   /*
          Method
@@ -295,9 +298,9 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
       if (handler_->logLevel() > 2) {
         handler_->message(CLP_SIMPLEX_STATUS, messages_)
           << numberIterations_ << objectiveValue();
-        handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+        handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
           << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-        handler_->printing(sumDualInfeasibilities_ > 0.0)
+        handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
           << sumDualInfeasibilities_ << numberDualInfeasibilities_;
         handler_->printing(numberDualInfeasibilitiesWithoutFree_
           < numberDualInfeasibilities_)
@@ -381,7 +384,7 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
           if (!numberPrimalInfeasibilities_)
             initialNegDjs = numberDualInfeasibilities_;
           // make sure weight won't be changed
-          if (infeasibilityCost_ == 1.0e10)
+          if (infeasibilityCost_ == FloatConst::OneE10)
             infeasibilityCost_ = 1.000001e10;
         }
       }
@@ -413,21 +416,21 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
         int *whichColumns = new int[numberColumns_];
         FloatT *weight = new FloatT[numberColumns_];
         int numberNegative = 0;
-        FloatT sumNegative = 0.0;
+        FloatT sumNegative = FloatConst::Zero;
         // now massage weight so all basic in plus good djs
         for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
           FloatT dj = dj_[iColumn];
           switch (getColumnStatus(iColumn)) {
 
           case basic:
-            dj = -1.0e50;
+            dj = -FloatConst::OneE50;
             numberBasic++;
             break;
           case atUpperBound:
             dj = -dj;
             break;
           case isFixed:
-            dj = 1.0e50;
+            dj = FloatConst::OneE50;
             numberFixed++;
             break;
           case atLowerBound:
@@ -440,7 +443,7 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
             dj = -100.0 * CoinAbs(dj);
             break;
           }
-          if (dj < -dualTolerance_ && dj > -1.0e50) {
+          if (dj < -dualTolerance_ && dj > -FloatConst::OneE50) {
             numberNegative++;
             sumNegative -= dj;
           }
@@ -453,7 +456,7 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
           << CoinMessageEol;
         sprintPass++;
         lastSprintIteration = numberIterations_;
-        if (objectiveValue() * optimizationDirection_ > lastObjectiveValue - 1.0e-7 && sprintPass > 5) {
+        if (objectiveValue() * optimizationDirection_ > lastObjectiveValue - FloatConst::OneEm7 && sprintPass > 5) {
           // switch off
           COIN_DETAIL_PRINT(printf("Switching off sprint\n"));
           primalColumnPivot_->switchOffSprint();
@@ -515,7 +518,7 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
       if (hitMaximumIterations() || (ifValuesPass == 2 && firstFree_ < 0)) {
         problemStatus_ = 3;
         break;
-      } else if ((moreSpecialOptions_ & 524288) != 0 && !nonLinearCost_->numberInfeasibilities() && CoinAbs(dblParam_[ClpDualObjectiveLimit]) > 1.0e30) {
+      } else if ((moreSpecialOptions_ & 524288) != 0 && !nonLinearCost_->numberInfeasibilities() && CoinAbs(dblParam_[ClpDualObjectiveLimit]) > FloatConst::OneE30) {
         problemStatus_ = 3;
         secondaryStatus_ = 10;
         break;
@@ -561,11 +564,11 @@ int ClpSimplexPrimal::primal(int ifValuesPass, int startFinishOptions)
   }
   // if infeasible get real values
   //printf("XXXXY final cost %g\n",infeasibilityCost_);
-  progress_.initialWeight_ = 0.0;
+  progress_.initialWeight_ = FloatConst::Zero;
   if (problemStatus_ == 1 && secondaryStatus_ != 6) {
     FloatT saveWeight = infeasibilityCost_;
 #ifndef WANT_INFEASIBLE_DUALS
-    infeasibilityCost_ = 0.0;
+    infeasibilityCost_ = FloatConst::Zero;
     createRim(1 + 4);
 #else
     infeasibilityCost_ = 1.0;
@@ -910,7 +913,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
               } else if (sequenceOut_ >= 0 && getStatus(sequenceOut_) != basic) {
                 setFlagged(sequenceOut_);
               }
-              FloatT newTolerance = CoinMax(0.5 + 0.499 * randomNumberGenerator_.randomDouble(), factorization_->pivotTolerance());
+              FloatT newTolerance = CoinMax(FloatConst::Half + 0.499 * randomNumberGenerator_.randomDouble(), factorization_->pivotTolerance());
               factorization_->pivotTolerance(newTolerance);
             } else {
               // Go to safe
@@ -935,11 +938,11 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
       if (problemStatus_ != -4)
         problemStatus_ = -3;
     }
-    if (progress->realInfeasibility_[0] < 1.0e-1 && primalTolerance_ == 1.0e-7 && progress->iterationNumber_[0] > 0 && progress->iterationNumber_[CLP_PROGRESS - 1] - progress->iterationNumber_[0] > 25) {
+    if (progress->realInfeasibility_[0] < 1.0e-1 && primalTolerance_ == FloatConst::OneEm7 && progress->iterationNumber_[0] > 0 && progress->iterationNumber_[CLP_PROGRESS - 1] - progress->iterationNumber_[0] > 25) {
       // default - so user did not set
       int iP;
       FloatT minAverage = COIN_DBL_MAX;
-      FloatT maxAverage = 0.0;
+      FloatT maxAverage = FloatConst::Zero;
       for (iP = 0; iP < CLP_PROGRESS; iP++) {
         int n = progress->numberInfeasibilities_[iP];
         if (!n) {
@@ -953,13 +956,13 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
           maxAverage = CoinMax(maxAverage, average);
         }
       }
-      if (iP == CLP_PROGRESS && minAverage < 1.0e-5 && maxAverage < 1.0e-3) {
+      if (iP == CLP_PROGRESS && minAverage < FloatConst::OneEm5 && maxAverage < FloatConst::OneEm3) {
         // change tolerance
 #if CBC_USEFUL_PRINTING > 0
         printf("CCchanging tolerance\n");
 #endif
-        primalTolerance_ = 1.0e-6;
-        dblParam_[ClpPrimalTolerance] = 1.0e-6;
+        primalTolerance_ = FloatConst::OneEm6;
+        dblParam_[ClpPrimalTolerance] = FloatConst::OneEm6;
         moreSpecialOptions_ |= 4194304;
       }
     }
@@ -1000,14 +1003,14 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
 #endif
     if (!lastSumInfeasibility && sumInfeasibility && lastAverageInfeasibility < test2 && numberPivots > 10)
       reason2 = 3;
-    if (lastSumInfeasibility < 1.0e-6 && sumInfeasibility > 1.0e-3 && numberPivots > 10)
+    if (lastSumInfeasibility < FloatConst::OneEm6 && sumInfeasibility > FloatConst::OneEm3 && numberPivots > 10)
       reason2 = 4;
 #endif
     if (numberThrownOut)
       reason2 = 1;
     if ((sumInfeasibility > 1.0e7 && sumInfeasibility > 100.0 * lastSumInfeasibility
           && factorization_->pivotTolerance() < 0.11)
-      || (largestPrimalError_ > 1.0e10 && largestDualError_ > 1.0e10))
+      || (largestPrimalError_ > FloatConst::OneE10 && largestDualError_ > FloatConst::OneE10))
       reason2 = 2;
     if (reason2) {
       problemStatus_ = tentativeStatus;
@@ -1062,15 +1065,15 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
   if (progress->lastIterationNumber(0) == numberIterations_) {
     if (primalColumnPivot_->looksOptimal()) {
       numberDualInfeasibilities_ = 0;
-      sumDualInfeasibilities_ = 0.0;
+      sumDualInfeasibilities_ = FloatConst::Zero;
     }
   }
   // If in primal and small dj give up
   if ((specialOptions_ & 1024) != 0 && !numberPrimalInfeasibilities_ && numberDualInfeasibilities_) {
     FloatT average = sumDualInfeasibilities_ / (static_cast< FloatT >(numberDualInfeasibilities_));
-    if (numberIterations_ > 300 && average < 1.0e-4) {
+    if (numberIterations_ > 300 && average < FloatConst::OneEm4) {
       numberDualInfeasibilities_ = 0;
-      sumDualInfeasibilities_ = 0.0;
+      sumDualInfeasibilities_ = FloatConst::Zero;
     }
   }
   // Check if looping
@@ -1083,7 +1086,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
     if (!problemStatus_) {
       // declaring victory
       numberPrimalInfeasibilities_ = 0;
-      sumPrimalInfeasibilities_ = 0.0;
+      sumPrimalInfeasibilities_ = FloatConst::Zero;
     } else {
       problemStatus_ = loop; //exit if in loop
       problemStatus_ = 10; // instead - try other algorithm
@@ -1119,7 +1122,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
     << numberIterations_ << nonLinearCost_->feasibleReportCost();
   handler_->printing(nonLinearCost_->numberInfeasibilities() > 0)
     << nonLinearCost_->sumInfeasibilities() << nonLinearCost_->numberInfeasibilities();
-  handler_->printing(sumDualInfeasibilities_ > 0.0)
+  handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
     << sumDualInfeasibilities_ << numberDualInfeasibilities_;
   handler_->printing(numberDualInfeasibilitiesWithoutFree_
     < numberDualInfeasibilities_)
@@ -1130,7 +1133,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
     gutsOfSolution(NULL, NULL, ifValuesPass != 0);
     nonLinearCost_->checkInfeasibilities(primalTolerance_);
   }
-  if (nonLinearCost_->numberInfeasibilities() > 0 && !progress->initialWeight_ && !ifValuesPass && infeasibilityCost_ == 1.0e10) {
+  if (nonLinearCost_->numberInfeasibilities() > 0 && !progress->initialWeight_ && !ifValuesPass && infeasibilityCost_ == FloatConst::OneE10) {
     // first time infeasible - start up weight computation
     FloatT *oldDj = dj_;
     FloatT *oldCost = cost_;
@@ -1238,7 +1241,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
       gutsOfSolution(NULL, NULL, ifValuesPass != 0);
   }
   FloatT trueInfeasibility = nonLinearCost_->sumInfeasibilities();
-  if (!nonLinearCost_->numberInfeasibilities() && infeasibilityCost_ == 1.0e10 && !ifValuesPass && true) {
+  if (!nonLinearCost_->numberInfeasibilities() && infeasibilityCost_ == FloatConst::OneE10 && !ifValuesPass && true) {
     // relax if default
     infeasibilityCost_ = CoinMin(CoinMax(100.0 * sumDualInfeasibilities_, 1.0e8), fd(1.00000001e10));
     // reset looping criterion
@@ -1247,7 +1250,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
   }
   if (trueInfeasibility > 1.0) {
     // If infeasibility going up may change weights
-    FloatT testValue = trueInfeasibility - 1.0e-4 * (10.0 + trueInfeasibility);
+    FloatT testValue = trueInfeasibility - FloatConst::OneEm4 * (10.0 + trueInfeasibility);
     FloatT lastInf = progress->lastInfeasibility(1);
     FloatT lastInf3 = progress->lastInfeasibility(3);
     FloatT thisObj = progress->lastObjective(0);
@@ -1260,7 +1263,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
     assert(thisObj <= COIN_DBL_MAX);
     assert(lastObj <= COIN_DBL_MAX);
     assert(lastObj3 <= COIN_DBL_MAX);
-    if (lastObj < thisObj - 1.0e-5 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj)) - 1.0e-7
+    if (lastObj < thisObj - FloatConst::OneEm5 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj)) - FloatConst::OneEm7
       && firstFree_ < 0 && thisInf >= lastInf) {
       if (handler_->logLevel() == 63)
         printf("lastobj %g this %g force %d\n", (double)lastObj, (double)thisObj, forceFactorization_);
@@ -1272,7 +1275,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
         if (handler_->logLevel() == 63)
           printf("Reducing factorization frequency to %d\n", forceFactorization_);
       }
-    } else if (lastObj3 < thisObj - 1.0e-5 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj3)) - 1.0e-7
+    } else if (lastObj3 < thisObj - FloatConst::OneEm5 * CoinMax(CoinAbs(thisObj), CoinAbs(lastObj3)) - FloatConst::OneEm7
       && firstFree_ < 0 && thisInf >= lastInf) {
       if (handler_->logLevel() == 63)
         printf("lastobj3 %g this3 %g force %d\n", (double)lastObj3, (double)thisObj, forceFactorization_);
@@ -1298,12 +1301,12 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
   // we may wish to say it is optimal even if infeasible
   bool alwaysOptimal = (specialOptions_ & 1) != 0;
   // give code benefit of doubt
-  if (sumOfRelaxedDualInfeasibilities_ == 0.0 && sumOfRelaxedPrimalInfeasibilities_ == 0.0 && progress->objective_[CLP_PROGRESS - 1] >= progress->objective_[CLP_PROGRESS - 2] - 1.0e-9 * (10.0 + CoinAbs(objectiveValue_))) {
+  if (sumOfRelaxedDualInfeasibilities_ == FloatConst::Zero && sumOfRelaxedPrimalInfeasibilities_ == FloatConst::Zero && progress->objective_[CLP_PROGRESS - 1] >= progress->objective_[CLP_PROGRESS - 2] - 1.0e-9 * (10.0 + CoinAbs(objectiveValue_))) {
     // say optimal (with these bounds etc)
     numberDualInfeasibilities_ = 0;
-    sumDualInfeasibilities_ = 0.0;
+    sumDualInfeasibilities_ = FloatConst::Zero;
     numberPrimalInfeasibilities_ = 0;
-    sumPrimalInfeasibilities_ = 0.0;
+    sumPrimalInfeasibilities_ = FloatConst::Zero;
     // But check if in sprint
     if (originalModel) {
       // Carry on and re-do
@@ -1314,7 +1317,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
       // most likely to happen if infeasible
       FloatT relaxedToleranceP = primalTolerance_;
       // we can't really trust infeasibilities if there is primal error
-      FloatT error = CoinMin(1.0e-2, largestPrimalError_);
+      FloatT error = CoinMin(FloatConst::OneEm2, largestPrimalError_);
       // allow tolerance at least slightly bigger than standard
       relaxedToleranceP = relaxedToleranceP + error;
       int ninfeas = nonLinearCost_->numberInfeasibilities();
@@ -1344,7 +1347,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
   // had ||(type==3&&problemStatus_!=-5) -- ??? why ????
   if ((dualFeasible() || problemStatus_ == -4) && (!ifValuesPass || looksOptimal || firstFree_ < 0)) {
     // see if extra helps
-    if (nonLinearCost_->numberInfeasibilities() && (nonLinearCost_->sumInfeasibilities() > 1.0e-3 || sumOfRelaxedPrimalInfeasibilities_)
+    if (nonLinearCost_->numberInfeasibilities() && (nonLinearCost_->sumInfeasibilities() > FloatConst::OneEm3 || sumOfRelaxedPrimalInfeasibilities_)
       /*&& alwaysOptimal*/) {
       //may need infeasiblity cost changed
       // we can see if we can construct a ray
@@ -1373,7 +1376,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
 #ifndef MAX_INFEASIBILITY_COST
 #define MAX_INFEASIBILITY_COST 1.0e18
 #endif
-        infeasibilityCost_ = 1.0e30;
+        infeasibilityCost_ = FloatConst::OneE30;
         gutsOfSolution(NULL, NULL, ifValuesPass != 0 && firstFree_ >= 0);
         infeasibilityCost_ = CoinMax(saveWeight, saveOriginalWeight);
         if ((infeasibilityCost_ >= MAX_INFEASIBILITY_COST || numberDualInfeasibilities_ == 0) && perturbation_ == 101) {
@@ -1383,7 +1386,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
           nonLinearCost_->checkInfeasibilities(primalTolerance_);
           numberDualInfeasibilities_ = 1; // carry on
           problemStatus_ = -1;
-        } else if (numberDualInfeasibilities_ == 0 && largestDualError_ > 1.0e-2 && (moreSpecialOptions_ & (256 | 8192)) == 0) {
+        } else if (numberDualInfeasibilities_ == 0 && largestDualError_ > FloatConst::OneEm2 && (moreSpecialOptions_ & (256 | 8192)) == 0) {
           goToDual = true;
           factorization_->pivotTolerance(CoinMax(0.9, factorization_->pivotTolerance()));
         }
@@ -1413,12 +1416,12 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
             printf("Primal creating infeasibility ray\n");
 #endif
             // and get feasible duals
-            infeasibilityCost_ = 0.0;
+            infeasibilityCost_ = FloatConst::Zero;
             createRim(4);
             nonLinearCost_->checkInfeasibilities(primalTolerance_);
             gutsOfSolution(NULL, NULL, ifValuesPass != 0);
             // so will exit
-            infeasibilityCost_ = 1.0e30;
+            infeasibilityCost_ = FloatConst::OneE30;
             // reset infeasibilities
             sumPrimalInfeasibilities_ = nonLinearCost_->sumInfeasibilities();
             ;
@@ -1429,7 +1432,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
             if (testValue == 1.0e18) {
               // Check it is not just noise
               const FloatT *obj = objective();
-              FloatT largestCost = 0.0;
+              FloatT largestCost = FloatConst::Zero;
               if (columnScale_) {
                 for (int i = 0; i < numberColumns_; i++) {
                   largestCost = CoinMax(largestCost, CoinAbs(obj[i] * columnScale_[i]));
@@ -1439,7 +1442,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
                   largestCost = CoinMax(largestCost, CoinAbs(obj[i]));
                 }
               }
-              testValue = 1.0e12 * (largestCost + 1.0e-6);
+              testValue = 1.0e12 * (largestCost + FloatConst::OneEm6);
               if (numberDualInfeasibilities_) {
                 FloatT average = sumDualInfeasibilities_ / numberDualInfeasibilities_;
                 testValue = CoinMax(testValue, average);
@@ -1537,12 +1540,12 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
                          delete [] xsolution;
 #endif
           gutsOfSolution(NULL, NULL, ifValuesPass != 0);
-          if (sumOfRelaxedDualInfeasibilities_ == 0.0 && sumOfRelaxedPrimalInfeasibilities_ == 0.0) {
+          if (sumOfRelaxedDualInfeasibilities_ == FloatConst::Zero && sumOfRelaxedPrimalInfeasibilities_ == FloatConst::Zero) {
             // say optimal (with these bounds etc)
             numberDualInfeasibilities_ = 0;
-            sumDualInfeasibilities_ = 0.0;
+            sumDualInfeasibilities_ = FloatConst::Zero;
             numberPrimalInfeasibilities_ = 0;
-            sumPrimalInfeasibilities_ = 0.0;
+            sumPrimalInfeasibilities_ = FloatConst::Zero;
           }
           if (dualFeasible() && !nonLinearCost_->numberInfeasibilities() && lastCleaned >= 0)
             problemStatus_ = 0;
@@ -1559,7 +1562,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
         /* Previous code here mostly works but
 		    sumOfRelaxed is rubbish in primal 
 		 - so give benefit of doubt still */
-        FloatT error = CoinMin(1.0e-4, largestPrimalError_);
+        FloatT error = CoinMin(FloatConst::OneEm4, largestPrimalError_);
         // allow bigger tolerance than standard
         FloatT saveTolerance = primalTolerance_;
         primalTolerance_ = 2.0 * primalTolerance_ + error;
@@ -1616,7 +1619,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
       if (type == 3 && !ifValuesPass) {
         //bool unflagged =
         unflag();
-        if (sumDualInfeasibilities_ < 1.0e-3 || (sumDualInfeasibilities_ / static_cast< FloatT >(numberDualInfeasibilities_)) < 1.0e-5 || progress->lastIterationNumber(0) == numberIterations_) {
+        if (sumDualInfeasibilities_ < FloatConst::OneEm3 || (sumDualInfeasibilities_ / static_cast< FloatT >(numberDualInfeasibilities_)) < FloatConst::OneEm5 || progress->lastIterationNumber(0) == numberIterations_) {
           if (!numberPrimalInfeasibilities_) {
             if (numberTimesOptimal_ < 4) {
               numberTimesOptimal_++;
@@ -1634,7 +1637,7 @@ void ClpSimplexPrimal::statusOfProblemInPrimal(int &lastCleaned, int type,
     FloatT objVal = (nonLinearCost_->feasibleCost()
       + objective_->nonlinearOffset());
     objVal /= (objectiveScale_ * rhsScale_);
-    FloatT tol = 1.0e-10 * CoinMax(CoinAbs(objVal), CoinAbs(objectiveValue_)) + 1.0e-8;
+    FloatT tol = 1.0e-10 * CoinMax(CoinAbs(objVal), CoinAbs(objectiveValue_)) + FloatConst::OneEm8;
     if (CoinAbs(objVal - objectiveValue_) > tol) {
 #ifdef COIN_DEVELOP
       if (handler_->logLevel() > 0)
@@ -1729,6 +1732,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
   CoinIndexedVector *spareArray,
   int valuesPass)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::ratioTest);
   FloatT saveDj = dualIn_;
   if (valuesPass && objective_->type() < 2) {
     dualIn_ = cost_[sequenceIn_];
@@ -1766,7 +1770,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
   pivotRow_ = -1;
   int numberRemaining = 0;
 
-  FloatT totalThru = 0.0; // for when variables flip
+  FloatT totalThru = FloatConst::Zero; // for when variables flip
   // Allow first few iterations to take tiny
   FloatT acceptablePivot = 1.0e-1 * acceptablePivot_;
   if (numberIterations_ > 100)
@@ -1779,8 +1783,8 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
     acceptablePivot = acceptablePivot_; // relax
   FloatT bestEverPivot = acceptablePivot;
   int lastPivotRow = -1;
-  FloatT lastPivot = 0.0;
-  FloatT lastTheta = 1.0e50;
+  FloatT lastPivot = FloatConst::Zero;
+  FloatT lastTheta = FloatConst::OneE50;
 
   // use spareArrays to put ones looked at in
   // First one is list of candidates
@@ -1823,15 +1827,15 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
   // we need to swap sign if coming in from ub
   FloatT way = directionIn_;
   FloatT maximumMovement;
-  if (way > 0.0)
-    maximumMovement = CoinMin(1.0e30, upperIn_ - valueIn_);
+  if (way > FloatConst::Zero)
+    maximumMovement = CoinMin(FloatConst::OneE30, upperIn_ - valueIn_);
   else
-    maximumMovement = CoinMin(1.0e30, valueIn_ - lowerIn_);
+    maximumMovement = CoinMin(FloatConst::OneE30, valueIn_ - lowerIn_);
 
   FloatT averageTheta = nonLinearCost_->averageTheta();
   FloatT tentativeTheta = CoinMin(10.0 * averageTheta, maximumMovement);
   FloatT upperTheta = maximumMovement;
-  if (tentativeTheta > 0.5 * maximumMovement)
+  if (tentativeTheta > FloatConst::Half * maximumMovement)
     tentativeTheta = maximumMovement;
   bool thetaAtMaximum = tentativeTheta == maximumMovement;
   // In case tiny bounds increase
@@ -1862,7 +1866,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
 #endif
   while (true) {
     pivotOne = -1;
-    totalThru = 0.0;
+    totalThru = FloatConst::Zero;
     //FloatT totalThruFake=0.0;
     //int nThru=0;
     // We also re-compute reduced cost
@@ -1884,7 +1888,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
       // note that after this alpha is actually CoinAbs(alpha)
       bool possible;
       // do computation same way as later on in primal
-      if (alpha > 0.0) {
+      if (alpha > FloatConst::Zero) {
         // basic variable going towards lower bound
         FloatT bound = lower_[iPivot];
         // must be exactly same as when used
@@ -1907,7 +1911,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
 #ifdef CLP_USER_DRIVEN1
         if (!userChoiceValid1(this, iPivot, oldValue,
               upperTheta, alpha, work[iIndex] * way))
-          value = 0.0; // say can't use
+          value = FloatConst::Zero; // say can't use
 #endif
         if (value < -primalTolerance_ && alpha >= acceptablePivot) {
           upperTheta = (oldValue + primalTolerance_) / alpha;
@@ -1932,7 +1936,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
 		    eventHandler_->eventWithInfo(ClpEventHandler::pivotRow,
 						 &info);
 		    totalThruFake=info.totalThru;
-		    if (CoinAbs(totalThruFake-tempThru)>1.0e-4)
+		    if (CoinAbs(totalThruFake-tempThru)>FloatConst::OneEm4)
 		      printf("%d thru - fake %g real %g\n",nThru,totalThruFake,totalThru);
 		    nThru++;
 #endif
@@ -1945,7 +1949,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
 #if 0 // was def CLP_USER_DRIVEN
 	  clpUserStruct info;
 	  info.type=4;
-	  info.alpha=(upperTheta+1.0e-5)*way;
+	  info.alpha=(upperTheta+FloatConst::OneEm5)*way;
 	  eventHandler_->eventWithInfo(ClpEventHandler::pivotRow,
 				       &info);
           if (upperTheta < maximumMovement && totalThru*infeasibilityCost_ >= 1.0001 * dualCheck) {
@@ -1970,7 +1974,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
       break;
     }
   }
-  totalThru = 0.0;
+  totalThru = FloatConst::Zero;
 
   theta_ = maximumMovement;
 
@@ -2011,7 +2015,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
         int sequenceOut = pivotVariable_[index[iIndex]];
         if (!userChoiceValid1(this, sequenceOut, oldValue,
               upperTheta, alpha, 0.0))
-          value = 0.0; // say can't use
+          value = FloatConst::Zero; // say can't use
 #endif
         if (value < -primalTolerance_ && alpha >= acceptablePivot) {
           upperTheta = (oldValue + primalTolerance_) / alpha;
@@ -2020,7 +2024,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
       }
       // now look at best in this lot
       // But also see how infeasible small pivots will make
-      FloatT sumInfeasibilities = 0.0;
+      FloatT sumInfeasibilities = FloatConst::Zero;
       FloatT bestPivot = acceptablePivot;
       pivotRow_ = -1;
       for (iIndex = 0; iIndex < numberRemaining; iIndex++) {
@@ -2070,11 +2074,11 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
 #if 0 // was def CLP_USER_DRIVEN
 	       clpUserStruct info;
 	       info.type=5;
-	       info.alpha=(theta_+1.0e-5)*way;
+	       info.alpha=(theta_+FloatConst::OneEm5)*way;
 	       eventHandler_->eventWithInfo(ClpEventHandler::pivotRow,
 				       &info);
 #endif
-      if (bestPivot < 0.1 * bestEverPivot && bestEverPivot > 1.0e-6 && bestPivot < 1.0e-3) {
+      if (bestPivot < 0.1 * bestEverPivot && bestEverPivot > FloatConst::OneEm6 && bestPivot < FloatConst::OneEm3) {
         // back to previous one
         goBackOne = true;
         break;
@@ -2093,7 +2097,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
             goBackOne = true;
           } else {
             // say no good
-            dualIn_ = 0.0;
+            dualIn_ = FloatConst::Zero;
           }
         }
         break; // no point trying another loop
@@ -2116,7 +2120,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
     if (nonLinearCost_->numberInfeasibilities()) {
       // but infeasible??
       // move variable but don't pivot
-      tentativeTheta = 1.0e50;
+      tentativeTheta = FloatConst::OneE50;
       for (iIndex = 0; iIndex < number; iIndex++) {
         int iRow = which[iIndex];
         FloatT alpha = work[iIndex];
@@ -2125,7 +2129,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
         FloatT oldValue = solution_[iPivot];
         // get where in bound sequence
         // note that after this alpha is actually CoinAbs(alpha)
-        if (alpha > 0.0) {
+        if (alpha > FloatConst::Zero) {
           // basic variable going towards lower bound
           FloatT bound = lower_[iPivot];
           oldValue -= bound;
@@ -2135,19 +2139,19 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
           oldValue = bound - oldValue;
           alpha = -alpha;
         }
-        if (oldValue - tentativeTheta * alpha < 0.0) {
+        if (oldValue - tentativeTheta * alpha < FloatConst::Zero) {
           tentativeTheta = oldValue / alpha;
         }
       }
       // If free in then see if we can get to 0.0
       if (lowerIn_ < TOO_SMALL_FLOAT && upperIn_ > TOO_BIG_FLOAT) {
-        if (dualIn_ * valueIn_ > 0.0) {
-          if (CoinAbs(valueIn_) < 1.0e-2 && (tentativeTheta < CoinAbs(valueIn_) || tentativeTheta > TOO_BIG_FLOAT)) {
+        if (dualIn_ * valueIn_ > FloatConst::Zero) {
+          if (CoinAbs(valueIn_) < FloatConst::OneEm2 && (tentativeTheta < CoinAbs(valueIn_) || tentativeTheta > TOO_BIG_FLOAT)) {
             tentativeTheta = CoinAbs(valueIn_);
           }
         }
       }
-      if (tentativeTheta < 1.0e10)
+      if (tentativeTheta < FloatConst::OneE10)
         valueOut_ = valueIn_ + way * tentativeTheta;
     }
   }
@@ -2169,15 +2173,15 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
     if (upperOut_ > lowerOut_)
       minimumTheta = MINIMUMTHETA;
     else
-      minimumTheta = 0.0;
+      minimumTheta = FloatConst::Zero;
     // But can't go infeasible
     FloatT distance;
-    if (alpha_ * way > 0.0)
+    if (alpha_ * way > FloatConst::Zero)
       distance = valueOut_ - lowerOut_;
     else
       distance = upperOut_ - valueOut_;
     if (distance - minimumTheta * CoinAbs(alpha_) < -primalTolerance_)
-      minimumTheta = CoinMax(0.0, (distance + 0.5 * primalTolerance_) / CoinAbs(alpha_));
+      minimumTheta = CoinMax(0.0, (distance + FloatConst::Half * primalTolerance_) / CoinAbs(alpha_));
     // will we need to increase tolerance
     //#define CLP_DEBUG
     FloatT largestInfeasibility = primalTolerance_;
@@ -2201,20 +2205,20 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
       for (iIndex = 0; iIndex < number; iIndex++)
         setActive(which[iIndex]);
     }
-    if (way < 0.0)
+    if (way < FloatConst::Zero)
       theta_ = -theta_;
     FloatT newValue = valueOut_ - theta_ * alpha_;
     // If  4 bit set - Force outgoing variables to exact bound (primal)
-    if (alpha_ * way < 0.0) {
+    if (alpha_ * way < FloatConst::Zero) {
       directionOut_ = -1; // to upper bound
-      if (CoinAbs(theta_) > 1.0e-6 || (specialOptions_ & 4) != 0) {
+      if (CoinAbs(theta_) > FloatConst::OneEm6 || (specialOptions_ & 4) != 0) {
         upperOut_ = nonLinearCost_->nearest(sequenceOut_, newValue);
       } else {
         upperOut_ = newValue;
       }
     } else {
       directionOut_ = 1; // to lower bound
-      if (CoinAbs(theta_) > 1.0e-6 || (specialOptions_ & 4) != 0) {
+      if (CoinAbs(theta_) > FloatConst::OneEm6 || (specialOptions_ & 4) != 0) {
         lowerOut_ = nonLinearCost_->nearest(sequenceOut_, newValue);
       } else {
         lowerOut_ = newValue;
@@ -2229,8 +2233,8 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
     dualOut_ = dualIn_;
     lowerOut_ = lowerIn_;
     upperOut_ = upperIn_;
-    alpha_ = 0.0;
-    if (way < 0.0) {
+    alpha_ = FloatConst::Zero;
+    if (way < FloatConst::Zero) {
       directionOut_ = 1; // to lower bound
       theta_ = lowerOut_ - valueOut_;
     } else {
@@ -2239,7 +2243,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
     }
   }
 
-  FloatT theta1 = CoinMax(theta_, 1.0e-12);
+  FloatT theta1 = CoinMax(theta_, FloatConst::OneEm12);
   FloatT theta2 = numberIterations_ * nonLinearCost_->averageTheta();
   // Set average theta
   nonLinearCost_->setAverageTheta((theta1 + theta2) / (static_cast< FloatT >(numberIterations_ + 1)));
@@ -2270,6 +2274,7 @@ void ClpSimplexPrimal::primalColumn(CoinIndexedVector *updates,
   CoinIndexedVector *spareColumn1,
   CoinIndexedVector *spareColumn2)
 {
+  ClpSolveStats::Timer timer(ClpSolveStats::pricing);
 
   ClpMatrixBase *saveMatrix = matrix_;
   FloatT *saveRowScale = rowScale_;
@@ -2293,7 +2298,7 @@ void ClpSimplexPrimal::primalColumn(CoinIndexedVector *updates,
 
       switch (status) {
       case ClpSimplex::atUpperBound:
-        if (dualIn_ < 0.0) {
+        if (dualIn_ < FloatConst::Zero) {
           // move to other side
           COIN_DETAIL_PRINT(printf("For %d U (%g, %g, %g) dj changed from %g",
             sequenceIn_, lower_[sequenceIn_], solution_[sequenceIn_],
@@ -2305,7 +2310,7 @@ void ClpSimplexPrimal::primalColumn(CoinIndexedVector *updates,
         }
         break;
       case ClpSimplex::atLowerBound:
-        if (dualIn_ > 0.0) {
+        if (dualIn_ > FloatConst::Zero) {
           // move to other side
           COIN_DETAIL_PRINT(printf("For %d L (%g, %g, %g) dj changed from %g",
             sequenceIn_, lower_[sequenceIn_], solution_[sequenceIn_],
@@ -2322,7 +2327,7 @@ void ClpSimplexPrimal::primalColumn(CoinIndexedVector *updates,
     }
     lowerIn_ = lower_[sequenceIn_];
     upperIn_ = upper_[sequenceIn_];
-    if (dualIn_ > 0.0)
+    if (dualIn_ > FloatConst::Zero)
       directionIn_ = -1;
     else
       directionIn_ = 1;
@@ -2339,8 +2344,9 @@ int ClpSimplexPrimal::updatePrimalsInPrimal(CoinIndexedVector *rowArray,
   FloatT &objectiveChange,
   int valuesPass)
 {
+  COIN_PROFILE_REGION("updatePrimals");
   // Cost on pivot row may change - may need to change dualIn
-  FloatT oldCost = 0.0;
+  FloatT oldCost = FloatConst::Zero;
   if (pivotRow_ >= 0)
     oldCost = cost_[sequenceOut_];
   //rowArray->scanAndPack();
@@ -2362,7 +2368,7 @@ int ClpSimplexPrimal::updatePrimalsInPrimal(CoinIndexedVector *rowArray,
 
       int iRow = which[iIndex];
       FloatT alpha = work[iIndex];
-      work[iIndex] = 0.0;
+      work[iIndex] = FloatConst::Zero;
       int iPivot = pivotVariable_[iRow];
       FloatT change = theta * alpha;
       FloatT value = solution_[iPivot] - change;
@@ -2371,7 +2377,7 @@ int ClpSimplexPrimal::updatePrimalsInPrimal(CoinIndexedVector *rowArray,
       // check if not active then okay
       if (!active(iRow) && (specialOptions_ & 4) == 0 && pivotRow_ != -1) {
         // But make sure one going out is feasible
-        if (change > 0.0) {
+        if (change > FloatConst::Zero) {
           // going down
           if (value <= lower_[iPivot] + primalTolerance_) {
             if (iPivot == sequenceOut_ && value > lower_[iPivot] - relaxedTolerance)
@@ -2390,10 +2396,10 @@ int ClpSimplexPrimal::updatePrimalsInPrimal(CoinIndexedVector *rowArray,
         }
       }
 #endif
-      if (active(iRow) || theta_ < 0.0) {
+      if (active(iRow) || theta_ < FloatConst::Zero) {
         clearActive(iRow);
         // But make sure one going out is feasible
-        if (change > 0.0) {
+        if (change > FloatConst::Zero) {
           // going down
           if (value <= lower_[iPivot] + primalTolerance_) {
             if (iPivot == sequenceOut_ && value >= lower_[iPivot] - relaxedTolerance)
@@ -2432,14 +2438,14 @@ int ClpSimplexPrimal::updatePrimalsInPrimal(CoinIndexedVector *rowArray,
 
       int iRow = which[iIndex];
       FloatT alpha = work[iIndex];
-      work[iIndex] = 0.0;
+      work[iIndex] = FloatConst::Zero;
       int iPivot = pivotVariable_[iRow];
       FloatT change = theta * alpha;
       FloatT value = solution_[iPivot] - change;
       solution_[iPivot] = value;
       clearActive(iRow);
       // But make sure one going out is feasible
-      if (change > 0.0) {
+      if (change > FloatConst::Zero) {
         // going down
         if (value <= lower_[iPivot] + primalTolerance_) {
           if (iPivot == sequenceOut_ && value > lower_[iPivot] - relaxedTolerance)
@@ -2536,10 +2542,10 @@ void ClpSimplexPrimal::perturb(int type)
     for (i = 0; i < numberRows_; i++) {
       FloatT lo = CoinAbs(rowLower_[i]);
       FloatT up = CoinAbs(rowUpper_[i]);
-      FloatT value = 0.0;
+      FloatT value = FloatConst::Zero;
       if (lo && lo < TOO_BIG_FLOAT) {
         if (up && up < TOO_BIG_FLOAT) {
-          value = 0.5 * (lo + up);
+          value = FloatConst::Half * (lo + up);
           if (lo == up)
             nFixed++;
         } else {
@@ -2576,10 +2582,10 @@ void ClpSimplexPrimal::perturb(int type)
       for (i = 0; i < numberColumns_; i++) {
         FloatT lo = CoinAbs(columnLower_[i]);
         FloatT up = CoinAbs(columnUpper_[i]);
-        FloatT value = 0.0;
+        FloatT value = FloatConst::Zero;
         if (lo && lo < TOO_BIG_FLOAT) {
           if (up && up < TOO_BIG_FLOAT) {
-            value = 0.5 * (lo + up);
+            value = FloatConst::Half * (lo + up);
             if (lo == up)
               nFixed++;
           } else {
@@ -2614,20 +2620,20 @@ void ClpSimplexPrimal::perturb(int type)
   FloatT bias = 1.0;
   int numberNonZero = 0;
   // maximum fraction of rhs/bounds to perturb
-  FloatT maximumFraction = 1.0e-5;
+  FloatT maximumFraction = FloatConst::OneEm5;
   if (perturbation_ >= 50) {
-    perturbation = 1.0e-4;
+    perturbation = FloatConst::OneEm4;
     for (i = 0; i < numberColumns_ + numberRows_; i++) {
       if (upper_[i] > lower_[i] + primalTolerance_) {
         FloatT lowerValue, upperValue;
         if (lower_[i] > TOO_SMALL_FLOAT)
           lowerValue = CoinAbs(lower_[i]);
         else
-          lowerValue = 0.0;
+          lowerValue = FloatConst::Zero;
         if (upper_[i] < TOO_BIG_FLOAT)
           upperValue = CoinAbs(upper_[i]);
         else
-          upperValue = 0.0;
+          upperValue = FloatConst::Zero;
         FloatT value = CoinMax(CoinAbs(lowerValue), CoinAbs(upperValue));
         value = CoinMin(value, upper_[i] - lower_[i]);
 #if 1
@@ -2664,9 +2670,9 @@ void ClpSimplexPrimal::perturb(int type)
     // user is in charge
     maximumFraction = 1.0;
   }
-  FloatT largestZero = 0.0;
-  FloatT largest = 0.0;
-  FloatT largestPerCent = 0.0;
+  FloatT largestZero = FloatConst::Zero;
+  FloatT largest = FloatConst::Zero;
+  FloatT largestPerCent = FloatConst::Zero;
   bool printOut = (handler_->logLevel() == 63);
   printOut = false; //off
   // Check if all slack
@@ -2734,15 +2740,15 @@ void ClpSimplexPrimal::perturb(int type)
 #if 0
                               if (iSequence >= numberColumns_) {
                                    // may not be at bound - but still perturb (unless free)
-                                   if (upperValue > 1.0e30 && lowerValue < -1.0e30)
-                                        value = 0.0;
+                                   if (upperValue > FloatConst::OneE30 && lowerValue < -FloatConst::OneE30)
+                                        value = FloatConst::Zero;
                                    else
                                         value = - value; // as -1.0 in matrix
                               } else {
-                                   value = 0.0;
+                                   value = FloatConst::Zero;
                               }
 #else
-            value = 0.0;
+            value = FloatConst::Zero;
 #endif
           }
           if (value) {
@@ -2776,31 +2782,31 @@ void ClpSimplexPrimal::perturb(int type)
         value *= randomNumberGenerator_.randomDouble();
         if (savePerturbation != 50) {
           if (CoinAbs(value) <= primalTolerance_)
-            value = 0.0;
+            value = FloatConst::Zero;
         }
         if (value) {
-          FloatT valueL = value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
+          FloatT valueL = value * (CoinMax(FloatConst::OneEm2, FloatConst::OneEm5 * CoinAbs(lowerValue)));
           // get in range
           if (valueL <= tolerance) {
             valueL *= 10.0;
             while (valueL <= tolerance)
               valueL *= 10.0;
-          } else if (valueL > 1.0e-3) {
+          } else if (valueL > FloatConst::OneEm3) {
             valueL *= 0.1;
-            while (valueL > 1.0e-3)
+            while (valueL > FloatConst::OneEm3)
               valueL *= 0.1;
           }
           if (lowerValue > TOO_SMALL_FLOAT && lowerValue)
             lowerValue -= valueL;
-          FloatT valueU = value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(upperValue)));
+          FloatT valueU = value * (CoinMax(FloatConst::OneEm2, FloatConst::OneEm5 * CoinAbs(upperValue)));
           // get in range
           if (valueU <= tolerance) {
             valueU *= 10.0;
             while (valueU <= tolerance)
               valueU *= 10.0;
-          } else if (valueU > 1.0e-3) {
+          } else if (valueU > FloatConst::OneEm3) {
             valueU *= 0.1;
-            while (valueU > 1.0e-3)
+            while (valueU > FloatConst::OneEm3)
               valueU *= 0.1;
           }
           if (upperValue < TOO_BIG_FLOAT && upperValue)
@@ -2836,13 +2842,13 @@ void ClpSimplexPrimal::perturb(int type)
       if (rowLower[i] != rowUpper[i] && upperValue > lowerValue + tolerance) {
         if (savePerturbation != 50) {
           if (CoinAbs(value) <= primalTolerance_)
-            value = 0.0;
+            value = FloatConst::Zero;
           if (lowerValue > TOO_SMALL_FLOAT && lowerValue)
-            lowerValue -= value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
+            lowerValue -= value * (CoinMax(FloatConst::OneEm2, FloatConst::OneEm5 * CoinAbs(lowerValue)));
           if (upperValue < TOO_BIG_FLOAT && upperValue)
-            upperValue += value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(upperValue)));
+            upperValue += value * (CoinMax(FloatConst::OneEm2, FloatConst::OneEm5 * CoinAbs(upperValue)));
         } else if (value) {
-          FloatT valueL = value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
+          FloatT valueL = value * (CoinMax(FloatConst::OneEm2, FloatConst::OneEm5 * CoinAbs(lowerValue)));
           // get in range
           if (valueL <= tolerance) {
             valueL *= 10.0;
@@ -2855,7 +2861,7 @@ void ClpSimplexPrimal::perturb(int type)
           }
           if (lowerValue > TOO_SMALL_FLOAT && lowerValue)
             lowerValue -= valueL;
-          FloatT valueU = value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(upperValue)));
+          FloatT valueU = value * (CoinMax(FloatConst::OneEm2, FloatConst::OneEm5 * CoinAbs(upperValue)));
           // get in range
           if (valueU <= tolerance) {
             valueU *= 10.0;
@@ -2869,10 +2875,10 @@ void ClpSimplexPrimal::perturb(int type)
           if (upperValue < TOO_BIG_FLOAT && upperValue)
             upperValue += valueU;
         }
-      } else if (upperValue > 0.0) {
+      } else if (upperValue > FloatConst::Zero) {
         //upperValue -= value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
         // lowerValue -= value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
-      } else if (upperValue < 0.0) {
+      } else if (upperValue < FloatConst::Zero) {
         // upperValue += value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
         // lowerValue += value * (CoinMax(1.0e-2, 1.0e-5 * CoinAbs(lowerValue)));
       } else {
@@ -2958,7 +2964,7 @@ int ClpSimplexPrimal::unflag()
   int numberFlagged = 0;
   // we can't really trust infeasibilities if there is dual error
   // allow tolerance bigger than standard to check on duals
-  FloatT relaxedToleranceD = dualTolerance_ + CoinMin(1.0e-2, 10.0 * largestDualError_);
+  FloatT relaxedToleranceD = dualTolerance_ + CoinMin(FloatConst::OneEm2, 10.0 * largestDualError_);
   for (i = 0; i < number; i++) {
     if (flagged(i)) {
       clearFlagged(i);
@@ -3091,7 +3097,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
                               int iPivot = pivotVariable_[iRow];
                               djval -= alpha * cost_[iPivot];
                          }
-                         FloatT comp = 1.0e-8 + 1.0e-7 * (CoinMax(CoinAbs(dj_[iSeq]), CoinAbs(djval)));
+                         FloatT comp = FloatConst::OneEm8 + FloatConst::OneEm7 * (CoinMax(CoinAbs(dj_[iSeq]), CoinAbs(djval)));
                          if (CoinAbs(djval - dj_[iSeq]) > comp)
                               printf("Bad dj %g for %d - true is %g\n",
                                      dj_[iSeq], iSeq, djval);
@@ -3139,14 +3145,14 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
     if (ifValuesPass) {
       saveDj = dualIn_;
       //assert (CoinAbs(alpha_)>=1.0e-5||(objective_->type()<2||!objective_->activated())||pivotRow_==-2);
-      if (pivotRow_ == -1 || (pivotRow_ >= 0 && CoinAbs(alpha_) < 1.0e-5)) {
+      if (pivotRow_ == -1 || (pivotRow_ >= 0 && CoinAbs(alpha_) < FloatConst::OneEm5)) {
         if (CoinAbs(dualIn_) < 1.0e2 * dualTolerance_ && objective_->type() < 2) {
           // try other way
           directionIn_ = -directionIn_;
           primalRow(rowArray_[1], rowArray_[3], rowArray_[2],
             0);
         }
-        if (pivotRow_ == -1 || (pivotRow_ >= 0 && CoinAbs(alpha_) < 1.0e-5)) {
+        if (pivotRow_ == -1 || (pivotRow_ >= 0 && CoinAbs(alpha_) < FloatConst::OneEm5)) {
           if (solveType_ == 1) {
             // reject it
             char x = isColumn(sequenceIn_) ? 'C' : 'R';
@@ -3171,21 +3177,21 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
     // ? when can I clear stuff
     // Clean up any gub stuff
     matrix_->extendUpdated(this, rowArray_[1], 1);
-    FloatT checkValue = 1.0e-2;
-    if (largestDualError_ > 1.0e-5)
+    FloatT checkValue = FloatConst::OneEm2;
+    if (largestDualError_ > FloatConst::OneEm5)
       checkValue = 1.0e-1;
     FloatT test2 = dualTolerance_;
     FloatT test1 = 1.0e-20;
 #if 0 //def FEB_TRY
           if (factorization_->pivots() < 1) {
-               test1 = -1.0e-4;
-               if ((saveDj < 0.0 && dualIn_ < -1.0e-5 * dualTolerance_) ||
-                         (saveDj > 0.0 && dualIn_ > 1.0e-5 * dualTolerance_))
-                    test2 = 0.0; // allow through
+               test1 = -FloatConst::OneEm4;
+               if ((saveDj < FloatConst::Zero && dualIn_ < -FloatConst::OneEm5 * dualTolerance_) ||
+                         (saveDj > FloatConst::Zero && dualIn_ > FloatConst::OneEm5 * dualTolerance_))
+                    test2 = FloatConst::Zero; // allow through
           }
 #endif
     if (!ifValuesPass && solveType_ == 1 && (saveDj * dualIn_ < test1 || CoinAbs(saveDj - dualIn_) > checkValue * (1.0 + CoinAbs(saveDj)) || CoinAbs(dualIn_) < test2)) {
-      if (!(saveDj * dualIn_ > 0.0 && CoinMin(CoinAbs(saveDj), CoinAbs(dualIn_)) > 1.0e5)) {
+      if (!(saveDj * dualIn_ > FloatConst::Zero && CoinMin(CoinAbs(saveDj), CoinAbs(dualIn_)) > 1.0e5)) {
         char x = isColumn(sequenceIn_) ? 'C' : 'R';
         handler_->message(CLP_PRIMAL_DJ, messages_)
           << x << sequenceWithin(sequenceIn_)
@@ -3204,7 +3210,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
           break;
         } else {
           // take on more relaxed criterion
-          if ((saveDj * dualIn_ < test1 || CoinAbs(saveDj - dualIn_) > 2.0e-1 * (1.0 + CoinAbs(dualIn_)) || CoinAbs(dualIn_) < test2) && (CoinAbs(saveDj) > CoinAbs(dualIn_) || saveDj * dualIn_ < 1.0e-4 || factorization_->pivots())) {
+          if ((saveDj * dualIn_ < test1 || CoinAbs(saveDj - dualIn_) > 2.0e-1 * (1.0 + CoinAbs(dualIn_)) || CoinAbs(dualIn_) < test2) && (CoinAbs(saveDj) > CoinAbs(dualIn_) || saveDj * dualIn_ < FloatConst::OneEm4 || factorization_->pivots())) {
             // need to reject something
             char x = isColumn(sequenceIn_) ? 'C' : 'R';
             handler_->message(CLP_SIMPLEX_FLAG, messages_)
@@ -3265,7 +3271,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
         //int i;
 
         //alpha_ = rowArray_[1]->denseVector()[pivotRow_];
-        CoinAssert(CoinAbs(alpha_) > 1.0e-12);
+        CoinAssert(CoinAbs(alpha_) > FloatConst::OneEm12);
         FloatT multiplier = dualIn_ / alpha_;
 #ifndef NDEBUG
         rowArray_[0]->checkClear();
@@ -3290,7 +3296,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
           int ii = index[i];
           dj_[ii] += element[ii];
           reducedCost_[ii] = dj_[ii];
-          element[ii] = 0.0;
+          element[ii] = FloatConst::Zero;
         }
         columnArray_[0]->setNumElements(0);
         // and row djs
@@ -3301,7 +3307,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
           int ii = index[i];
           dj_[ii + numberColumns_] += element[ii];
           dual_[ii] = dj_[ii + numberColumns_];
-          element[ii] = 0.0;
+          element[ii] = FloatConst::Zero;
         }
         rowArray_[0]->setNumElements(0);
         // check incoming
@@ -3320,7 +3326,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
           (moreSpecialOptions_ & 16) != 0);
 
       // if no pivots, bad update but reasonable alpha - take and invert
-      if (updateStatus == 2 && lastGoodIteration_ == numberIterations_ && CoinAbs(alpha_) > 1.0e-5)
+      if (updateStatus == 2 && lastGoodIteration_ == numberIterations_ && CoinAbs(alpha_) > FloatConst::OneEm5)
         updateStatus = 4;
       if (updateStatus == 1 || updateStatus == 4) {
         // slight error
@@ -3375,7 +3381,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
       } else if (updateStatus == 3) {
         // out of memory
         // increase space if not many iterations
-        if (factorization_->pivots() < 0.5 * factorization_->maximumPivots() && factorization_->pivots() < 200)
+        if (factorization_->pivots() < FloatConst::Half * factorization_->maximumPivots() && factorization_->pivots() < 200)
           factorization_->areaFactor(
             factorization_->areaFactor() * 1.1);
         returnCode = -2; // factorize now
@@ -3389,7 +3395,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
       if (pivotRow_ == -1) {
         // no outgoing row is valid
         if (valueOut_ != COIN_DBL_MAX) {
-          FloatT objectiveChange = 0.0;
+          FloatT objectiveChange = FloatConst::Zero;
           theta_ = valueOut_ - valueIn_;
           updatePrimalsInPrimal(rowArray_[1], theta_, objectiveChange, ifValuesPass);
           solution_[sequenceIn_] += theta_;
@@ -3416,7 +3422,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
           }
         }
 #endif
-        if (!factorization_->pivots() && acceptablePivot_ <= 1.0e-8) {
+        if (!factorization_->pivots() && acceptablePivot_ <= FloatConst::OneEm8) {
           returnCode = 2; //say looks unbounded
           // do ray
           if (!nonLinearCost_->sumInfeasibilities())
@@ -3432,7 +3438,7 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
           roundAgain = true;
           continue;
         } else {
-          acceptablePivot_ = 1.0e-8;
+          acceptablePivot_ = FloatConst::OneEm8;
           returnCode = 4; //say looks unbounded but has iterated
         }
         break;
@@ -3441,21 +3447,21 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
       }
     }
 
-    FloatT oldCost = 0.0;
+    FloatT oldCost = FloatConst::Zero;
     if (sequenceOut_ >= 0)
       oldCost = cost_[sequenceOut_];
     // update primal solution
 
-    FloatT objectiveChange = 0.0;
+    FloatT objectiveChange = FloatConst::Zero;
     // after this rowArray_[1] is not empty - used to update djs
     // If pivot row >= numberRows then may be gub
     int savePivot = pivotRow_;
     if (pivotRow_ >= numberRows_)
       pivotRow_ = -1;
 #ifdef CLP_USER_DRIVEN
-    if (theta_ < 0.0) {
-      if (theta_ >= -1.0e-12)
-        theta_ = 0.0;
+    if (theta_ < FloatConst::Zero) {
+      if (theta_ >= -FloatConst::OneEm12)
+        theta_ = FloatConst::Zero;
       //else
       //printf("negative theta %g\n",theta_);
     }
@@ -3580,7 +3586,7 @@ void ClpSimplexPrimal::primalRay(CoinIndexedVector *rowArray)
   FloatT *array = rowArray->denseVector();
   FloatT way = -directionIn_;
   int i;
-  FloatT zeroTolerance = 1.0e-12;
+  FloatT zeroTolerance = FloatConst::OneEm12;
   if (sequenceIn_ < numberColumns_)
     ray_[sequenceIn_] = directionIn_;
   if (!rowArray->packedMode()) {
@@ -3777,9 +3783,9 @@ int ClpSimplexPrimal::lexSolve()
       if (handler_->logLevel() > 2) {
         handler_->message(CLP_SIMPLEX_STATUS, messages_)
           << numberIterations_ << objectiveValue();
-        handler_->printing(sumPrimalInfeasibilities_ > 0.0)
+        handler_->printing(sumPrimalInfeasibilities_ > FloatConst::Zero)
           << sumPrimalInfeasibilities_ << numberPrimalInfeasibilities_;
-        handler_->printing(sumDualInfeasibilities_ > 0.0)
+        handler_->printing(sumDualInfeasibilities_ > FloatConst::Zero)
           << sumDualInfeasibilities_ << numberDualInfeasibilities_;
         handler_->printing(numberDualInfeasibilitiesWithoutFree_
           < numberDualInfeasibilities_)
@@ -3866,7 +3872,7 @@ int ClpSimplexPrimal::lexSolve()
           if (!numberPrimalInfeasibilities_)
             initialNegDjs = numberDualInfeasibilities_;
           // make sure weight won't be changed
-          if (infeasibilityCost_ == 1.0e10)
+          if (infeasibilityCost_ == FloatConst::OneE10)
             infeasibilityCost_ = 1.000001e10;
         }
       }
@@ -3898,21 +3904,21 @@ int ClpSimplexPrimal::lexSolve()
         int *whichColumns = new int[numberColumns_];
         FloatT *weight = new FloatT[numberColumns_];
         int numberNegative = 0;
-        FloatT sumNegative = 0.0;
+        FloatT sumNegative = FloatConst::Zero;
         // now massage weight so all basic in plus good djs
         for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
           FloatT dj = dj_[iColumn];
           switch (getColumnStatus(iColumn)) {
 
           case basic:
-            dj = -1.0e50;
+            dj = -FloatConst::OneE50;
             numberBasic++;
             break;
           case atUpperBound:
             dj = -dj;
             break;
           case isFixed:
-            dj = 1.0e50;
+            dj = FloatConst::OneE50;
             numberFixed++;
             break;
           case atLowerBound:
@@ -3925,7 +3931,7 @@ int ClpSimplexPrimal::lexSolve()
             dj = -100.0 * CoinAbs(dj);
             break;
           }
-          if (dj < -dualTolerance_ && dj > -1.0e50) {
+          if (dj < -dualTolerance_ && dj > -FloatConst::OneE50) {
             numberNegative++;
             sumNegative -= dj;
           }
@@ -3938,7 +3944,7 @@ int ClpSimplexPrimal::lexSolve()
           << CoinMessageEol;
         sprintPass++;
         lastSprintIteration = numberIterations_;
-        if (objectiveValue() * optimizationDirection_ > lastObjectiveValue - 1.0e-7 && sprintPass > 5) {
+        if (objectiveValue() * optimizationDirection_ > lastObjectiveValue - FloatConst::OneEm7 && sprintPass > 5) {
           // switch off
           COIN_DETAIL_PRINT(printf("Switching off sprint\n"));
           primalColumnPivot_->switchOffSprint();
@@ -3974,25 +3980,25 @@ int ClpSimplexPrimal::lexSolve()
           int numberDegen = 0;
           int numberTotal = numberColumns_; //+numberRows_;
           for (int i = 0; i < numberTotal; i++) {
-            cost_[i] = 0.0;
+            cost_[i] = FloatConst::Zero;
             if (getStatus(i) == atLowerBound) {
               if (dj_[i] <= dualTolerance_) {
-                cost_[i] = numberTotal - i + randomNumberGenerator_.randomDouble() * 0.5;
+                cost_[i] = numberTotal - i + randomNumberGenerator_.randomDouble() * FloatConst::Half;
                 numberDegen++;
               } else {
                 // fix
-                cost_[i] = 1.0e10; //upper_[i]=lower_[i];
+                cost_[i] = FloatConst::OneE10; //upper_[i]=lower_[i];
               }
             } else if (getStatus(i) == atUpperBound) {
               if (dj_[i] >= -dualTolerance_) {
-                cost_[i] = (numberTotal - i) + randomNumberGenerator_.randomDouble() * 0.5;
+                cost_[i] = (numberTotal - i) + randomNumberGenerator_.randomDouble() * FloatConst::Half;
                 numberDegen++;
               } else {
                 // fix
-                cost_[i] = -1.0e10; //lower_[i]=upper_[i];
+                cost_[i] = -FloatConst::OneE10; //lower_[i]=upper_[i];
               }
             } else if (getStatus(i) == basic) {
-              cost_[i] = (numberTotal - i) + randomNumberGenerator_.randomDouble() * 0.5;
+              cost_[i] = (numberTotal - i) + randomNumberGenerator_.randomDouble() * FloatConst::Half;
             }
           }
           problemStatus_ = -1;
@@ -4055,9 +4061,9 @@ int ClpSimplexPrimal::lexSolve()
   assert(!originalCost);
   // if infeasible get real values
   //printf("XXXXY final cost %g\n",infeasibilityCost_);
-  progress_.initialWeight_ = 0.0;
+  progress_.initialWeight_ = FloatConst::Zero;
   if (problemStatus_ == 1 && secondaryStatus_ != 6) {
-    infeasibilityCost_ = 0.0;
+    infeasibilityCost_ = FloatConst::Zero;
     createRim(1 + 4);
     nonLinearCost_->checkInfeasibilities(0.0);
     sumPrimalInfeasibilities_ = nonLinearCost_->sumInfeasibilities();
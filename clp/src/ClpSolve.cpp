@@ -6,6 +6,7 @@
 // This file has higher level solve functions
 
 #include "CoinPragma.hpp"
+#include "CoinProfile.hpp"
 #include "ClpConfig.h"
 
 // check already here if COIN_HAS_GLPK is defined, since we do not want to get confused by a COIN_HAS_GLPK in config_coinutils.h
@@ -354,16 +355,17 @@ solveWithVolume(ClpSimplex *model, int numberPasses, int doIdiot)
   return 0;
 }
 #endif
-static ClpInterior *currentModel2 = NULL;
+static thread_local ClpInterior *currentModel2 = NULL;
 #endif
 //#############################################################################
 // Allow for interrupts
-// But is this threadsafe ? (so switched off by option)
+// The model being solved is per thread, so SIGINT stops the solve running on the
+// thread that receives the signal (the main one, unless it is blocked there)
 
 #include "CoinSignal.hpp"
-static ClpSimplex *currentModel = NULL;
+static thread_local ClpSimplex *currentModel = NULL;
 #ifdef ABC_INHERIT
-static AbcSimplex *currentAbcModel = NULL;
+static thread_local AbcSimplex *currentAbcModel = NULL;
 #endif
 
 extern "C" {
@@ -847,6 +849,7 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
  */
 int ClpSimplex::initialSolve(ClpSolve &options)
 {
+  COIN_PROFILE_REGION("initialSolve");
   ClpSolve::SolveType method = options.getSolveType();
   //ClpSolve::SolveType originalMethod=method;
   ClpSolve::PresolveType presolve = options.getPresolveType();
@@ -3741,6 +3744,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       setLogLevel(CoinMin(1, saveLevel));
     else
       setLogLevel(CoinMin(0, saveLevel));
+    eventHandler()->event(ClpEventHandler::presolveAfterSolve);
     pinfo->postsolve(true);
     numberIterations_ = 0;
     delete pinfo;
@@ -0,0 +1,113 @@
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpSolveStats_H
+#define ClpSolveStats_H
+
+#include "CoinProfile.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+/** Time spent in the simplex kernels, for callers that report solve statistics.
+
+    The kernels open a Timer for their whole body. Nothing is measured unless the calling
+    thread collects: a Collect object installs its Totals for as long as it lives, so a Timer
+    costs one thread local load when nobody is interested. Times are inclusive; the pricing
+    of steepest edge contains the FTRAN and BTRAN of its weight updates, for instance.
+    Builds with COIN_PROFILE also open a CoinProfile region named after the kernel.
+ */
+class ClpSolveStats {
+public:
+  enum Kernel {
+    factorize = 0,
+    ftran,
+    btran,
+    pricing,
+    ratioTest,
+    numberKernels
+  };
+
+  /// Region names of the kernels in CoinProfile
+  static const char *name(Kernel kernel)
+  {
+    static const char *const names[numberKernels] = { "factorize", "ftran", "btran", "pricing", "ratioTest" };
+    return names[kernel];
+  }
+
+  struct Totals {
+    int64_t nanoseconds[numberKernels] = {};
+    int64_t calls[numberKernels] = {};
+    /// Timers open on each kernel, those nested in another one of theirs are not counted
+    int open[numberKernels] = {};
+    /// Elements of L and U left by the last factorization (CoinFactorization only)
+    int64_t lElements = 0;
+    int64_t uElements = 0;
+  };
+
+  /// Totals of the Collect innermost on this thread, NULL when nothing is collected
+  static Totals *current()
+  {
+    return current_;
+  }
+
+  /// Collects the kernel times of this thread into totals while it lives
+  class Collect {
+  public:
+    explicit Collect(Totals *totals)
+      : previous_(current_)
+    {
+      current_ = totals;
+    }
+    ~Collect()
+    {
+      current_ = previous_;
+    }
+    Collect(const Collect &) = delete;
+    Collect &operator=(const Collect &) = delete;
+
+  private:
+    Totals *previous_;
+  };
+
+  /// Adds the time from its construction to its destruction to a kernel
+  class Timer {
+  public:
+    explicit Timer(Kernel kernel)
+      : totals_(current_)
+      , kernel_(kernel)
+      , outer_(totals_ && !totals_->open[kernel_])
+    {
+      if (totals_)
+        totals_->open[kernel_]++;
+      if (outer_)
+        start_ = std::chrono::steady_clock::now();
+    }
+    ~Timer()
+    {
+      if (!totals_)
+        return;
+      totals_->open[kernel_]--;
+      if (outer_) {
+        // integer durations only, floatdef.h specializes std::common_type<T, double>
+        totals_->nanoseconds[kernel_] += std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start_).count();
+        totals_->calls[kernel_]++;
+      }
+    }
+    Timer(const Timer &) = delete;
+    Timer &operator=(const Timer &) = delete;
+
+  private:
+    Totals *totals_;
+    Kernel kernel_;
+    bool outer_;
+#ifdef COIN_PROFILE
+    CoinProfile::Region region_ { name(kernel_) };
+#endif
+    std::chrono::steady_clock::time_point start_;
+  };
+
+private:
+  static inline thread_local Totals *current_ = NULL;
+};
+
+#endif
@@ -0,0 +1,129 @@
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+#include "ClpTaskPool.hpp"
+
+#ifdef CLP_THREADS
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if ABOCA_LITE
+// number of blocks the kernels are split into, 0 for sequential
+int abcState_ = 0;
+#endif
+
+namespace {
+struct TaskQueue {
+  std::mutex mutex;
+  std::condition_variable wakeWorkers;
+  std::condition_variable allDone;
+  std::deque< std::function< void() > > tasks;
+  std::vector< std::thread > workers;
+  int pending = 0;
+  int threads = 1;
+};
+
+TaskQueue &queue()
+{
+  // never destroyed, workers are detached and may still wait on it at exit
+  static TaskQueue *taskQueue = new TaskQueue;
+  return *taskQueue;
+}
+
+// Runs one queued task, lock is held on entry and on return
+void runOne(std::unique_lock< std::mutex > &lock)
+{
+  TaskQueue &q = queue();
+  std::function< void() > task = std::move(q.tasks.front());
+  q.tasks.pop_front();
+  lock.unlock();
+  task();
+  lock.lock();
+  if (--q.pending == 0)
+    q.allDone.notify_all();
+}
+
+void workerLoop()
+{
+  TaskQueue &q = queue();
+  std::unique_lock< std::mutex > lock(q.mutex);
+  for (;;) {
+    q.wakeWorkers.wait(lock, [&q] { return !q.tasks.empty(); });
+    runOne(lock);
+  }
+}
+} // namespace
+
+int ClpTaskPool::setThreads(int numberThreads)
+{
+#if ABOCA_LITE
+  if (numberThreads > ABOCA_LITE)
+    numberThreads = ABOCA_LITE;
+#endif
+  if (numberThreads < 1)
+    numberThreads = 1;
+  TaskQueue &q = queue();
+  std::unique_lock< std::mutex > lock(q.mutex);
+  while (static_cast< int >(q.workers.size()) < numberThreads - 1) {
+    q.workers.emplace_back(workerLoop);
+    q.workers.back().detach();
+  }
+  q.threads = numberThreads;
+#if ABOCA_LITE
+  abcState_ = numberThreads > 1 ? numberThreads : 0;
+#endif
+  return numberThreads;
+}
+
+int ClpTaskPool::threads()
+{
+  TaskQueue &q = queue();
+  std::unique_lock< std::mutex > lock(q.mutex);
+  return q.threads;
+}
+
+void ClpTaskPool::spawn(std::function< void() > task)
+{
+  TaskQueue &q = queue();
+  {
+    std::unique_lock< std::mutex > lock(q.mutex);
+    q.tasks.push_back(std::move(task));
+    ++q.pending;
+  }
+  q.wakeWorkers.notify_one();
+}
+
+void ClpTaskPool::sync()
+{
+  TaskQueue &q = queue();
+  std::unique_lock< std::mutex > lock(q.mutex);
+  while (q.pending) {
+    if (!q.tasks.empty())
+      runOne(lock);
+    else
+      q.allDone.wait(lock);
+  }
+}
+#else
+int ClpTaskPool::setThreads(int)
+{
+  return 1;
+}
+
+int ClpTaskPool::threads()
+{
+  return 1;
+}
+
+void ClpTaskPool::spawn(std::function< void() > task)
+{
+  task();
+}
+
+void ClpTaskPool::sync()
+{
+}
+#endif
@@ -0,0 +1,39 @@
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpTaskPool_H
+#define ClpTaskPool_H
+
+#include <functional>
+
+/** Fork-join pool used by the ABOCA_LITE kernels (matrix pricing, dual ratio test,
+    steepest edge) when libclp is built with CLP_THREADS, in place of cilk_spawn/cilk_sync.
+
+    Worker threads are started by setThreads() and kept for the life of the process.
+    sync() runs queued tasks on the calling thread too, so with n threads the caller
+    and n-1 workers share the kernel blocks.
+ */
+class ClpTaskPool {
+public:
+  /// Splits the kernels over numberThreads threads (1 or less is sequential), returns the value used
+  static int setThreads(int numberThreads);
+  /// Threads the kernels are split over
+  static int threads();
+  /// Queues a task
+  static void spawn(std::function< void() > task);
+  /// Returns when every queued task has finished
+  static void sync();
+};
+
+#ifdef CLP_THREADS
+#define clp_spawn(fn, arg)                                   \
+  {                                                          \
+    auto *clpSpawnArg = &(arg);                              \
+    ClpTaskPool::spawn([clpSpawnArg] { fn(*clpSpawnArg); }); \
+  }
+#define clp_sync ClpTaskPool::sync()
+#else
+#define clp_spawn(fn, arg) cilk_spawn fn(arg)
+#define clp_sync cilk_sync
+#endif
+
+#endif
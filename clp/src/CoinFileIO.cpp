@@ -94,8 +94,14 @@ char *CoinPlainFileInput::gets(char *buffer, int size)
   if (f_) {
     return fgets(buffer, size, f_);
   } else if (is_) {
-    is_->getline(buffer, size);
-    return is_->bad() ? nullptr : buffer;
+    if (!is_->getline(buffer, size)) {
+      // nothing left to read; otherwise a line longer than the buffer, whose first part
+      // is returned like fgets does
+      if (is_->bad() || is_->gcount() == 0)
+        return nullptr;
+      is_->clear();
+    }
+    return buffer;
   }
   return nullptr;
 }
@@ -892,11 +892,14 @@ T *CoinDeleteEntriesFromArray(T *arrayFirst, T *arrayLast,
   Set \p isSeed to true and supply an integer seed to set the seed
   (vid. #CoinSeedRandom)
 
+  The state is per thread, so models solved concurrently do not perturb each
+  other's sequences.
+
   \todo Anyone want to volunteer an upgrade for 64-bit architectures?
 */
 inline FloatT CoinDrand48(bool isSeed = false, unsigned int seed = 1)
 {
-  static unsigned int last = 123456;
+  static thread_local unsigned int last = 123456;
   if (isSeed) {
     last = seed;
   } else {
@@ -15,6 +15,7 @@
 #include "CoinFloatEqual.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinIndexedVector.hpp"
+#include "CoinSimd128.hpp"
 #include "CoinTypes.hpp"
 //#############################################################################
 #define WARN_USELESS 0
@@ -1531,9 +1532,9 @@ int CoinIndexedVector::scan(int start, int end)
   int i;
   int number = 0;
   int *indices = indices_ + nElements_;
-  for (i = start; i < end; i++)
-    if (elements_[i])
-      indices[number++] = i;
+  for (i = CoinSimdNextNonZero(elements_, start, end); i < end;
+       i = CoinSimdNextNonZero(elements_, i + 1, end))
+    indices[number++] = i;
   nElements_ += number;
   return number;
 }
@@ -1560,14 +1561,12 @@ int CoinIndexedVector::scan(int start, int end, FloatT tolerance)
   int i;
   int number = 0;
   int *indices = indices_ + nElements_;
-  for (i = start; i < end; i++) {
-    FloatT value = elements_[i];
-    if (value) {
-      if (CoinAbs(value) >= tolerance)
-        indices[number++] = i;
-      else
-        elements_[i] = 0.0;
-    }
+  for (i = CoinSimdNextNonZero(elements_, start, end); i < end;
+       i = CoinSimdNextNonZero(elements_, i + 1, end)) {
+    if (CoinAbs(elements_[i]) >= tolerance)
+      indices[number++] = i;
+    else
+      elements_[i] = 0.0;
   }
   nElements_ += number;
   return number;
@@ -1651,13 +1650,12 @@ int CoinIndexedVector::scanAndPack(int start, int end)
   int i;
   int number = 0;
   int *indices = indices_ + nElements_;
-  for (i = start; i < end; i++) {
+  for (i = CoinSimdNextNonZero(elements_, start, end); i < end;
+       i = CoinSimdNextNonZero(elements_, i + 1, end)) {
     FloatT value = elements_[i];
     elements_[i] = 0.0;
-    if (value) {
-      elements_[number] = value;
-      indices[number++] = i;
-    }
+    elements_[number] = value;
+    indices[number++] = i;
   }
   nElements_ += number;
   packedMode_ = true;
@@ -1678,7 +1676,8 @@ int CoinIndexedVector::scanAndPack(int start, int end, FloatT tolerance)
   int i;
   int number = 0;
   int *indices = indices_ + nElements_;
-  for (i = start; i < end; i++) {
+  for (i = CoinSimdNextNonZero(elements_, start, end); i < end;
+       i = CoinSimdNextNonZero(elements_, i + 1, end)) {
     FloatT value = elements_[i];
     elements_[i] = 0.0;
     if (CoinAbs(value) >= tolerance) {
@@ -12,6 +12,7 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "CoinUtilsConfig.h"
+#include "CoinProfile.hpp"
 
 #include <cmath>
 #include <cfloat>
@@ -1604,7 +1605,7 @@ int CoinLpIO::read_monom_obj(FloatT *coeff, char **name, int *cnt,
   }
 
   if (first_is_number(start)) {
-    coeff[*cnt] = FloatT(start);
+    coeff[*cnt] = toFloat(start);
     sprintf(loc_name, "aa");
     fscanfLpIO(loc_name);
   } else {
@@ -1679,7 +1680,7 @@ int CoinLpIO::read_monom_row(char *start_str,
   }
 
   if (first_is_number(start)) {
-    coeff[cnt_coeff] = FloatT(start);
+    coeff[cnt_coeff] = toFloat(start);
     fscanfLpIO(loc_name);
   } else {
     coeff[cnt_coeff] = 1;
@@ -1783,7 +1784,7 @@ void CoinLpIO::read_row(char *buff,
   }
   (*cnt_coeff)--;
 
-  rhs[*cnt_row] = FloatT(start_str);
+  rhs[*cnt_row] = toFloat(start_str);
 
   switch (read_sense) {
   case 0:
@@ -1907,6 +1908,7 @@ void CoinLpIO::readLp(FILE *fp)
 /*************************************************************************/
 void CoinLpIO::readLp()
 {
+  COIN_PROFILE_REGION("readLp");
 
   int maxrow = 1000;
   int maxcoeff = 40000;
@@ -2037,7 +2039,7 @@ void CoinLpIO::readLp()
 
         int scan_sense = 0;
         if (first_is_number(start_str)) {
-          bnd1 = mult * FloatT(start_str);
+          bnd1 = mult * toFloat(start_str);
           scan_sense = 1;
         } else {
           if (is_inf(start_str)) {
@@ -2090,7 +2092,7 @@ void CoinLpIO::readLp()
               }
             }
             if (first_is_number(start_str)) {
-              bnd2 = mult * FloatT(start_str);
+              bnd2 = mult * toFloat(start_str);
               fscanfLpIO(buff);
             } else {
               if (is_inf(start_str)) {
@@ -2380,7 +2382,7 @@ void CoinLpIO::readLp()
                       next = buff - 1;
                     }
                   }
-                  FloatT value = FloatT(next + 1);
+                  FloatT value = toFloat(next + 1);
                   if (numberEntries == maxEntries) {
                     maxEntries = 2 * maxEntries;
                     FloatT *tempD = new FloatT[maxEntries];
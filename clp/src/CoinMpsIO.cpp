@@ -9,6 +9,7 @@
 #endif
 
 #include "CoinUtilsConfig.h"
+#include "CoinProfile.hpp"
 
 #include <cassert>
 #include <cstdlib>
@@ -1564,6 +1565,7 @@ int CoinMpsIO::readMps()
 }
 int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
 {
+  COIN_PROFILE_REGION("readMps");
   bool ifmps;
 
   cardReader_->readToNextSection();
@@ -2590,7 +2592,7 @@ int CoinMpsIO::readMps(int &numberSets, CoinSet **&sets)
           //integerType_[icolumn]=2;
           FloatT value = cardReader_->value();
           if (value == -1.0e100)
-            value = FloatT(cardReader_->rowName()); // try from row name
+            value = toFloat(cardReader_->rowName()); // try from row name
           which[numberInSet] = icolumn;
           weights[numberInSet++] = value;
         } else {
@@ -3349,7 +3351,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         // bound
         char *next = strchr(dot + 1, '=');
         assert(next);
-        FloatT value = FloatT(next + 1);
+        FloatT value = toFloat(next + 1);
         if (!strncmp(dot + 1, "fx", 2)) {
           collower_[iColumn] = value;
           colupper_[iColumn] = value;
@@ -3373,7 +3375,7 @@ int CoinMpsIO::readGms(int & /*numberSets*/, CoinSet **& /*sets*/)
         // bound
         next = strchr(dot + 1, '=');
         assert(next);
-        FloatT value = FloatT(next + 1);
+        FloatT value = toFloat(next + 1);
         if (!strncmp(dot + 1, "fx", 2)) {
           collower_[iColumn] = value;
           abort();
@@ -32,9 +32,9 @@ namespace {
 	    that'll request it. That's the purpose of pendingVal.
 */
 
-int cmdField = 1;
-FILE *readSrc = stdin;
-std::string pendingVal = "";
+thread_local int cmdField = 1;
+thread_local FILE *readSrc = stdin;
+thread_local std::string pendingVal = "";
 
 /*
   Get next command or field in command. When in interactive mode, prompt the
@@ -42,8 +42,8 @@ std::string pendingVal = "";
 */
 std::string nextField(const char *prompt)
 {
-  static char line[1000];
-  static char *where = NULL;
+  static thread_local char line[1000];
+  static thread_local char *where = NULL;
   std::string field;
   const char *dflt_prompt = "Eh? ";
 
@@ -557,7 +557,7 @@ FloatT getDoubleField(int argc, const char *argv[], int *valid)
   FloatT value = 0.0;
   errno = 0;
   if (field != "EOL") {
-    value = FloatT(field);
+    value = toFloat(field);
   }
 
   if (valid != 0) {
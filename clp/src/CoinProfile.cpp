@@ -0,0 +1,205 @@
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+#include "CoinProfile.hpp"
+#include "CoinTime.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+struct CoinProfileNode {
+  CoinProfileNode(const char *nodeName, CoinProfileNode *parentNode)
+    : name(nodeName)
+    , parent(parentNode)
+  {
+  }
+  const char *name;
+  CoinProfileNode *parent;
+  std::vector< std::unique_ptr< CoinProfileNode > > children;
+  int64_t calls = 0;
+  int64_t totalNs = 0;
+  int64_t startNs = 0;
+#ifdef CLP_FLOAT_COUNTED
+  // FloatT operations run in the region itself
+  int64_t ops[FloatCount::OP_COUNT] = {};
+#endif
+};
+
+struct CoinProfileThread {
+  CoinProfileNode root { "", NULL };
+  CoinProfileNode *current = &root;
+};
+
+struct CoinProfileRegistry {
+  std::mutex mutex;
+  // kept after their threads exit, so that their regions still count
+  std::vector< std::shared_ptr< CoinProfileThread > > threads;
+};
+
+CoinProfileRegistry &coinProfileRegistry()
+{
+  static CoinProfileRegistry *registry = new CoinProfileRegistry;
+  return *registry;
+}
+
+CoinProfileThread &coinProfileThread()
+{
+  thread_local std::shared_ptr< CoinProfileThread > profile = [] {
+    std::shared_ptr< CoinProfileThread > newProfile = std::make_shared< CoinProfileThread >();
+    CoinProfileRegistry &registry = coinProfileRegistry();
+    std::lock_guard< std::mutex > lock(registry.mutex);
+    registry.threads.push_back(newProfile);
+    return newProfile;
+  }();
+  return *profile;
+}
+
+struct CoinProfileTotals {
+  int64_t calls = 0;
+  int64_t totalNs = 0;
+  int64_t selfNs = 0;
+#ifdef CLP_FLOAT_COUNTED
+  int64_t ops[FloatCount::OP_COUNT] = {};
+#endif
+};
+
+void coinProfileMerge(const CoinProfileNode &node, const std::string &path,
+  std::map< std::string, CoinProfileTotals > &totals)
+{
+  int64_t childrenNs = 0;
+  for (size_t i = 0; i < node.children.size(); i++)
+    childrenNs += node.children[i]->totalNs;
+  if (node.parent) {
+    CoinProfileTotals &entry = totals[path];
+    entry.calls += node.calls;
+    entry.totalNs += node.totalNs;
+    entry.selfNs += node.totalNs - childrenNs;
+  }
+#ifdef CLP_FLOAT_COUNTED
+  CoinProfileTotals &counted = totals[node.parent ? path : std::string("(no region)")];
+  for (int op = 0; op < FloatCount::OP_COUNT; op++)
+    counted.ops[op] += node.ops[op];
+#endif
+  for (size_t i = 0; i < node.children.size(); i++) {
+    const CoinProfileNode &child = *node.children[i];
+    coinProfileMerge(child, node.parent ? path + ";" + child.name : std::string(child.name), totals);
+  }
+}
+
+std::map< std::string, CoinProfileTotals > coinProfileTotals()
+{
+  std::map< std::string, CoinProfileTotals > totals;
+  CoinProfileRegistry &registry = coinProfileRegistry();
+  std::lock_guard< std::mutex > lock(registry.mutex);
+  for (size_t i = 0; i < registry.threads.size(); i++)
+    coinProfileMerge(registry.threads[i]->root, std::string(), totals);
+  return totals;
+}
+
+void coinProfileReset(CoinProfileNode &node)
+{
+  node.calls = 0;
+  node.totalNs = 0;
+#ifdef CLP_FLOAT_COUNTED
+  for (int op = 0; op < FloatCount::OP_COUNT; op++)
+    node.ops[op] = 0;
+#endif
+  for (size_t i = 0; i < node.children.size(); i++)
+    coinProfileReset(*node.children[i]);
+}
+}
+
+#ifdef CLP_FLOAT_COUNTED
+int64_t *FloatCount::attach()
+{
+  counts = coinProfileThread().current->ops;
+  return counts;
+}
+#endif
+
+void CoinProfile::enter(const char *name)
+{
+  CoinProfileThread &profile = coinProfileThread();
+  CoinProfileNode *parent = profile.current;
+  CoinProfileNode *node = NULL;
+  for (size_t i = 0; i < parent->children.size(); i++) {
+    if (parent->children[i]->name == name) {
+      node = parent->children[i].get();
+      break;
+    }
+  }
+  if (!node) {
+    parent->children.push_back(std::unique_ptr< CoinProfileNode >(new CoinProfileNode(name, parent)));
+    node = parent->children.back().get();
+  }
+  profile.current = node;
+#ifdef CLP_FLOAT_COUNTED
+  FloatCount::counts = node->ops;
+#endif
+  node->startNs = CoinMonotonicNs();
+}
+
+void CoinProfile::leave()
+{
+  const int64_t now = CoinMonotonicNs();
+  CoinProfileThread &profile = coinProfileThread();
+  CoinProfileNode *node = profile.current;
+  node->totalNs += now - node->startNs;
+  node->calls++;
+  profile.current = node->parent;
+#ifdef CLP_FLOAT_COUNTED
+  FloatCount::counts = node->parent->ops;
+#endif
+}
+
+void CoinProfile::writeFolded(std::ostream &out)
+{
+  const std::map< std::string, CoinProfileTotals > totals = coinProfileTotals();
+  for (std::map< std::string, CoinProfileTotals >::const_iterator it = totals.begin(); it != totals.end(); ++it) {
+    if (it->second.selfNs > 0)
+      out << it->first << " " << it->second.selfNs << "\n";
+  }
+}
+
+void CoinProfile::writeSummary(std::ostream &out)
+{
+  const std::map< std::string, CoinProfileTotals > totals = coinProfileTotals();
+  for (std::map< std::string, CoinProfileTotals >::const_iterator it = totals.begin(); it != totals.end(); ++it) {
+    if (!it->second.calls)
+      continue;
+    out << it->first << " " << it->second.calls << " " << static_cast< double >(it->second.totalNs) / 1.0e6
+        << " " << static_cast< double >(it->second.selfNs) / 1.0e6 << "\n";
+  }
+}
+
+void CoinProfile::writeCounts(std::ostream &out)
+{
+#ifdef CLP_FLOAT_COUNTED
+  const std::map< std::string, CoinProfileTotals > totals = coinProfileTotals();
+  for (std::map< std::string, CoinProfileTotals >::const_iterator it = totals.begin(); it != totals.end(); ++it) {
+    int64_t all = 0;
+    for (int op = 0; op < FloatCount::OP_COUNT; op++)
+      all += it->second.ops[op];
+    if (!all)
+      continue;
+    out << it->first;
+    for (int op = 0; op < FloatCount::OP_COUNT; op++)
+      out << " " << it->second.ops[op];
+    out << "\n";
+  }
+#else
+  (void)out;
+#endif
+}
+
+void CoinProfile::reset()
+{
+  CoinProfileRegistry &registry = coinProfileRegistry();
+  std::lock_guard< std::mutex > lock(registry.mutex);
+  for (size_t i = 0; i < registry.threads.size(); i++)
+    coinProfileReset(registry.threads[i]->root);
+}
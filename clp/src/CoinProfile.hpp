@@ -0,0 +1,64 @@
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinProfile_H
+#define CoinProfile_H
+
+#include <cstdint>
+#include <ostream>
+
+/** Hierarchical profile of named regions, timed in integer nanoseconds of CoinMonotonicNs().
+
+    COIN_PROFILE_REGION("name") times the rest of the enclosing scope as a child of the region
+    open around it on the same thread, so every distinct path of regions ("primal;pricing;btran")
+    adds up its calls and time. The macro compiles to nothing unless COIN_PROFILE is defined
+    (the CLP_PROFILE option of CMake), which lets the regions stay in the kernels.
+
+    Each thread records into its own tree, merged by path when the profile is written. write*()
+    and reset() must not run while other threads are inside regions.
+ */
+class CoinProfile {
+public:
+  /// Opens a region for the life of the object. The name is compared by address and must
+  /// outlive the profile, as a string literal does
+  class Region {
+  public:
+    explicit Region(const char *name)
+    {
+      CoinProfile::enter(name);
+    }
+    ~Region()
+    {
+      CoinProfile::leave();
+    }
+    Region(const Region &) = delete;
+    Region &operator=(const Region &) = delete;
+  };
+
+  static void enter(const char *name);
+  static void leave();
+
+  /// Collapsed stacks, one "outer;inner;leaf nanoseconds" line per path with the time spent in
+  /// the leaf itself, as read by flamegraph.pl, inferno or speedscope
+  static void writeFolded(std::ostream &out);
+
+  /// One "path calls totalMs selfMs" line per path, sorted by path
+  static void writeSummary(std::ostream &out);
+
+  /// One "path construct fromDouble fromString add multiply divide compare sqrt" line per path,
+  /// with the FloatT operations run in the region itself and "(no region)" for those outside
+  /// any. Only the CLP_FLOAT_COUNTED engine counts them (floatcount.h), other builds write nothing
+  static void writeCounts(std::ostream &out);
+
+  /// Zeroes the calls, times and operation counts recorded so far
+  static void reset();
+};
+
+#define COIN_PROFILE_CONCAT2(a, b) a##b
+#define COIN_PROFILE_CONCAT(a, b) COIN_PROFILE_CONCAT2(a, b)
+#ifdef COIN_PROFILE
+#define COIN_PROFILE_REGION(name) const CoinProfile::Region COIN_PROFILE_CONCAT(coinProfileRegion, __LINE__)(name)
+#else
+#define COIN_PROFILE_REGION(name) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,176 @@
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinSimd128_H
+#define CoinSimd128_H
+
+#include "CoinHelperFunctions.hpp"
+
+/** Inner loop kernels shared by ClpHelperFunctions, ClpPackedMatrix and CoinIndexedVector.
+
+    When the double engine is compiled for WASM with -msimd128 they work on two doubles
+    per instruction. simd128 has no gather or scatter, so indexed loads and stores go
+    through wasm_f64x2_make and lane extracts while the arithmetic stays vectorized.
+    Every other engine and target gets the scalar loops these kernels replaced, in the
+    same order of operations.
+ */
+
+#if defined(CLP_FLOAT_DOUBLE) && defined(__wasm_simd128__)
+#define COIN_SIMD128 1
+#include <wasm_simd128.h>
+#else
+#define COIN_SIMD128 0
+#endif
+
+/// Sum of pi[row[j]] * element[j] for j < n, a column of the matrix times the duals
+inline FloatT CoinSimdSparseDot(const FloatT *COIN_RESTRICT pi,
+  const int *COIN_RESTRICT row, const FloatT *COIN_RESTRICT element, int n)
+{
+#if COIN_SIMD128
+  v128_t sum0 = wasm_f64x2_splat(0.0);
+  v128_t sum1 = sum0;
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    v128_t pi0 = wasm_f64x2_make(pi[row[j]], pi[row[j + 1]]);
+    v128_t pi1 = wasm_f64x2_make(pi[row[j + 2]], pi[row[j + 3]]);
+    sum0 = wasm_f64x2_add(sum0, wasm_f64x2_mul(pi0, wasm_v128_load(element + j)));
+    sum1 = wasm_f64x2_add(sum1, wasm_f64x2_mul(pi1, wasm_v128_load(element + j + 2)));
+  }
+  if (j + 2 <= n) {
+    v128_t pi0 = wasm_f64x2_make(pi[row[j]], pi[row[j + 1]]);
+    sum0 = wasm_f64x2_add(sum0, wasm_f64x2_mul(pi0, wasm_v128_load(element + j)));
+    j += 2;
+  }
+  sum0 = wasm_f64x2_add(sum0, sum1);
+  FloatT value = wasm_f64x2_extract_lane(sum0, 0) + wasm_f64x2_extract_lane(sum0, 1);
+  if (j < n)
+    value += pi[row[j]] * element[j];
+  return value;
+#else
+  FloatT value = 0.0;
+  for (int j = 0; j < n; j++)
+    value += pi[row[j]] * element[j];
+  return value;
+#endif
+}
+
+/// output[index[j]] += element[j] * multiplier for j < n, index holding no duplicates
+inline void CoinSimdScatterAdd(const FloatT *COIN_RESTRICT element,
+  const int *COIN_RESTRICT index, int n, FloatT multiplier, FloatT *COIN_RESTRICT output)
+{
+#if COIN_SIMD128
+  v128_t scale = wasm_f64x2_splat(multiplier);
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    v128_t product = wasm_f64x2_mul(wasm_v128_load(element + j), scale);
+    output[index[j]] += wasm_f64x2_extract_lane(product, 0);
+    output[index[j + 1]] += wasm_f64x2_extract_lane(product, 1);
+  }
+  if (j < n)
+    output[index[j]] += element[j] * multiplier;
+#else
+  for (int j = 0; j < n; j++)
+    output[index[j]] += element[j] * multiplier;
+#endif
+}
+
+/// Sum of region1[i] * region2[i] for i < size
+inline FloatT CoinSimdDot(const FloatT *COIN_RESTRICT region1,
+  const FloatT *COIN_RESTRICT region2, int size)
+{
+#if COIN_SIMD128
+  v128_t sum0 = wasm_f64x2_splat(0.0);
+  v128_t sum1 = sum0;
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    sum0 = wasm_f64x2_add(sum0, wasm_f64x2_mul(wasm_v128_load(region1 + i), wasm_v128_load(region2 + i)));
+    sum1 = wasm_f64x2_add(sum1, wasm_f64x2_mul(wasm_v128_load(region1 + i + 2), wasm_v128_load(region2 + i + 2)));
+  }
+  if (i + 2 <= size) {
+    sum0 = wasm_f64x2_add(sum0, wasm_f64x2_mul(wasm_v128_load(region1 + i), wasm_v128_load(region2 + i)));
+    i += 2;
+  }
+  sum0 = wasm_f64x2_add(sum0, sum1);
+  FloatT value = wasm_f64x2_extract_lane(sum0, 0) + wasm_f64x2_extract_lane(sum0, 1);
+  if (i < size)
+    value += region1[i] * region2[i];
+  return value;
+#else
+  FloatT value = 0.0;
+  for (int i = 0; i < size; i++)
+    value += region1[i] * region2[i];
+  return value;
+#endif
+}
+
+/// Largest absolute value in region, 0 when size is 0
+inline FloatT CoinSimdMaxAbs(const FloatT *COIN_RESTRICT region, int size)
+{
+#if COIN_SIMD128
+  v128_t max0 = wasm_f64x2_splat(0.0);
+  v128_t max1 = max0;
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    max0 = wasm_f64x2_pmax(max0, wasm_f64x2_abs(wasm_v128_load(region + i)));
+    max1 = wasm_f64x2_pmax(max1, wasm_f64x2_abs(wasm_v128_load(region + i + 2)));
+  }
+  if (i + 2 <= size) {
+    max0 = wasm_f64x2_pmax(max0, wasm_f64x2_abs(wasm_v128_load(region + i)));
+    i += 2;
+  }
+  max0 = wasm_f64x2_pmax(max0, max1);
+  FloatT maxValue = CoinMax(wasm_f64x2_extract_lane(max0, 0), wasm_f64x2_extract_lane(max0, 1));
+  if (i < size)
+    maxValue = CoinMax(maxValue, CoinAbs(region[i]));
+  return maxValue;
+#else
+  FloatT maxValue = 0.0;
+  for (int i = 0; i < size; i++)
+    maxValue = CoinMax(maxValue, CoinAbs(region[i]));
+  return maxValue;
+#endif
+}
+
+/// region2[i] = multiplier1 * region1[i] + multiplier2 * region2[i] for i < size
+inline void CoinSimdMultiplyAdd(const FloatT *COIN_RESTRICT region1, int size,
+  FloatT multiplier1, FloatT *COIN_RESTRICT region2, FloatT multiplier2)
+{
+#if COIN_SIMD128
+  v128_t scale1 = wasm_f64x2_splat(multiplier1);
+  v128_t scale2 = wasm_f64x2_splat(multiplier2);
+  int i = 0;
+  for (; i + 2 <= size; i += 2) {
+    v128_t value = wasm_f64x2_add(wasm_f64x2_mul(scale1, wasm_v128_load(region1 + i)),
+      wasm_f64x2_mul(scale2, wasm_v128_load(region2 + i)));
+    wasm_v128_store(region2 + i, value);
+  }
+  if (i < size)
+    region2[i] = multiplier1 * region1[i] + multiplier2 * region2[i];
+#else
+  for (int i = 0; i < size; i++)
+    region2[i] = multiplier1 * region1[i] + multiplier2 * region2[i];
+#endif
+}
+
+/// First i in [start, end) with region[i] nonzero, or end. With simd128 runs of zeros are
+/// skipped four doubles at a time, which is what the dense scans of CoinIndexedVector spend
+/// most of their time on
+inline int CoinSimdNextNonZero(const FloatT *COIN_RESTRICT region, int start, int end)
+{
+  int i = start;
+#if COIN_SIMD128
+  const v128_t zero = wasm_f64x2_splat(0.0);
+  for (; i + 4 <= end; i += 4) {
+    v128_t nonZero = wasm_v128_or(wasm_f64x2_ne(wasm_v128_load(region + i), zero),
+      wasm_f64x2_ne(wasm_v128_load(region + i + 2), zero));
+    if (wasm_v128_any_true(nonZero))
+      break;
+  }
+#endif
+  for (; i < end; i++) {
+    if (region[i])
+      break;
+  }
+  return i;
+}
+
+#endif
@@ -8,6 +8,9 @@
 
 #include "floatdef.h"
 
+#include <chrono>
+#include <cstdint>
+
 // Uncomment the next three lines for thorough memory initialisation.
 // #ifndef ZEROFAULT
 // # define ZEROFAULT
@@ -179,6 +182,60 @@ static inline FloatT CoinCpuTimeJustChildren()
 #endif
   return cpu_temp;
 }
+//#############################################################################
+/* Integer nanosecond clocks, for timing checks in the solver loops that should not build
+   FloatT values: the user CPU time of CoinCpuTime() and the time of day of CoinGetTimeOfDay()
+   on their own scales, and a monotonic clock for measuring intervals (CoinProfile.hpp).
+*/
+static inline int64_t CoinCpuTimeNs()
+{
+#ifdef COIN_DOING_DIFFS
+  return 0;
+#endif
+#if defined(_MSC_VER) || defined(__MSVCRT__)
+  return static_cast< int64_t >(clock()) * (1000000000 / CLOCKS_PER_SEC);
+#else
+  struct rusage usage;
+#ifdef ZEROFAULT
+  usage.ru_utime.tv_sec = 0;
+  usage.ru_utime.tv_usec = 0;
+#endif
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast< int64_t >(usage.ru_utime.tv_sec) * 1000000000 + static_cast< int64_t >(usage.ru_utime.tv_usec) * 1000;
+#endif
+}
+
+inline int64_t CoinGetTimeOfDayNs()
+{
+#if defined(_MSC_VER)
+  struct _timeb timebuffer;
+#pragma warning(disable : 4996)
+  _ftime(&timebuffer); // C4996
+#pragma warning(default : 4996)
+  return static_cast< int64_t >(timebuffer.time) * 1000000000 + static_cast< int64_t >(timebuffer.millitm) * 1000000;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast< int64_t >(tv.tv_sec) * 1000000000 + static_cast< int64_t >(tv.tv_usec) * 1000;
+#endif
+}
+
+inline int64_t CoinMonotonicNs()
+{
+  return std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Seconds of one of the FloatT clocks above as nanoseconds of the matching integer clock,
+   saturating instead of overflowing for the huge values used as "no limit" */
+inline int64_t CoinSecondsToNs(FloatT seconds)
+{
+  if (seconds >= 9.0e9)
+    return INT64_MAX;
+  if (seconds <= -9.0e9)
+    return -INT64_MAX;
+  return static_cast< int64_t >(seconds * 1.0e9);
+}
+
 //#############################################################################
 
 #include <fstream>
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <cstdint>
+#include <cstring>
+
+// Operation counts of the CLP_FLOAT_COUNTED engine, the dec100 engine behind
+// boost::multiprecision::logged_adaptor, whose event hooks below count every
+// operation the solver runs on FloatT. Counts go to the CoinProfile region open
+// on the calling thread (CoinProfile::writeCounts), so the engine is built with
+// the profiler regions compiled in.
+namespace FloatCount
+{
+enum Op
+{
+    CONSTRUCT, // default, copy and move constructions
+    FROM_DOUBLE, // constructions and assignments from double or another builtin type
+    FROM_STRING,
+    ADD, // additions and subtractions
+    MULTIPLY,
+    DIVIDE,
+    COMPARE,
+    SQRT,
+    OP_COUNT
+};
+
+inline const char * name(int op)
+{
+    static const char * const names[OP_COUNT] = { "construct", "fromDouble", "fromString", "add",
+                                                  "multiply",  "divide",     "compare",    "sqrt" };
+    return names[op];
+}
+
+// Counters of the region open on this thread, set by CoinProfile
+inline thread_local int64_t * counts = nullptr;
+
+// Points counts at the counters of the thread outside any region (CoinProfile.cpp)
+int64_t * attach();
+
+inline void count(Op op)
+{
+    int64_t * current = counts ? counts : attach();
+    current[op]++;
+}
+
+// Events logged_adaptor reports before running an operation ("Assignment" and the
+// conversions to double or string are not counted)
+inline void countPrefix(const char * event)
+{
+    switch (event[0])
+    {
+    case '+':
+    case '-':
+        count(ADD);
+        break;
+    case 'i':
+    case 'd':
+        if (std::strcmp(event, "increment") == 0 || std::strcmp(event, "decrement") == 0)
+            count(ADD);
+        break;
+    case '*':
+        count(MULTIPLY);
+        break;
+    case '/':
+        count(DIVIDE);
+        break;
+    case 'f':
+        if (std::strncmp(event, "fused", 5) == 0)
+        {
+            count(MULTIPLY);
+            count(ADD);
+        }
+        break;
+    case 'c':
+        if (std::strcmp(event, "compare") == 0)
+            count(COMPARE);
+        break;
+    case 's':
+        if (std::strcmp(event, "sqrt") == 0)
+            count(SQRT);
+        break;
+    case 'C': // Copy construct, Conversion to string
+    case 'M': // Move construct, Move Assignment
+        if (std::strcmp(event + 5, "construct") == 0)
+            count(CONSTRUCT);
+        break;
+    case 'A':
+        if (std::strcmp(event, "Assignment from arithmetic type") == 0)
+            count(FROM_DOUBLE);
+        else if (std::strcmp(event, "Assignment from string type") == 0)
+            count(FROM_STRING);
+        break;
+    }
+}
+
+// Constructions are only reported after the fact
+inline void countPostfix(const char * event)
+{
+    if (std::strcmp(event, "Default construct") == 0)
+        count(CONSTRUCT);
+    else if (std::strcmp(event, "construct from arithmetic type") == 0)
+        count(FROM_DOUBLE);
+}
+} // namespace FloatCount
+
+// The hooks are found by argument dependent lookup on the wrapped backend, and
+// are more specialized than the empty defaults of logged_adaptor.hpp
+namespace boost
+{
+namespace multiprecision
+{
+namespace backends
+{
+inline void log_postfix_event(const cpp_dec_float<100> &, const char * event)
+{
+    FloatCount::countPostfix(event);
+}
+template <class T>
+inline void log_postfix_event(const cpp_dec_float<100> &, const T &, const char *)
+{
+}
+inline void log_prefix_event(const cpp_dec_float<100> &, const char * event)
+{
+    FloatCount::countPrefix(event);
+}
+template <class T>
+inline void log_prefix_event(const cpp_dec_float<100> &, const T &, const char * event)
+{
+    FloatCount::countPrefix(event);
+}
+template <class T, class U>
+inline void log_prefix_event(const cpp_dec_float<100> &, const T &, const U &, const char * event)
+{
+    FloatCount::countPrefix(event);
+}
+template <class T, class U, class V>
+inline void log_prefix_event(const cpp_dec_float<100> &, const T &, const U &, const V &, const char * event)
+{
+    FloatCount::countPrefix(event);
+}
+} // namespace backends
+} // namespace multiprecision
+} // namespace boost
+
+#include <boost/multiprecision/logged_adaptor.hpp>
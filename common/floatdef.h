@@ -1,19 +1,124 @@
 #pragma once
 #pragma warning(disable : 4477)
 
-//#include <boost/multiprecision/cpp_bin_float.hpp>
 #include <boost/multiprecision/cpp_dec_float.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <string>
 namespace mp = boost::multiprecision;
 
-// using FloatT = mp::number<mp::cpp_bin_float<64>>;
-// using FloatT = mp::number<mp::cpp_bin_float<128>>;
+// Scalar engine the CLP core is compiled with. Each libclp flavour is built from
+// the same sources with one of the CLP_FLOAT_* definitions (see CMakeLists.txt),
+// the default being 100 decimal digits.
+#if defined(CLP_FLOAT_DOUBLE)
+using FloatT = double;
+#define CLP_FLOAT_BUILTIN
+#define CLP_FLOAT_ENGINE "double"
+#elif defined(CLP_FLOAT_BIN113)
+// IEEE quad precision (113 bit significand). mp::cpp_bin_float<113> cannot be used as the
+// core zero-fills FloatT arrays with memset, and all-zero bytes are not a cpp_bin_float zero.
+#if defined(__EMSCRIPTEN__)
+using FloatT = long double; // binary128 on wasm32
+#define CLP_FLOAT_BUILTIN
+#else
+#include <boost/multiprecision/float128.hpp>
+using FloatT = mp::number<mp::float128_backend, mp::et_off>;
+#endif
+#define CLP_FLOAT_ENGINE "bin113"
+#elif defined(CLP_FLOAT_COUNTED)
+// dec100 with every operation counted per profiler region, for finding where the
+// multiprecision arithmetic goes (floatcount.h)
+#include "floatcount.h"
+using FloatT = mp::number<mp::logged_adaptor<mp::cpp_dec_float<100>>, mp::et_off>;
+#define CLP_FLOAT_ENGINE "dec100-counted"
+#else
 using FloatT = mp::number<mp::cpp_dec_float<100>, mp::et_off>;
+#define CLP_FLOAT_ENGINE "dec100"
+#endif
 
-#define TOO_SMALL_FLOAT (FloatT("-1.0E100"))
-#define TOO_BIG_FLOAT (FloatT("+1.0E100"))
+// Decimal type used for parsing and printing big numbers regardless of the engine
+using DecFloatT = mp::number<mp::cpp_dec_float<100>, mp::et_off>;
 
-#define OneE27 (FloatT("1E90"))
+// Builds a FloatT from its decimal representation without going through double
+// when the engine is a multiprecision type
+inline FloatT toFloat(const char * str)
+{
+#if defined(CLP_FLOAT_DOUBLE)
+    return std::strtod(str, nullptr);
+#elif defined(CLP_FLOAT_BUILTIN)
+    return std::strtold(str, nullptr);
+#elif defined(CLP_FLOAT_COUNTED)
+    // assigned to the backend, as logged_adaptor reports a construction from a string
+    // like one from a double
+    FloatT value;
+    value.backend() = str;
+    return value;
+#else
+    return FloatT(str);
+#endif
+}
+
+inline FloatT toFloat(const std::string & str)
+{
+    return toFloat(str.c_str());
+}
+
+template <typename T>
+FloatT fd(const T x)
+{
+    return static_cast<FloatT>(x);
+}
+
+// Constants used on the solver hot paths, built once at startup instead of converting a
+// string or double literal to FloatT at every use. The tolerances are converted from the
+// same double literals they replace so the arithmetic is unchanged.
+namespace FloatConst
+{
+inline const FloatT TooSmall = toFloat("-1.0E100");
+inline const FloatT TooBig = toFloat("+1.0E100");
+inline const FloatT OneE90 = toFloat("1E90");
 
+inline const FloatT Zero = fd(0.0);
+inline const FloatT Half = fd(0.5);
+inline const FloatT One = fd(1.0);
+inline const FloatT OneEm12 = fd(1.0e-12);
+inline const FloatT OneEm8 = fd(1.0e-8);
+inline const FloatT OneEm7 = fd(1.0e-7);
+inline const FloatT OneEm6 = fd(1.0e-6);
+inline const FloatT OneEm5 = fd(1.0e-5);
+inline const FloatT OneEm4 = fd(1.0e-4);
+inline const FloatT OneEm3 = fd(1.0e-3);
+inline const FloatT OneEm2 = fd(1.0e-2);
+inline const FloatT OneE10 = fd(1.0e10);
+inline const FloatT OneE20 = fd(1.0e20);
+inline const FloatT OneE30 = fd(1.0e30);
+inline const FloatT OneE50 = fd(1.0e50);
+inline const FloatT OneE100 = fd(1.0e100);
+} // namespace FloatConst
+
+#define TOO_SMALL_FLOAT (FloatConst::TooSmall)
+#define TOO_BIG_FLOAT (FloatConst::TooBig)
+
+#define OneE27 (FloatConst::OneE90)
+
+#if defined(CLP_FLOAT_BUILTIN)
+// Math functions the core calls through mp:: resolve to <cmath> for builtin types
+namespace boost
+{
+namespace multiprecision
+{
+using std::abs;
+using std::ceil;
+using std::floor;
+using std::isfinite;
+using std::isnan;
+using std::log10;
+using std::pow;
+using std::round;
+using std::sqrt;
+} // namespace multiprecision
+} // namespace boost
+#else
 namespace std
 {
 template <typename T>
@@ -37,10 +142,4 @@ inline int floor(const FloatT & x)
 {
     return static_cast<int>(x);
 }
-
-template <typename T>
-FloatT fd(const T x)
-{
-    return static_cast<FloatT>(x);
-}
-
+#endif
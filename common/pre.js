@@ -169,6 +169,7 @@ var clpPromise = new Promise(function (resolve) {
   Module["onRuntimeInitialized"] = function () {
     var m = this;
     this["clp"] = (function () {
+      var batchWrapper = null; // reused by every solveBatch() call
       var methods = {
         solve: function (lpProblem, precision) {
           if (typeof precision === "undefined") { 
@@ -182,9 +183,35 @@ var clpPromise = new Promise(function (resolve) {
             return null;
           }
         },
+        solveBatch: function (problems, precision) {
+          if (typeof precision === "undefined") {
+            precision = 9;
+          }
+          if (!batchWrapper) {
+            batchWrapper = new m.ClpWrapper();
+          }
+          var packed = batchWrapper.solveBatch(problems, precision);
+          return { results: JSON.parse(packed.results), timings: packed.timings };
+        },
+        solveBasis: m.solveBasis,
+        solveMixed: function (lpProblem, precision, fastClp) {
+          if (typeof precision === "undefined") {
+            precision = 9;
+          }
+          try {
+            var basis = (fastClp || this).solveBasis(lpProblem);
+            var solutionStr = basis ? m.solveFromBasis(lpProblem, basis, precision) : m.solve(lpProblem, precision);
+            return JSON.parse(solutionStr);
+          } catch {
+            return null;
+          }
+        },
         toLpFormat: toLpFormat,
         version: m.version,
+        engine: m.engine,
+        setThreads: m.setThreads,
         ClpWrapper: m.ClpWrapper,
+        SolutionVector: m.SolutionVector,
         bnCeil: m.bnCeil,
         bnFloor: m.bnFloor,
         bnRound: m.bnRound,
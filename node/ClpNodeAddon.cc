@@ -0,0 +1,977 @@
+// Native Node.js addon exposing the same API as EMSCRIPTEN_BINDINGS(solver) in solver/bindings.cc,
+// plus Promise returning *Async variants of the solving calls that run on the libuv thread pool
+#include "ClpConfig.h"
+#include "ClpWrapper.h"
+#include "floatdef.h"
+
+#include <node_api.h>
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Thrown by the argument helpers once a JS exception is pending
+struct PendingException
+{
+};
+
+void check(napi_env env, napi_status status)
+{
+    if (status == napi_ok)
+        return;
+    bool pending = false;
+    napi_is_exception_pending(env, &pending);
+    if (!pending)
+    {
+        const napi_extended_error_info * info = nullptr;
+        napi_get_last_error_info(env, &info);
+        napi_throw_error(env, nullptr, info && info->error_message ? info->error_message : "N-API call failed");
+    }
+    throw PendingException {};
+}
+
+void throwTypeError(napi_env env, const char * message)
+{
+    napi_throw_type_error(env, nullptr, message);
+    throw PendingException {};
+}
+
+napi_valuetype typeOf(napi_env env, napi_value value)
+{
+    napi_valuetype type;
+    check(env, napi_typeof(env, value, &type));
+    return type;
+}
+
+std::string stringFromJS(napi_env env, napi_value value)
+{
+    if (typeOf(env, value) != napi_string)
+        throwTypeError(env, "expected a string");
+    size_t length = 0;
+    check(env, napi_get_value_string_utf8(env, value, nullptr, 0, &length));
+    std::string str(length, '\0');
+    check(env, napi_get_value_string_utf8(env, value, &str[0], length + 1, &length));
+    return str;
+}
+
+int intFromJS(napi_env env, napi_value value)
+{
+    if (typeOf(env, value) != napi_number)
+        throwTypeError(env, "expected a number");
+    int32_t result = 0;
+    check(env, napi_get_value_int32(env, value, &result));
+    return result;
+}
+
+double doubleFromJS(napi_env env, napi_value value)
+{
+    if (typeOf(env, value) != napi_number)
+        throwTypeError(env, "expected a number");
+    double result = 0;
+    check(env, napi_get_value_double(env, value, &result));
+    return result;
+}
+
+// Byte counts and other sizes beyond the int32 range
+size_t sizeFromJS(napi_env env, napi_value value)
+{
+    if (typeOf(env, value) != napi_number)
+        throwTypeError(env, "expected a number");
+    double result = 0;
+    check(env, napi_get_value_double(env, value, &result));
+    if (!(result >= 0))
+        throwTypeError(env, "expected a non-negative number");
+    return static_cast<size_t>(result);
+}
+
+// Numbers, strings and big numbers go through their decimal representation like floatFromJS
+FloatT floatFromJS(napi_env env, napi_value value)
+{
+    napi_value str;
+    check(env, napi_coerce_to_string(env, value, &str));
+    return toFloat(stringFromJS(env, str));
+}
+
+template <typename T>
+bool typedArrayFromJS(napi_env env, napi_value value, napi_typedarray_type expected, std::vector<T> & vec)
+{
+    bool isTypedArray = false;
+    check(env, napi_is_typedarray(env, value, &isTypedArray));
+    if (!isTypedArray)
+        return false;
+    napi_typedarray_type type;
+    size_t length = 0;
+    void * data = nullptr;
+    check(env, napi_get_typedarray_info(env, value, &type, &length, &data, nullptr, nullptr));
+    if (type != expected)
+        return false;
+    const auto values = static_cast<const T *>(data);
+    vec.assign(values, values + length);
+    return true;
+}
+
+// Text given as a string or as the UTF-8 bytes of a Buffer or Uint8Array, e.g. the chunks of a
+// file read stream
+std::string textFromJS(napi_env env, napi_value value)
+{
+    bool isTypedArray = false;
+    check(env, napi_is_typedarray(env, value, &isTypedArray));
+    if (!isTypedArray)
+        return stringFromJS(env, value);
+    napi_typedarray_type type;
+    size_t length = 0;
+    void * data = nullptr;
+    check(env, napi_get_typedarray_info(env, value, &type, &length, &data, nullptr, nullptr));
+    if (type != napi_uint8_array && type != napi_int8_array && type != napi_uint8_clamped_array)
+        throwTypeError(env, "expected a string or a Uint8Array");
+    return std::string(static_cast<const char *>(data), length);
+}
+
+uint32_t arrayLength(napi_env env, napi_value value)
+{
+    bool isArray = false;
+    check(env, napi_is_array(env, value, &isArray));
+    if (!isArray)
+        throwTypeError(env, "expected an array");
+    uint32_t length = 0;
+    check(env, napi_get_array_length(env, value, &length));
+    return length;
+}
+
+// Accepts a Float64Array, a string of packed decimal values or a plain array of numbers or strings
+std::vector<FloatT> vecFromJS(napi_env env, napi_value value)
+{
+    if (typeOf(env, value) == napi_string)
+        return parsePackedFloats(stringFromJS(env, value));
+    std::vector<double> doubles;
+    if (typedArrayFromJS(env, value, napi_float64_array, doubles))
+        return std::vector<FloatT>(doubles.begin(), doubles.end());
+    const auto length = arrayLength(env, value);
+    std::vector<FloatT> vec;
+    vec.reserve(length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        napi_value element;
+        check(env, napi_get_element(env, value, i, &element));
+        vec.push_back(floatFromJS(env, element));
+    }
+    return vec;
+}
+
+std::vector<int> intVecFromJS(napi_env env, napi_value value)
+{
+    std::vector<int> vec;
+    if (typedArrayFromJS(env, value, napi_int32_array, vec))
+        return vec;
+    const auto length = arrayLength(env, value);
+    vec.reserve(length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        napi_value element;
+        check(env, napi_get_element(env, value, i, &element));
+        vec.push_back(intFromJS(env, element));
+    }
+    return vec;
+}
+
+bool isMissing(napi_env env, napi_value value)
+{
+    const auto type = typeOf(env, value);
+    return type == napi_undefined || type == napi_null;
+}
+
+napi_value toJS(napi_env env, const std::string & str)
+{
+    napi_value result;
+    check(env, napi_create_string_utf8(env, str.data(), str.size(), &result));
+    return result;
+}
+
+napi_value toJS(napi_env env, bool value)
+{
+    napi_value result;
+    check(env, napi_get_boolean(env, value, &result));
+    return result;
+}
+
+napi_value toJS(napi_env env, int value)
+{
+    napi_value result;
+    check(env, napi_create_int32(env, value, &result));
+    return result;
+}
+
+napi_value toJS(napi_env env, const std::vector<std::string> & strings)
+{
+    napi_value result;
+    check(env, napi_create_array_with_length(env, strings.size(), &result));
+    for (size_t i = 0; i < strings.size(); ++i)
+        check(env, napi_set_element(env, result, static_cast<uint32_t>(i), toJS(env, strings[i])));
+    return result;
+}
+
+// Float64Array holding a copy of the values
+napi_value toJS(napi_env env, const std::vector<double> & values)
+{
+    void * data = nullptr;
+    napi_value buffer;
+    check(env, napi_create_arraybuffer(env, values.size() * sizeof(double), &data, &buffer));
+    std::copy(values.begin(), values.end(), static_cast<double *>(data));
+    napi_value result;
+    check(env, napi_create_typedarray(env, napi_float64_array, values.size(), buffer, 0, &result));
+    return result;
+}
+
+napi_value undefined(napi_env env)
+{
+    napi_value result;
+    check(env, napi_get_undefined(env, &result));
+    return result;
+}
+
+// Arguments of a call, missing ones reading as undefined
+class Arguments
+{
+public:
+    Arguments(napi_env env, napi_callback_info info)
+    : _env(env)
+    {
+        size_t count = MaximumArguments;
+        check(env, napi_get_cb_info(env, info, &count, _values, &_this, nullptr));
+        _count = count;
+    }
+
+    napi_value operator[](size_t i) const
+    {
+        return i < _count ? _values[i] : undefined(_env);
+    }
+
+    napi_value self() const
+    {
+        return _this;
+    }
+
+    std::string string(size_t i) const
+    {
+        return stringFromJS(_env, (*this)[i]);
+    }
+
+    std::string text(size_t i) const
+    {
+        return textFromJS(_env, (*this)[i]);
+    }
+
+    int integer(size_t i) const
+    {
+        return intFromJS(_env, (*this)[i]);
+    }
+
+    /// An optional integer, fallback when undefined or null
+    int integer(size_t i, int fallback) const
+    {
+        return isMissing(_env, (*this)[i]) ? fallback : integer(i);
+    }
+
+    double number(size_t i) const
+    {
+        return doubleFromJS(_env, (*this)[i]);
+    }
+
+    FloatT decimal(size_t i) const
+    {
+        return floatFromJS(_env, (*this)[i]);
+    }
+
+    size_t size(size_t i) const
+    {
+        return sizeFromJS(_env, (*this)[i]);
+    }
+
+    std::vector<FloatT> decimals(size_t i) const
+    {
+        return vecFromJS(_env, (*this)[i]);
+    }
+
+    std::vector<int> integers(size_t i) const
+    {
+        return intVecFromJS(_env, (*this)[i]);
+    }
+
+    /// An optional array, empty when undefined or null
+    std::vector<int> optionalIntegers(size_t i) const
+    {
+        return isMissing(_env, (*this)[i]) ? std::vector<int> {} : integers(i);
+    }
+
+private:
+    static constexpr size_t MaximumArguments = 8;
+    napi_env _env;
+    napi_value _this = nullptr;
+    napi_value _values[MaximumArguments] = {};
+    size_t _count = 0;
+};
+
+// Runs a binding body, turning C++ exceptions into JS ones
+template <typename Body>
+napi_value guarded(napi_env env, Body body)
+{
+    try
+    {
+        return body();
+    }
+    catch (const PendingException &)
+    {
+    }
+    catch (const std::exception & e)
+    {
+        napi_throw_error(env, nullptr, e.what());
+    }
+    catch (...)
+    {
+        napi_throw_error(env, nullptr, "CLP error");
+    }
+    return nullptr;
+}
+
+// Work item of an *Async call: execute() runs on a libuv worker, complete() builds the
+// resolved value back on the main thread
+struct AsyncTask
+{
+    std::function<void()> execute;
+    std::function<napi_value(napi_env)> complete;
+    std::function<void()> done;
+    std::string error;
+    napi_deferred deferred = nullptr;
+    napi_async_work work = nullptr;
+    napi_ref keepAlive = nullptr;
+};
+
+void executeTask(napi_env, void * data)
+{
+    auto task = static_cast<AsyncTask *>(data);
+    try
+    {
+        task->execute();
+    }
+    catch (const std::exception & e)
+    {
+        task->error = e.what();
+    }
+    catch (...)
+    {
+        task->error = "CLP error";
+    }
+}
+
+void completeTask(napi_env env, napi_status status, void * data)
+{
+    auto task = static_cast<AsyncTask *>(data);
+    if (task->done)
+        task->done();
+    napi_value result = nullptr;
+    if (status == napi_ok && task->error.empty())
+    {
+        try
+        {
+            result = task->complete(env);
+        }
+        catch (const PendingException &)
+        {
+            napi_get_and_clear_last_exception(env, &result);
+            napi_reject_deferred(env, task->deferred, result);
+            result = nullptr;
+            task->deferred = nullptr;
+        }
+    }
+    if (task->deferred)
+    {
+        if (result)
+        {
+            napi_resolve_deferred(env, task->deferred, result);
+        }
+        else
+        {
+            napi_value message;
+            napi_value error;
+            const auto & text = task->error.empty() ? std::string("cancelled") : task->error;
+            napi_create_string_utf8(env, text.data(), text.size(), &message);
+            napi_create_error(env, nullptr, message, &error);
+            napi_reject_deferred(env, task->deferred, error);
+        }
+    }
+    if (task->keepAlive)
+        napi_delete_reference(env, task->keepAlive);
+    napi_delete_async_work(env, task->work);
+    delete task;
+}
+
+// Queues a task on the libuv thread pool and returns its promise. keepAlive, when given, is
+// referenced until the task completes so the object it works on cannot be collected
+napi_value queueTask(napi_env env, AsyncTask * task, napi_value keepAlive = nullptr)
+{
+    napi_value promise;
+    napi_value name;
+    check(env, napi_create_promise(env, &task->deferred, &promise));
+    check(env, napi_create_string_utf8(env, "clp", NAPI_AUTO_LENGTH, &name));
+    if (keepAlive)
+        check(env, napi_create_reference(env, keepAlive, 1, &task->keepAlive));
+    check(env, napi_create_async_work(env, nullptr, name, executeTask, completeTask, task, &task->work));
+    check(env, napi_queue_async_work(env, task->work));
+    return promise;
+}
+
+// -------------------------------------------------------------------------------------------
+// free functions
+
+std::string solve(const std::string & problem, int precision)
+{
+    ClpWrapper clpWrapper;
+    return clpWrapper.solve(problem, precision);
+}
+
+std::string solveBasis(const std::string & problem)
+{
+    ClpWrapper clpWrapper;
+    if (!clpWrapper.readLp(problem))
+        return {};
+    clpWrapper.primal();
+    return clpWrapper.getBasis();
+}
+
+std::string solveFromBasis(const std::string & problem, const std::string & basis, int precision)
+{
+    ClpWrapper clpWrapper;
+    return clpWrapper.solveFromBasis(problem, basis, precision);
+}
+
+napi_value Solve(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        const auto problem = args.string(0);
+        const auto precision = args.integer(1);
+        return toJS(env, solve(problem, precision));
+    });
+}
+
+napi_value SolveBasis(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        const auto problem = args.string(0);
+        return toJS(env, solveBasis(problem));
+    });
+}
+
+napi_value SolveFromBasis(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        const auto problem = args.string(0);
+        const auto basis = args.string(1);
+        const auto precision = args.integer(2);
+        return toJS(env, solveFromBasis(problem, basis, precision));
+    });
+}
+
+napi_value SolveAsync(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        auto task = new AsyncTask;
+        auto result = std::make_shared<std::string>();
+        task->execute = [problem = args.string(0), precision = args.integer(1), result] {
+            *result = solve(problem, precision);
+        };
+        task->complete = [result](napi_env env) { return toJS(env, *result); };
+        return queueTask(env, task);
+    });
+}
+
+napi_value SolveFromBasisAsync(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        auto task = new AsyncTask;
+        auto result = std::make_shared<std::string>();
+        task->execute = [problem = args.string(0), basis = args.string(1), precision = args.integer(2), result] {
+            *result = solveFromBasis(problem, basis, precision);
+        };
+        task->complete = [result](napi_env env) { return toJS(env, *result); };
+        return queueTask(env, task);
+    });
+}
+
+napi_value BnRound(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] { return toJS(env, mp::round(DecFloatT(Arguments(env, info).string(0))).str()); });
+}
+
+napi_value BnCeil(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] { return toJS(env, mp::ceil(DecFloatT(Arguments(env, info).string(0))).str()); });
+}
+
+napi_value BnFloor(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] { return toJS(env, mp::floor(DecFloatT(Arguments(env, info).string(0))).str()); });
+}
+
+napi_value Version(napi_env env, napi_callback_info)
+{
+    return guarded(env, [&] { return toJS(env, std::string(CLP_VERSION)); });
+}
+
+napi_value Engine(napi_env env, napi_callback_info)
+{
+    return guarded(env, [&] { return toJS(env, ClpWrapper::engine()); });
+}
+
+napi_value SetThreads(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] { return toJS(env, ClpWrapper::setThreads(Arguments(env, info).integer(0))); });
+}
+
+// -------------------------------------------------------------------------------------------
+// ClpWrapper class
+
+// Native object behind a JS ClpWrapper. busy is set while an *Async call owns the wrapper
+struct WrapperHandle
+{
+    ClpWrapper wrapper;
+    bool busy = false;
+};
+
+WrapperHandle & unwrap(napi_env env, napi_value self)
+{
+    void * data = nullptr;
+    check(env, napi_unwrap(env, self, &data));
+    auto handle = static_cast<WrapperHandle *>(data);
+    if (handle->busy)
+    {
+        napi_throw_error(env, nullptr, "ClpWrapper is busy with an asynchronous call");
+        throw PendingException {};
+    }
+    return *handle;
+}
+
+// Binds a synchronous ClpWrapper method; body receives the wrapper and the arguments
+template <typename Body>
+napi_value method(napi_env env, napi_callback_info info, Body body)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        auto & handle = unwrap(env, args.self());
+        return body(handle.wrapper, args);
+    });
+}
+
+// Binds an asynchronous ClpWrapper method: prepare() reads the arguments on the main thread and
+// returns the work to run on the libuv worker, whose result is converted with complete()
+template <typename Result, typename Prepare>
+napi_value asyncMethod(napi_env env, napi_callback_info info, Prepare prepare)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        auto & handle = unwrap(env, args.self());
+        std::function<Result(ClpWrapper &)> work = prepare(args);
+        auto result = std::make_shared<Result>();
+        auto task = new AsyncTask;
+        auto handlePtr = &handle;
+        task->execute = [handlePtr, work, result] { *result = work(handlePtr->wrapper); };
+        task->complete = [result](napi_env env) { return toJS(env, *result); };
+        task->done = [handlePtr] { handlePtr->busy = false; };
+        const auto promise = queueTask(env, task, args.self());
+        handle.busy = true;
+        return promise;
+    });
+}
+
+SolutionVector solutionVectorFromJS(napi_env env, napi_value value)
+{
+    // a SolutionVector value is a number, embind style { value } objects are accepted too
+    if (typeOf(env, value) == napi_object)
+        check(env, napi_get_named_property(env, value, "value", &value));
+    const auto which = intFromJS(env, value);
+    if (which < 0 || which > static_cast<int>(SolutionVector::ROW_ACTIVITIES))
+        throwTypeError(env, "invalid SolutionVector");
+    return static_cast<SolutionVector>(which);
+}
+
+// { method, presolve, passes } like setSolveOptionsJS() of the WASM module
+ClpWrapper::SolveOptions solveOptionsFromJS(napi_env env, napi_value value)
+{
+    ClpWrapper::SolveOptions options;
+    if (isMissing(env, value))
+        return options;
+    const auto field = [&](const char * name) {
+        napi_value fieldValue;
+        check(env, napi_get_named_property(env, value, name, &fieldValue));
+        return fieldValue;
+    };
+    if (const auto method = field("method"); !isMissing(env, method))
+        options.method = stringFromJS(env, method);
+    if (const auto presolve = field("presolve"); !isMissing(env, presolve))
+        check(env, napi_get_value_bool(env, presolve, &options.presolve));
+    if (const auto passes = field("passes"); !isMissing(env, passes))
+        options.presolvePasses = intFromJS(env, passes);
+    if (const auto stats = field("stats"); !isMissing(env, stats))
+        check(env, napi_get_value_bool(env, stats, &options.stats));
+    return options;
+}
+
+// Problems of a batch, converted on the main thread: LP strings, file names or CSC objects
+std::function<bool(ClpWrapper &)> batchProblemFromJS(napi_env env, napi_value problem)
+{
+    if (typeOf(env, problem) == napi_string)
+    {
+        return [text = stringFromJS(env, problem)](ClpWrapper & wrapper) { return wrapper.readLp(text); };
+    }
+    const auto field = [&](const char * name) {
+        napi_value value;
+        check(env, napi_get_named_property(env, problem, name, &value));
+        return value;
+    };
+    try
+    {
+        auto objective = vecFromJS(env, field("objective"));
+        auto columnLower = vecFromJS(env, field("columnLower"));
+        auto columnUpper = vecFromJS(env, field("columnUpper"));
+        auto rowLower = vecFromJS(env, field("rowLower"));
+        auto rowUpper = vecFromJS(env, field("rowUpper"));
+        auto starts = intVecFromJS(env, field("starts"));
+        auto rows = intVecFromJS(env, field("rows"));
+        auto values = vecFromJS(env, field("values"));
+        return [=](ClpWrapper & wrapper) {
+            return wrapper.loadProblemCSC(objective, columnLower, columnUpper, rowLower, rowUpper, starts, rows, values);
+        };
+    }
+    catch (const PendingException &)
+    {
+        // malformed models give a null result like in the WASM module
+        napi_value ignored;
+        napi_get_and_clear_last_exception(env, &ignored);
+        return [](ClpWrapper &) { return false; };
+    }
+}
+
+std::vector<std::function<bool(ClpWrapper &)>> batchFromJS(napi_env env, napi_value problems)
+{
+    const auto length = arrayLength(env, problems);
+    std::vector<std::function<bool(ClpWrapper &)>> batch;
+    batch.reserve(length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        napi_value problem;
+        check(env, napi_get_element(env, problems, i, &problem));
+        batch.push_back(batchProblemFromJS(env, problem));
+    }
+    return batch;
+}
+
+struct BatchResult
+{
+    std::string results;
+    std::vector<double> timings;
+};
+
+BatchResult solveBatch(ClpWrapper & wrapper, const std::vector<std::function<bool(ClpWrapper &)>> & batch, int precision)
+{
+    BatchResult result;
+    result.results = wrapper.solveBatch(
+        batch.size(), [&](size_t i) { return batch[i](wrapper); }, precision);
+    result.timings = wrapper.batchTimings();
+    return result;
+}
+
+napi_value toJS(napi_env env, const BatchResult & batch)
+{
+    napi_value result;
+    check(env, napi_create_object(env, &result));
+    check(env, napi_set_named_property(env, result, "results", toJS(env, batch.results)));
+    check(env, napi_set_named_property(env, result, "timings", toJS(env, batch.timings)));
+    return result;
+}
+
+void finalizeWrapper(napi_env, void * data, void *)
+{
+    delete static_cast<WrapperHandle *>(data);
+}
+
+napi_value Construct(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        auto handle = new WrapperHandle;
+        const auto status = napi_wrap(env, args.self(), handle, finalizeWrapper, nullptr, nullptr);
+        if (status != napi_ok)
+            delete handle;
+        check(env, status);
+        return args.self();
+    });
+}
+
+#define CLP_METHOD(name, body)                                                                     \
+    napi_value name(napi_env env, napi_callback_info info)                                         \
+    {                                                                                              \
+        return method(env, info, [&](ClpWrapper & w, const Arguments & args) { return body; });    \
+    }
+
+CLP_METHOD(WrapperSolve, toJS(env, w.solve(args.string(0), args.integer(1))))
+CLP_METHOD(ReadLp, toJS(env, w.readLp(args.string(0))))
+CLP_METHOD(ReadMps, toJS(env, w.readMps(args.string(0))))
+CLP_METHOD(BeginParse, (w.beginParse(), undefined(env)))
+CLP_METHOD(Feed, toJS(env, w.feed(args.text(0))))
+CLP_METHOD(Finish, toJS(env, w.finish()))
+CLP_METHOD(Primal, (w.primal(), undefined(env)))
+CLP_METHOD(Dual, (w.dual(), undefined(env)))
+CLP_METHOD(SetColumnBounds, toJS(env, w.setColumnBounds(args.integer(0), args.decimal(1), args.decimal(2))))
+CLP_METHOD(SetRowBounds, toJS(env, w.setRowBounds(args.integer(0), args.decimal(1), args.decimal(2))))
+CLP_METHOD(SetObjectiveCoefficient, toJS(env, w.setObjectiveCoefficient(args.integer(0), args.decimal(1))))
+CLP_METHOD(Resolve, toJS(env, w.resolve()))
+CLP_METHOD(Iterations, toJS(env, w.iterations()))
+CLP_METHOD(Status, toJS(env, w.status()))
+CLP_METHOD(SetTimeLimit, (w.setTimeLimit(args.number(0)), undefined(env)))
+CLP_METHOD(SetIterationLimit, (w.setIterationLimit(args.integer(0)), undefined(env)))
+CLP_METHOD(StopReason, toJS(env, w.stopReason()))
+CLP_METHOD(SetLogLevel, (w.setLogLevel(args.integer(0)), undefined(env)))
+CLP_METHOD(SetInteger, toJS(env, w.setInteger(args.integer(0))))
+CLP_METHOD(HasIntegers, toJS(env, w.hasIntegers()))
+CLP_METHOD(BranchAndBound, toJS(env, w.branchAndBound(args.integer(0))))
+CLP_METHOD(Nodes, toJS(env, w.nodes()))
+CLP_METHOD(GetSolution, toJS(env, w.getSolution(args.integer(0))))
+CLP_METHOD(SetCacheLimit, (w.setCacheLimit(args.size(0)), undefined(env)))
+CLP_METHOD(ClearCache, (w.clearCache(), undefined(env)))
+CLP_METHOD(CacheStats, toJS(env, w.cacheStatsJson()))
+CLP_METHOD(SetSolveOptions, toJS(env, w.setSolveOptions(solveOptionsFromJS(env, args[0]))))
+CLP_METHOD(GetBasis, toJS(env, w.getBasis()))
+CLP_METHOD(SetBasis, toJS(env, w.setBasis(args.string(0))))
+CLP_METHOD(WrapperSolveFromBasis, toJS(env, w.solveFromBasis(args.string(0), args.string(1), args.integer(2))))
+CLP_METHOD(WrapperSolveBatch, toJS(env, solveBatch(w, batchFromJS(env, args[0]), args.integer(1))))
+CLP_METHOD(LoadProblem,
+           toJS(env,
+                w.loadProblem(args.decimals(0),
+                              args.decimals(1),
+                              args.decimals(2),
+                              args.decimals(3),
+                              args.decimals(4),
+                              args.decimals(5))))
+CLP_METHOD(LoadProblemSparse,
+           toJS(env,
+                w.loadProblemSparse(args.decimals(0),
+                                    args.decimals(1),
+                                    args.decimals(2),
+                                    args.decimals(3),
+                                    args.decimals(4),
+                                    args.integers(5),
+                                    args.integers(6),
+                                    args.decimals(7))))
+CLP_METHOD(LoadProblemCSC,
+           toJS(env,
+                w.loadProblemCSC(args.decimals(0),
+                                 args.decimals(1),
+                                 args.decimals(2),
+                                 args.decimals(3),
+                                 args.decimals(4),
+                                 args.integers(5),
+                                 args.integers(6),
+                                 args.decimals(7))))
+CLP_METHOD(GetSolutionArray, toJS(env, w.getSolutionValues(args.integer(0))))
+CLP_METHOD(GetUnboundedRay, toJS(env, w.getUnboundedRayValues(args.integer(0))))
+CLP_METHOD(GetInfeasibilityRay, toJS(env, w.getInfeasibilityRayValues(args.integer(0))))
+CLP_METHOD(GetValues, toJS(env, w.getValues(solutionVectorFromJS(env, args[0]))))
+CLP_METHOD(GetDecimals, toJS(env, w.getDecimals(solutionVectorFromJS(env, args[0]), args.integer(1))))
+CLP_METHOD(Ranging, toJS(env, w.ranging(args.optionalIntegers(0), args.integer(1), args.integer(2, 1))))
+CLP_METHOD(GetColumnNames, toJS(env, w.getColumnNames()))
+CLP_METHOD(GetRowNames, toJS(env, w.getRowNames()))
+// embind objects must be deleted explicitly, addon ones are freed by the garbage collector
+CLP_METHOD(Delete, undefined(env))
+
+#undef CLP_METHOD
+
+// Allowed while an *Async call owns the wrapper, which is what it is for
+napi_value Cancel(napi_env env, napi_callback_info info)
+{
+    return guarded(env, [&] {
+        Arguments args(env, info);
+        void * data = nullptr;
+        check(env, napi_unwrap(env, args.self(), &data));
+        static_cast<WrapperHandle *>(data)->wrapper.cancel();
+        return undefined(env);
+    });
+}
+
+napi_value WrapperSolveAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<std::string>(env, info, [env](const Arguments & args) {
+        return [problem = args.string(0), precision = args.integer(1)](ClpWrapper & w) {
+            return w.solve(problem, precision);
+        };
+    });
+}
+
+napi_value WrapperSolveFromBasisAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<std::string>(env, info, [](const Arguments & args) {
+        return [problem = args.string(0), basis = args.string(1), precision = args.integer(2)](ClpWrapper & w) {
+            return w.solveFromBasis(problem, basis, precision);
+        };
+    });
+}
+
+napi_value WrapperSolveBatchAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<BatchResult>(env, info, [env](const Arguments & args) {
+        return [batch = batchFromJS(env, args[0]), precision = args.integer(1)](ClpWrapper & w) {
+            return solveBatch(w, batch, precision);
+        };
+    });
+}
+
+napi_value PrimalAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<int>(env, info, [](const Arguments &) {
+        return [](ClpWrapper & w) {
+            w.primal();
+            return w.iterations();
+        };
+    });
+}
+
+napi_value DualAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<int>(env, info, [](const Arguments &) {
+        return [](ClpWrapper & w) {
+            w.dual();
+            return w.iterations();
+        };
+    });
+}
+
+napi_value ResolveAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<int>(env, info, [](const Arguments &) { return [](ClpWrapper & w) { return w.resolve(); }; });
+}
+
+napi_value BranchAndBoundAsync(napi_env env, napi_callback_info info)
+{
+    return asyncMethod<bool>(env, info, [](const Arguments & args) {
+        return [maximumNodes = args.integer(0)](ClpWrapper & w) { return w.branchAndBound(maximumNodes); };
+    });
+}
+
+// enumerable like the properties embind creates
+napi_property_descriptor function(const char * name, napi_callback callback)
+{
+    const auto attributes = static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+    return { name, nullptr, callback, nullptr, nullptr, nullptr, attributes, nullptr };
+}
+
+napi_value solutionVectorEnum(napi_env env)
+{
+    napi_value result;
+    check(env, napi_create_object(env, &result));
+    const std::pair<const char *, SolutionVector> values[] = {
+        { "SOLUTION", SolutionVector::SOLUTION },
+        { "DUALS", SolutionVector::DUALS },
+        { "REDUCED_COSTS", SolutionVector::REDUCED_COSTS },
+        { "ROW_ACTIVITIES", SolutionVector::ROW_ACTIVITIES },
+    };
+    for (const auto & [name, value] : values)
+        check(env, napi_set_named_property(env, result, name, toJS(env, static_cast<int>(value))));
+    check(env, napi_object_freeze(env, result));
+    return result;
+}
+
+napi_value Init(napi_env env, napi_value exports)
+{
+    return guarded(env, [&] {
+        const napi_property_descriptor wrapperMethods[] = {
+            function("solve", WrapperSolve),
+            function("readLp", ReadLp),
+            function("readMps", ReadMps),
+            function("beginParse", BeginParse),
+            function("feed", Feed),
+            function("finish", Finish),
+            function("primal", Primal),
+            function("dual", Dual),
+            function("setColumnBounds", SetColumnBounds),
+            function("setRowBounds", SetRowBounds),
+            function("setObjectiveCoefficient", SetObjectiveCoefficient),
+            function("resolve", Resolve),
+            function("iterations", Iterations),
+            function("status", Status),
+            function("setTimeLimit", SetTimeLimit),
+            function("setIterationLimit", SetIterationLimit),
+            function("cancel", Cancel),
+            function("stopReason", StopReason),
+            function("setLogLevel", SetLogLevel),
+            function("setInteger", SetInteger),
+            function("hasIntegers", HasIntegers),
+            function("branchAndBound", BranchAndBound),
+            function("nodes", Nodes),
+            function("getSolution", GetSolution),
+            function("getBasis", GetBasis),
+            function("setBasis", SetBasis),
+            function("solveFromBasis", WrapperSolveFromBasis),
+            function("solveBatch", WrapperSolveBatch),
+            function("setCacheLimit", SetCacheLimit),
+            function("clearCache", ClearCache),
+            function("cacheStats", CacheStats),
+            function("setSolveOptions", SetSolveOptions),
+            function("loadProblem", LoadProblem),
+            function("loadProblemSparse", LoadProblemSparse),
+            function("loadProblemCSC", LoadProblemCSC),
+            function("getSolutionArray", GetSolutionArray),
+            function("getUnboundedRay", GetUnboundedRay),
+            function("getInfeasibilityRay", GetInfeasibilityRay),
+            function("getValues", GetValues),
+            function("getDecimals", GetDecimals),
+            function("ranging", Ranging),
+            function("getColumnNames", GetColumnNames),
+            function("getRowNames", GetRowNames),
+            function("delete", Delete),
+            function("solveAsync", WrapperSolveAsync),
+            function("solveFromBasisAsync", WrapperSolveFromBasisAsync),
+            function("solveBatchAsync", WrapperSolveBatchAsync),
+            function("primalAsync", PrimalAsync),
+            function("dualAsync", DualAsync),
+            function("resolveAsync", ResolveAsync),
+            function("branchAndBoundAsync", BranchAndBoundAsync),
+        };
+        napi_value wrapperClass;
+        check(env,
+              napi_define_class(env,
+                                "ClpWrapper",
+                                NAPI_AUTO_LENGTH,
+                                Construct,
+                                nullptr,
+                                sizeof(wrapperMethods) / sizeof(wrapperMethods[0]),
+                                wrapperMethods,
+                                &wrapperClass));
+
+        const napi_property_descriptor functions[] = {
+            function("bnCeil", BnCeil),
+            function("bnRound", BnRound),
+            function("bnFloor", BnFloor),
+            function("solve", Solve),
+            function("solveBasis", SolveBasis),
+            function("solveFromBasis", SolveFromBasis),
+            function("version", Version),
+            function("engine", Engine),
+            function("setThreads", SetThreads),
+            function("solveAsync", SolveAsync),
+            function("solveFromBasisAsync", SolveFromBasisAsync),
+        };
+        check(env, napi_define_properties(env, exports, sizeof(functions) / sizeof(functions[0]), functions));
+        check(env, napi_set_named_property(env, exports, "SolutionVector", solutionVectorEnum(env)));
+        check(env, napi_set_named_property(env, exports, "ClpWrapper", wrapperClass));
+        return exports;
+    });
+}
+} // namespace
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, Init)
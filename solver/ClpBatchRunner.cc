@@ -0,0 +1,254 @@
+#ifndef __EMSCRIPTEN__
+#include "ClpBatchRunner.h"
+#include "ClpWrapper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+// integer durations only, floatdef.h specializes std::common_type<T, double>
+int64_t steadyNs()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+double msSince(int64_t startNs)
+{
+    return static_cast<double>(steadyNs() - startNs) / 1.0e6;
+}
+
+bool isMps(const std::string & file)
+{
+    auto extension = fs::path(file).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == ".mps";
+}
+
+void writeJsonString(std::ostream & out, const std::string & str)
+{
+    out << '"';
+    for (const auto c : str)
+    {
+        if (c == '"' || c == '\\')
+            out << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            out << "\\u00" << "0123456789abcdef"[c >> 4] << "0123456789abcdef"[c & 15];
+        else
+            out << c;
+    }
+    out << '"';
+}
+
+/// Files owned by one worker. The owner takes from the front, idle workers steal from the back
+class WorkQueue
+{
+public:
+    void push(size_t item)
+    {
+        _items.push_back(item);
+    }
+
+    bool take(size_t & item)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_items.empty())
+            return false;
+        item = _items.front();
+        _items.pop_front();
+        return true;
+    }
+
+    bool steal(size_t & item)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_items.empty())
+            return false;
+        item = _items.back();
+        _items.pop_back();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<size_t> _items;
+};
+
+struct FileResult
+{
+    bool loaded = false;
+    int status = -1;
+    int iterations = 0;
+    double parseMs = 0;
+    double solveMs = 0;
+    double serializeMs = 0;
+    std::string result;
+};
+
+FileResult solveFile(ClpWrapper & wrapper, const std::string & file, int precision)
+{
+    FileResult fileResult;
+    auto start = steadyNs();
+    // a path that cannot be opened would be parsed as LP content
+    fileResult.loaded = std::ifstream(file).good() && (isMps(file) ? wrapper.readMps(file) : wrapper.readLp(file));
+    fileResult.parseMs = msSince(start);
+    if (!fileResult.loaded)
+        return fileResult;
+
+    start = steadyNs();
+    wrapper.primal();
+    if (wrapper.hasIntegers())
+        wrapper.branchAndBound(ClpWrapper::DefaultMaximumNodes);
+    fileResult.solveMs = msSince(start);
+    fileResult.status = wrapper.status();
+    fileResult.iterations = wrapper.iterations();
+
+    start = steadyNs();
+    fileResult.result = wrapper.getSolution(precision);
+    fileResult.serializeMs = msSince(start);
+    return fileResult;
+}
+
+void writeLine(std::ostream & out, size_t index, const std::string & file, const FileResult & fileResult)
+{
+    out << "{\"index\":" << index << ",\"file\":";
+    writeJsonString(out, file);
+    out << ",\"loaded\":" << (fileResult.loaded ? "true" : "false") << ",\"status\":" << fileResult.status
+        << ",\"iterations\":" << fileResult.iterations << ",\"parseMs\":" << fileResult.parseMs
+        << ",\"solveMs\":" << fileResult.solveMs << ",\"serializeMs\":" << fileResult.serializeMs
+        << ",\"result\":" << (fileResult.loaded ? fileResult.result : "null") << "}\n";
+}
+} // namespace
+
+double ClpBatchRunner::Summary::throughput() const
+{
+    return wallMs > 0 ? 1000.0 * static_cast<double>(files) / wallMs : 0.0;
+}
+
+ClpBatchRunner::ClpBatchRunner(int threads, int precision)
+: _threads(threads > 0 ? threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency())))
+, _precision(precision)
+{
+}
+
+void ClpBatchRunner::setTimeLimit(double seconds)
+{
+    _timeLimit = seconds;
+}
+
+std::vector<std::string> ClpBatchRunner::collectFiles(const std::string & directoryOrManifest)
+{
+    std::vector<std::string> files;
+    std::error_code error;
+    if (fs::is_directory(directoryOrManifest, error))
+    {
+        for (const auto & entry : fs::recursive_directory_iterator(directoryOrManifest, error))
+        {
+            auto extension = entry.path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+            if (entry.is_regular_file(error) && (extension == ".lp" || extension == ".mps"))
+                files.push_back(entry.path().string());
+        }
+    }
+    else
+    {
+        const auto base = fs::path(directoryOrManifest).parent_path();
+        std::ifstream manifest(directoryOrManifest);
+        std::string line;
+        while (std::getline(manifest, line))
+        {
+            const auto first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#')
+                continue;
+            const auto last = line.find_last_not_of(" \t\r");
+            const fs::path path = line.substr(first, last - first + 1);
+            files.push_back((path.is_absolute() ? path : base / path).string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+ClpBatchRunner::Summary ClpBatchRunner::run(const std::vector<std::string> & files, std::ostream & out) const
+{
+    Summary summary;
+    summary.files = files.size();
+    summary.threads = static_cast<int>(std::min<size_t>(_threads, std::max<size_t>(files.size(), 1)));
+    const auto start = steadyNs();
+
+    // biggest files first, dealt round robin, so the expensive models start early and the
+    // cheap ones left at the end are what idle workers steal
+    std::vector<std::pair<uintmax_t, size_t>> bySize;
+    bySize.reserve(files.size());
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        std::error_code error;
+        const auto size = fs::file_size(files[i], error);
+        bySize.emplace_back(error ? 0 : size, i);
+    }
+    std::stable_sort(bySize.begin(), bySize.end(), [](const auto & a, const auto & b) { return a.first > b.first; });
+    std::vector<WorkQueue> queues(summary.threads);
+    for (size_t i = 0; i < bySize.size(); ++i)
+        queues[i % queues.size()].push(bySize[i].second);
+
+    std::mutex outputMutex;
+    std::atomic<size_t> failed { 0 };
+    std::vector<Summary> totals(summary.threads);
+    const auto worker = [&](int id) {
+        ClpWrapper wrapper;
+        wrapper.setLogLevel(0); // keeps the JSON lines clean when writing to stdout
+        wrapper.setTimeLimit(_timeLimit);
+        auto & total = totals[id];
+        size_t index;
+        for (;;)
+        {
+            auto found = queues[id].take(index);
+            for (int k = 1; !found && k < summary.threads; ++k)
+                found = queues[(id + k) % summary.threads].steal(index);
+            // work is never added, so every queue being empty means the batch is done
+            if (!found)
+                break;
+
+            const auto fileResult = solveFile(wrapper, files[index], _precision);
+            total.parseMs += fileResult.parseMs;
+            total.solveMs += fileResult.solveMs;
+            total.serializeMs += fileResult.serializeMs;
+            if (!fileResult.loaded)
+                ++failed;
+
+            std::ostringstream line;
+            writeLine(line, index, files[index], fileResult);
+            std::lock_guard<std::mutex> lock(outputMutex);
+            out << line.str();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int id = 1; id < summary.threads; ++id)
+        threads.emplace_back(worker, id);
+    worker(0);
+    for (auto & thread : threads)
+        thread.join();
+    out.flush();
+
+    for (const auto & total : totals)
+    {
+        summary.parseMs += total.parseMs;
+        summary.solveMs += total.solveMs;
+        summary.serializeMs += total.serializeMs;
+    }
+    summary.failed = failed;
+    summary.wallMs = msSince(start);
+    return summary;
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// Solves a set of LP/MPS files on a work-stealing pool of native threads. Every thread reuses
+/// one ClpWrapper and each file produces one JSON line, written as soon as it is solved:
+///
+///     {"index":0,"file":"a.lp","loaded":true,"status":0,"iterations":12,
+///      "parseMs":0.4,"solveMs":2.1,"serializeMs":0.1,"result":{...solve() result...}}
+///
+/// Files ending in .mps are read as MPS, everything else as LP.
+class ClpBatchRunner
+{
+public:
+    struct Summary
+    {
+        size_t files = 0;
+        size_t failed = 0;
+        int threads = 0;
+        double wallMs = 0;
+        double parseMs = 0;
+        double solveMs = 0;
+        double serializeMs = 0;
+
+        /// Files per second over the wall clock time
+        double throughput() const;
+    };
+
+    /// threads <= 0 uses every hardware thread
+    ClpBatchRunner(int threads, int precision);
+
+    /// The *.lp and *.mps files below a directory, or the files listed in a manifest (one path
+    /// per line, relative to the manifest's directory, # starting a comment), sorted by path
+    static std::vector<std::string> collectFiles(const std::string & directoryOrManifest);
+
+    /// Wall clock seconds each file may take to solve, 0 (the default) for no limit. Files
+    /// stopped on it report status 3 with the solution reached so far
+    void setTimeLimit(double seconds);
+
+    Summary run(const std::vector<std::string> & files, std::ostream & out) const;
+
+private:
+    int _threads;
+    int _precision;
+    double _timeLimit = 0;
+};
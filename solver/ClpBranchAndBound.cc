@@ -0,0 +1,160 @@
+#include "ClpBranchAndBound.h"
+#include "ClpEventHandler.hpp"
+#include "ClpSimplex.hpp"
+
+#include <utility>
+
+ClpBranchAndBound::ClpBranchAndBound(ClpSimplex & model)
+: _model(model)
+, _integerTolerance(FloatConst::OneEm7)
+{
+    const auto numCols = _model.getNumCols();
+    for (int i = 0; i < numCols; ++i)
+    {
+        if (_model.isInteger(i))
+            _integerColumns.push_back(i);
+    }
+    _columnLower.assign(_model.getColLower(), _model.getColLower() + numCols);
+    _columnUpper.assign(_model.getColUpper(), _model.getColUpper() + numCols);
+}
+
+bool ClpBranchAndBound::provenOptimal() const
+{
+    return _provenOptimal;
+}
+
+int ClpBranchAndBound::nodes() const
+{
+    return _nodes;
+}
+
+int ClpBranchAndBound::iterations() const
+{
+    return _iterations;
+}
+
+void ClpBranchAndBound::applyBounds(const std::vector<BoundChange> & changes)
+{
+    // only integer columns are ever branched on, so only those need restoring
+    for (const auto i : _integerColumns)
+        _model.setColumnBounds(i, _columnLower[i], _columnUpper[i]);
+    for (const auto & change : changes)
+        _model.setColumnBounds(change.column, change.lower, change.upper);
+}
+
+int ClpBranchAndBound::mostFractionalColumn() const
+{
+    const auto solution = _model.getColSolution();
+    int best = -1;
+    FloatT bestFraction = _integerTolerance;
+    for (const auto i : _integerColumns)
+    {
+        const auto value = solution[i];
+        const auto fraction = mp::abs(value - mp::round(value));
+        if (fraction > bestFraction)
+        {
+            best = i;
+            bestFraction = fraction;
+        }
+    }
+    return best;
+}
+
+bool ClpBranchAndBound::solve(int maximumNodes)
+{
+    const auto numCols = _model.getNumCols();
+    std::vector<FloatT> incumbent;
+    std::vector<unsigned char> incumbentBasis;
+    FloatT incumbentValue = 0;
+
+    std::vector<Node> stack;
+    {
+        Node root;
+        root.bound = TOO_SMALL_FLOAT;
+        if (_model.statusExists())
+            root.basis.assign(_model.statusArray(), _model.statusArray() + numCols + _model.getNumRows());
+        stack.push_back(std::move(root));
+    }
+
+    _nodes = 0;
+    _iterations = 0;
+    bool stopped = false;
+    while (!stack.empty() && _nodes < maximumNodes)
+    {
+        // the event handler may stop the search between nodes, or within the dual of a node
+        if (_model.eventHandler()->event(ClpEventHandler::node) >= 0)
+        {
+            stopped = true;
+            break;
+        }
+        auto node = std::move(stack.back());
+        stack.pop_back();
+        if (!incumbent.empty() && node.bound >= incumbentValue - _integerTolerance)
+            continue;
+
+        ++_nodes;
+        applyBounds(node.changes);
+        if (!node.basis.empty())
+            _model.copyinStatus(node.basis.data());
+        _model.dual();
+        _iterations += _model.numberIterations();
+        if (_model.status() == 5)
+        {
+            stopped = true;
+            break;
+        }
+        if (_model.status() != 0)
+            continue; // infeasible, or unbounded relaxation
+
+        const auto objective = _model.objectiveValue() * _model.optimizationDirection();
+        if (!incumbent.empty() && objective >= incumbentValue - _integerTolerance)
+            continue;
+
+        const auto column = mostFractionalColumn();
+        std::vector<unsigned char> basis(_model.statusArray(), _model.statusArray() + numCols + _model.getNumRows());
+        if (column < 0)
+        {
+            incumbent.assign(_model.getColSolution(), _model.getColSolution() + numCols);
+            for (const auto i : _integerColumns)
+                incumbent[i] = mp::round(incumbent[i]);
+            incumbentBasis = std::move(basis);
+            incumbentValue = objective;
+            continue;
+        }
+
+        const auto value = _model.getColSolution()[column];
+        const auto lower = _model.getColLower()[column];
+        const auto upper = _model.getColUpper()[column];
+        Node down { node.changes, basis, objective };
+        down.changes.push_back({ column, lower, mp::floor(value) });
+        Node up { std::move(node.changes), std::move(basis), objective };
+        up.changes.push_back({ column, mp::ceil(value), upper });
+
+        // the branch nearest to the LP value is explored first
+        if (value - mp::floor(value) < FloatConst::Half)
+        {
+            stack.push_back(std::move(up));
+            stack.push_back(std::move(down));
+        }
+        else
+        {
+            stack.push_back(std::move(down));
+            stack.push_back(std::move(up));
+        }
+    }
+    _provenOptimal = stack.empty() && !stopped;
+
+    applyBounds({});
+    if (incumbent.empty())
+    {
+        // integer infeasible, or stopped on the node limit or by the event handler
+        _model.setProblemStatus(_provenOptimal ? 1 : 3);
+        return false;
+    }
+
+    _model.copyinStatus(incumbentBasis.data());
+    _model.setColSolution(incumbent.data());
+    _model.checkSolution();
+    _model.setProblemStatus(0);
+    return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "floatdef.h"
+#include <vector>
+
+class ClpSimplex;
+
+/// Depth first branch and bound over the integer columns of a ClpSimplex model. Every node is
+/// re-solved with the dual simplex starting from the basis of its parent, so a branch usually
+/// costs a handful of pivots. Nodes whose LP bound cannot beat the incumbent are pruned.
+class ClpBranchAndBound
+{
+public:
+    explicit ClpBranchAndBound(ClpSimplex & model);
+
+    /// Solves the model, which must already hold an optimal LP basis. Returns true when an
+    /// integer feasible solution was found, in which case it is left in the model. The search
+    /// stops after maximumNodes nodes, or when the event handler of the model returns 0 for the
+    /// node event or stops the dual simplex of a node, with the best solution found so far. The
+    /// model status is set to 0 when a solution was found, 1 when there is none and 3 when the
+    /// search was stopped first
+    bool solve(int maximumNodes);
+
+    /// True when the search finished without hitting the node limit, so the solution is optimal
+    bool provenOptimal() const;
+
+    int nodes() const;
+
+    int iterations() const;
+
+private:
+    struct BoundChange
+    {
+        int column;
+        FloatT lower;
+        FloatT upper;
+    };
+
+    struct Node
+    {
+        std::vector<BoundChange> changes;
+        std::vector<unsigned char> basis;
+        FloatT bound;
+    };
+
+    void applyBounds(const std::vector<BoundChange> & changes);
+
+    int mostFractionalColumn() const;
+
+    ClpSimplex & _model;
+    std::vector<int> _integerColumns;
+    std::vector<FloatT> _columnLower;
+    std::vector<FloatT> _columnUpper;
+    FloatT _integerTolerance;
+    int _nodes = 0;
+    int _iterations = 0;
+    bool _provenOptimal = false;
+};
@@ -0,0 +1,148 @@
+#include "ClpRanging.h"
+#include "ClpEventHandler.hpp"
+#include "ClpMatrixBase.hpp"
+#include "ClpSimplexDual.hpp"
+#include "ClpSimplexOther.hpp"
+#include "ClpSimplexPrimal.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace
+{
+// The start of ClpSimplex::dualRanging() and primalRanging(): primal from the optimal basis,
+// keeping the work arrays the ranging needs (startFinishOptions 1), cleaned up with dual when it
+// stops on status 10. The caller calls finish() once done, whatever this returns
+bool startRanging(ClpSimplex & model)
+{
+    const auto perturbation = model.perturbation();
+    model.setPerturbation(100);
+    static_cast<ClpSimplexPrimal &>(model).primal(0, 1);
+    if (model.status() == 10)
+    {
+        const auto denseFactorization = model.initialDenseFactorization();
+        model.setInitialDenseFactorization(true);
+        int dummy;
+        if ((model.clpMatrix()->generalExpanded(&model, 4, dummy) & 2) != 0)
+        {
+            const auto dualBound = model.dualBound();
+            if (model.upperOut() > 0)
+                model.setDualBound(2 * model.upperOut());
+            static_cast<ClpSimplexDual &>(model).dual(0, 1);
+            model.setDualBound(dualBound);
+        }
+        else
+        {
+            static_cast<ClpSimplexPrimal &>(model).primal(0, 1);
+        }
+        model.setInitialDenseFactorization(denseFactorization);
+        if (model.status() == 10)
+            model.setProblemStatus(0);
+    }
+    model.setPerturbation(perturbation);
+    return model.status() == 0 && model.secondaryStatus() != 6;
+}
+
+// Ranges blocks of variables taken from next until none is left, on one factorization
+bool rangeBlocks(ClpSimplex & model,
+                 const std::vector<int> & sequences,
+                 std::atomic<size_t> & next,
+                 ClpRanging::Ranges & ranges)
+{
+    const auto started = startRanging(model);
+    auto & other = static_cast<ClpSimplexOther &>(model);
+    // a copy that could not start leaves its share to the others
+    while (started)
+    {
+        const auto start = next.fetch_add(ClpRanging::BlockSize);
+        if (start >= sequences.size())
+            break;
+        const auto count = static_cast<int>(std::min<size_t>(ClpRanging::BlockSize, sequences.size() - start));
+        const auto which = &sequences[start];
+        other.dualRanging(count,
+                          which,
+                          &ranges.costIncrease[start],
+                          &ranges.costIncreaseSequence[start],
+                          &ranges.costDecrease[start],
+                          &ranges.costDecreaseSequence[start]);
+        other.primalRanging(count,
+                            which,
+                            &ranges.valueIncrease[start],
+                            &ranges.valueIncreaseSequence[start],
+                            &ranges.valueDecrease[start],
+                            &ranges.valueDecreaseSequence[start]);
+    }
+    model.finish();
+    return started;
+}
+} // namespace
+
+std::vector<int> ClpRanging::allSequences(const ClpSimplex & model)
+{
+    std::vector<int> sequences(model.getNumCols() + model.getNumRows());
+    for (size_t i = 0; i < sequences.size(); ++i)
+        sequences[i] = static_cast<int>(i);
+    return sequences;
+}
+
+bool ClpRanging::compute(ClpSimplex & model, const std::vector<int> & sequences, int threads, Ranges & ranges)
+{
+    const auto numSequences = model.getNumCols() + model.getNumRows();
+    if (model.status() != 0 || !model.statusExists())
+        return false;
+    for (const auto sequence : sequences)
+    {
+        if (sequence < 0 || sequence >= numSequences)
+            return false;
+    }
+
+    const auto count = sequences.size();
+    ranges.costIncrease.assign(count, 0);
+    ranges.costIncreaseSequence.assign(count, -1);
+    ranges.costDecrease.assign(count, 0);
+    ranges.costDecreaseSequence.assign(count, -1);
+    ranges.valueIncrease.assign(count, 0);
+    ranges.valueIncreaseSequence.assign(count, -1);
+    ranges.valueDecrease.assign(count, 0);
+    ranges.valueDecreaseSequence.assign(count, -1);
+    if (!count)
+        return true;
+
+#ifdef __EMSCRIPTEN__
+    threads = 1;
+#else
+    if (threads <= 0)
+        threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+#endif
+    const auto blocks = static_cast<int>((count + BlockSize - 1) / BlockSize);
+    threads = std::min(threads, blocks);
+
+    std::atomic<size_t> next { 0 };
+    if (threads <= 1)
+        return rangeBlocks(model, sequences, next, ranges);
+
+    // the copies start from the same basis; they get a plain event handler, as the limits of
+    // the wrapper are not meant to be shared between threads, and no log
+    const ClpEventHandler plainHandler;
+    std::vector<std::unique_ptr<ClpSimplex>> copies;
+    for (int t = 1; t < threads; ++t)
+    {
+        copies.push_back(std::make_unique<ClpSimplex>(model));
+        copies.back()->passInEventHandler(&plainHandler);
+        copies.back()->setLogLevel(0);
+    }
+
+    std::vector<char> succeeded(threads, 0);
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t)
+    {
+        workers.emplace_back([&, t] { succeeded[t] = rangeBlocks(*copies[t - 1], sequences, next, ranges); });
+    }
+    succeeded[0] = rangeBlocks(model, sequences, next, ranges);
+    for (auto & worker : workers)
+        worker.join();
+    // the blocks of a model that could not start were taken by the others
+    return std::any_of(succeeded.begin(), succeeded.end(), [](char s) { return s != 0; });
+}
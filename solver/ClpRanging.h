@@ -0,0 +1,43 @@
+#pragma once
+#include "floatdef.h"
+#include <vector>
+
+class ClpSimplex;
+
+/// Sensitivity analysis of an optimal ClpSimplex model for many variables at once, through the
+/// dualRanging() and primalRanging() of ClpSimplexOther. The public ClpSimplex entry points
+/// refactorize the basis on every call; here one factorization serves every variable and the
+/// variables are ranged in blocks, so a full model costs one FTRAN and one BTRAN per variable on
+/// top of a single start. Native builds can split the blocks over threads, each one ranging on
+/// its own copy of the model.
+///
+/// Variables are sequence numbers, columns first and then rows (numCols + row).
+class ClpRanging
+{
+public:
+    static constexpr int BlockSize = 256;
+
+    struct Ranges
+    {
+        /// How much the cost of the variable can increase (decrease) before the basis changes,
+        /// and the variable that would then enter it, -1 for none
+        std::vector<FloatT> costIncrease;
+        std::vector<int> costIncreaseSequence;
+        std::vector<FloatT> costDecrease;
+        std::vector<int> costDecreaseSequence;
+        /// How much the value of the variable can increase (decrease) before the basis changes,
+        /// and the basic variable that would then leave it, -1 for none
+        std::vector<FloatT> valueIncrease;
+        std::vector<int> valueIncreaseSequence;
+        std::vector<FloatT> valueDecrease;
+        std::vector<int> valueDecreaseSequence;
+    };
+
+    /// Ranges the given variables of a model holding an optimal basis. threads <= 0 uses every
+    /// hardware thread, WASM builds always use one. Returns false when the model is not optimal
+    /// or a sequence number is out of range
+    static bool compute(ClpSimplex & model, const std::vector<int> & sequences, int threads, Ranges & ranges);
+
+    /// Every column and row of the model
+    static std::vector<int> allSequences(const ClpSimplex & model);
+};
@@ -0,0 +1,230 @@
+#include "ClpSolutionCache.h"
+#include "ClpSimplex.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+template <typename T>
+void appendRaw(std::string & key, const T & value)
+{
+    key.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Exact encoding of a value: the bytes of builtin types, the full precision decimal of
+// multiprecision ones, whose objects may hold padding or unnormalized digits
+void appendValue(std::string & key, const FloatT & value)
+{
+#ifdef CLP_FLOAT_BUILTIN
+    appendRaw(key, value);
+#else
+    key += value.str(0, std::ios_base::scientific);
+    key += ';';
+#endif
+}
+
+void appendValues(std::string & key, const FloatT * values, int count)
+{
+    for (int i = 0; i < count; ++i)
+        appendValue(key, values[i]);
+}
+
+// Header and per column integrality, then the (row, value) nonzeros of every column sorted by
+// row. Explicit zeros are left out, so they do not change the structure
+void appendColumns(std::string & key, const ClpSimplex & model, bool withValues)
+{
+    const auto numRows = model.getNumRows();
+    const auto numCols = model.getNumCols();
+    appendRaw(key, numRows);
+    appendRaw(key, numCols);
+    appendRaw(key, static_cast<int>(model.optimizationDirection()));
+
+    const auto matrix = model.matrix();
+    const auto starts = matrix->getVectorStarts();
+    const auto lengths = matrix->getVectorLengths();
+    const auto rows = matrix->getIndices();
+    const auto elements = matrix->getElements();
+    std::vector<std::pair<int, const FloatT *>> column;
+    for (int c = 0; c < numCols; ++c)
+    {
+        column.clear();
+        for (auto k = starts[c]; k < starts[c] + lengths[c]; ++k)
+        {
+            if (elements[k] != 0)
+                column.emplace_back(rows[k], &elements[k]);
+        }
+        std::sort(column.begin(), column.end(), [](const auto & a, const auto & b) { return a.first < b.first; });
+
+        key += model.isInteger(c) ? 'I' : 'C';
+        appendRaw(key, static_cast<int>(column.size()));
+        for (const auto & [row, element] : column)
+        {
+            appendRaw(key, row);
+            if (withValues)
+                appendValue(key, *element);
+        }
+    }
+}
+
+template <typename T>
+size_t vectorBytes(const std::vector<T> & vec)
+{
+    return vec.capacity() * sizeof(T);
+}
+
+std::vector<FloatT> copyValues(const FloatT * values, int count)
+{
+    return values ? std::vector<FloatT>(values, values + count) : std::vector<FloatT>(count, FloatT(0));
+}
+
+void copyValuesTo(const std::vector<FloatT> & values, FloatT * target)
+{
+    if (target)
+        std::copy(values.begin(), values.end(), target);
+}
+} // namespace
+
+std::string ClpSolutionCache::modelKey(const ClpSimplex & model)
+{
+    std::string key = "M";
+    appendColumns(key, model, true);
+    appendValue(key, model.objectiveOffset());
+    appendValues(key, model.getObjCoefficients(), model.getNumCols());
+    appendValues(key, model.getColLower(), model.getNumCols());
+    appendValues(key, model.getColUpper(), model.getNumCols());
+    appendValues(key, model.getRowLower(), model.getNumRows());
+    appendValues(key, model.getRowUpper(), model.getNumRows());
+    return key;
+}
+
+std::string ClpSolutionCache::structureKey(const ClpSimplex & model)
+{
+    std::string key = "S";
+    appendColumns(key, model, false);
+    return key;
+}
+
+void ClpSolutionCache::setMaxBytes(size_t maxBytes)
+{
+    _stats.maxBytes = maxBytes;
+    evict(maxBytes);
+}
+
+bool ClpSolutionCache::enabled() const
+{
+    return _stats.maxBytes > 0;
+}
+
+const ClpSolutionCache::Entry * ClpSolutionCache::find(const std::string & modelKey)
+{
+    const auto found = _byModel.find(modelKey);
+    if (found == _byModel.end())
+        return nullptr;
+    _entries.splice(_entries.begin(), _entries, found->second);
+    ++_stats.hits;
+    return &*found->second;
+}
+
+const std::vector<unsigned char> * ClpSolutionCache::findBasis(const std::string & structureKey)
+{
+    const auto found = _byStructure.find(structureKey);
+    if (found == _byStructure.end())
+    {
+        ++_stats.misses;
+        return nullptr;
+    }
+    _entries.splice(_entries.begin(), _entries, found->second);
+    ++_stats.warmStarts;
+    return &found->second->basis;
+}
+
+void ClpSolutionCache::store(std::string modelKey,
+                             std::string structureKey,
+                             std::vector<unsigned char> basis,
+                             const ClpSimplex & model,
+                             bool integerSolution,
+                             int nodes)
+{
+    const auto numRows = model.getNumRows();
+    const auto numCols = model.getNumCols();
+    Entry entry;
+    entry.basis = std::move(basis);
+    entry.columnSolution = copyValues(model.getColSolution(), numCols);
+    entry.rowActivity = copyValues(model.primalRowSolution(), numRows);
+    entry.duals = copyValues(model.dualRowSolution(), numRows);
+    entry.reducedCosts = copyValues(model.dualColumnSolution(), numCols);
+    entry.objectiveValue = model.objectiveValue();
+    entry.integerSolution = integerSolution;
+    entry.nodes = nodes;
+    // both keys are counted twice, once in the entry and once in its index
+    entry.bytes = sizeof(Entry) + 2 * (modelKey.size() + structureKey.size()) + vectorBytes(entry.basis)
+        + vectorBytes(entry.columnSolution) + vectorBytes(entry.rowActivity) + vectorBytes(entry.duals)
+        + vectorBytes(entry.reducedCosts);
+    if (entry.bytes > _stats.maxBytes)
+        return;
+
+    const auto existing = _byModel.find(modelKey);
+    if (existing != _byModel.end())
+    {
+        const auto old = existing->second;
+        _byModel.erase(existing);
+        const auto sameStructure = _byStructure.find(old->structureKey);
+        if (sameStructure != _byStructure.end() && sameStructure->second == old)
+            _byStructure.erase(sameStructure);
+        _stats.bytes -= old->bytes;
+        _entries.erase(old);
+    }
+    evict(_stats.maxBytes - entry.bytes);
+
+    entry.modelKey = std::move(modelKey);
+    entry.structureKey = std::move(structureKey);
+    _stats.bytes += entry.bytes;
+    _entries.push_front(std::move(entry));
+    const auto stored = _entries.begin();
+    _byModel[stored->modelKey] = stored;
+    _byStructure[stored->structureKey] = stored;
+    _stats.entries = _entries.size();
+}
+
+void ClpSolutionCache::restore(const Entry & entry, ClpSimplex & model)
+{
+    model.copyinStatus(entry.basis.data());
+    copyValuesTo(entry.columnSolution, model.primalColumnSolution());
+    copyValuesTo(entry.rowActivity, model.primalRowSolution());
+    copyValuesTo(entry.duals, model.dualRowSolution());
+    copyValuesTo(entry.reducedCosts, model.dualColumnSolution());
+    model.setObjectiveValue(entry.objectiveValue);
+    model.setNumberIterations(0);
+    model.setProblemStatus(0);
+    model.setSecondaryStatus(0);
+}
+
+void ClpSolutionCache::clear()
+{
+    _entries.clear();
+    _byModel.clear();
+    _byStructure.clear();
+    _stats.bytes = 0;
+    _stats.entries = 0;
+}
+
+ClpSolutionCache::Stats ClpSolutionCache::stats() const
+{
+    return _stats;
+}
+
+void ClpSolutionCache::evict(size_t maxBytes)
+{
+    while (!_entries.empty() && _stats.bytes > maxBytes)
+    {
+        const auto last = std::prev(_entries.end());
+        _byModel.erase(last->modelKey);
+        const auto sameStructure = _byStructure.find(last->structureKey);
+        if (sameStructure != _byStructure.end() && sameStructure->second == last)
+            _byStructure.erase(sameStructure);
+        _stats.bytes -= last->bytes;
+        _entries.erase(last);
+    }
+    _stats.entries = _entries.size();
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "floatdef.h"
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ClpSimplex;
+
+/// LRU cache of optimal solutions keyed by the content of the loaded model. Two keys are built
+/// from the model after parsing, leaving out names and the order of the nonzeros in a column:
+/// the model key covers every number (objective, bounds, matrix, direction, integrality), the
+/// structure key only the dimensions, the sparsity pattern and integrality. A model key hit
+/// restores the stored solution without solving, a structure key hit gives the optimal basis of
+/// the last model with the same structure as a warm start. Rows and columns are positional in
+/// the results, so their order is part of both keys.
+class ClpSolutionCache
+{
+public:
+    struct Stats
+    {
+        size_t hits = 0;
+        size_t warmStarts = 0;
+        size_t misses = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+        size_t maxBytes = 0;
+    };
+
+    struct Entry
+    {
+        std::string modelKey;
+        std::string structureKey;
+        /// Basis of the LP optimum, before branch and bound changed it
+        std::vector<unsigned char> basis;
+        std::vector<FloatT> columnSolution;
+        std::vector<FloatT> rowActivity;
+        std::vector<FloatT> duals;
+        std::vector<FloatT> reducedCosts;
+        FloatT objectiveValue;
+        bool integerSolution = false;
+        int nodes = 0;
+        size_t bytes = 0;
+    };
+
+    static std::string modelKey(const ClpSimplex & model);
+
+    static std::string structureKey(const ClpSimplex & model);
+
+    /// Evicts least recently used entries down to maxBytes, 0 disabling the cache
+    void setMaxBytes(size_t maxBytes);
+
+    bool enabled() const;
+
+    /// Entry solving the model with this key, counted as a hit, or nullptr
+    const Entry * find(const std::string & modelKey);
+
+    /// Basis of the most recent entry with this structure, counted as a warm start, or nullptr.
+    /// Models missing both are counted as misses
+    const std::vector<unsigned char> * findBasis(const std::string & structureKey);
+
+    /// Stores the solution held by the model, which must have been solved to optimality
+    /// starting from basis. Entries larger than the limit are not stored
+    void store(std::string modelKey,
+               std::string structureKey,
+               std::vector<unsigned char> basis,
+               const ClpSimplex & model,
+               bool integerSolution,
+               int nodes);
+
+    /// Puts a stored solution into the model loaded from the same content
+    static void restore(const Entry & entry, ClpSimplex & model);
+
+    void clear();
+
+    Stats stats() const;
+
+private:
+    using Entries = std::list<Entry>;
+
+    void evict(size_t maxBytes);
+
+    Entries _entries; // most recently used first
+    std::unordered_map<std::string, Entries::iterator> _byModel;
+    std::unordered_map<std::string, Entries::iterator> _byStructure;
+    Stats _stats;
+};
@@ -0,0 +1,178 @@
+#include "ClpSolveLimits.h"
+#include "ClpNonLinearCost.hpp"
+#include "ClpSimplex.hpp"
+
+ClpSolveLimits::ClpSolveLimits()
+: _state(std::make_shared<State>())
+{
+}
+
+ClpEventHandler * ClpSolveLimits::clone() const
+{
+    return new ClpSolveLimits(*this);
+}
+
+void ClpSolveLimits::setTimeLimit(double seconds)
+{
+    // integer durations only, floatdef.h specializes std::common_type<T, double>
+    _state->timeLimit = std::chrono::nanoseconds(seconds > 0 ? static_cast<int64_t>(seconds * 1.0e9) : 0);
+}
+
+void ClpSolveLimits::setIterationLimit(int iterations)
+{
+    _state->iterationLimit = iterations > 0 ? iterations : 0;
+}
+
+void ClpSolveLimits::cancel()
+{
+    _state->cancelRequested = true;
+}
+
+#ifdef __EMSCRIPTEN__
+void ClpSolveLimits::setCancelFlag(emscripten::val flag)
+{
+    _state->cancelFlag = flag.isUndefined() || flag.isNull() ? emscripten::val::undefined() : flag;
+}
+#endif
+
+void ClpSolveLimits::start()
+{
+    auto & state = *_state;
+    state.deadline = std::chrono::steady_clock::now() + state.timeLimit;
+    state.iterations = 0;
+    state.iterationsByKind.fill(0);
+    state.stopped = Stop::NONE;
+    state.phaseTimes.fill(std::chrono::nanoseconds::zero());
+    state.phase = Phase::COUNT;
+    state.presolvedRows = state.presolvedColumns = 0;
+}
+
+ClpSolveLimits::Stop ClpSolveLimits::stopped() const
+{
+    return _state->stopped;
+}
+
+const char * ClpSolveLimits::name(Stop stop)
+{
+    switch (stop)
+    {
+    case Stop::NONE:
+        return "";
+    case Stop::TIME:
+        return "time";
+    case Stop::ITERATIONS:
+        return "iterations";
+    case Stop::CANCELLED:
+        return "cancelled";
+    }
+    return "";
+}
+
+std::chrono::nanoseconds ClpSolveLimits::phaseTime(Phase phase) const
+{
+    return phase == Phase::COUNT ? std::chrono::nanoseconds::zero() : _state->phaseTimes[static_cast<size_t>(phase)];
+}
+
+int ClpSolveLimits::iterations(Iterations kind) const
+{
+    return kind == Iterations::COUNT ? 0 : _state->iterationsByKind[static_cast<size_t>(kind)];
+}
+
+int ClpSolveLimits::presolvedRows() const
+{
+    return _state->presolvedRows;
+}
+
+int ClpSolveLimits::presolvedColumns() const
+{
+    return _state->presolvedColumns;
+}
+
+void ClpSolveLimits::enterPhase(Phase phase)
+{
+    auto & state = *_state;
+    const auto now = std::chrono::steady_clock::now();
+    if (state.phase != Phase::COUNT)
+        state.phaseTimes[static_cast<size_t>(state.phase)] += now - state.phaseStart;
+    state.phase = phase;
+    state.phaseStart = now;
+}
+
+ClpSolveLimits::Iterations ClpSolveLimits::iterationKind() const
+{
+    // ClpSolve clears the simplex of the handler for the barrier
+    if (!model_)
+        return Iterations::BARRIER;
+    if (model_->algorithm() < 0)
+        return Iterations::DUAL;
+    const auto nonLinearCost = model_->nonLinearCost();
+    return nonLinearCost && nonLinearCost->numberInfeasibilities() ? Iterations::PRIMAL_PHASE1
+                                                                    : Iterations::PRIMAL_PHASE2;
+}
+
+bool ClpSolveLimits::cancelRequested()
+{
+    auto & state = *_state;
+    if (state.cancelRequested.exchange(false))
+        return true;
+#ifdef __EMSCRIPTEN__
+    if (!state.cancelFlag.isUndefined())
+    {
+        const auto atomics = emscripten::val::global("Atomics");
+        if (atomics.call<int>("exchange", state.cancelFlag, 0, 0) != 0)
+            return true;
+    }
+#endif
+    return false;
+}
+
+int ClpSolveLimits::event(Event whichEvent)
+{
+    switch (whichEvent)
+    {
+    case endOfIteration:
+    case node:
+        break;
+    case presolveStart:
+        enterPhase(Phase::PRESOLVE);
+        return -1;
+    case presolveBeforeSolve:
+        // sent by the model the simplex runs on, the presolved copy when there is one
+        if (model_)
+        {
+            _state->presolvedRows = model_->numberRows();
+            _state->presolvedColumns = model_->numberColumns();
+        }
+        enterPhase(Phase::SOLVE);
+        return -1;
+    case presolveAfterSolve:
+        enterPhase(Phase::POSTSOLVE);
+        return -1;
+    case presolveAfterFirstSolve:
+        enterPhase(Phase::CLEANUP);
+        return -1;
+    case presolveInfeasible:
+    case presolveEnd:
+        enterPhase(Phase::COUNT);
+        return -1;
+    default:
+        return -1;
+    }
+
+    auto & state = *_state;
+    if (state.stopped != Stop::NONE)
+        return 0;
+    if (whichEvent == endOfIteration)
+    {
+        ++state.iterations;
+        ++state.iterationsByKind[static_cast<size_t>(iterationKind())];
+    }
+
+    if (cancelRequested())
+        state.stopped = Stop::CANCELLED;
+    else if (state.iterationLimit > 0 && state.iterations >= state.iterationLimit)
+        state.stopped = Stop::ITERATIONS;
+    else if (state.timeLimit.count() > 0 && std::chrono::steady_clock::now() >= state.deadline)
+        state.stopped = Stop::TIME;
+    return state.stopped == Stop::NONE ? -1 : 0;
+}
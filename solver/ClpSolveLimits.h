@@ -0,0 +1,126 @@
+#pragma once
+#include "ClpEventHandler.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/val.h>
+#endif
+
+/// Event handler stopping primal() and dual() at the end of an iteration once the time or
+/// iteration limit of the solve is reached or it is cancelled. The simplex then returns with
+/// status 5 and the current basis and solution in the model. ClpSimplex keeps a clone of its
+/// handler, so copies share the limits and the cancellation flag with the original.
+///
+/// It also times the phases of ClpSimplex::initialSolve() from the presolve events ClpSolve
+/// sends, the presolved copy of the model reporting through its clone of the handler, and
+/// counts the iterations of each algorithm.
+class ClpSolveLimits : public ClpEventHandler
+{
+public:
+    enum class Stop
+    {
+        NONE,
+        TIME,
+        ITERATIONS,
+        CANCELLED
+    };
+
+    enum class Phase
+    {
+        PRESOLVE,
+        SOLVE,
+        POSTSOLVE,
+        CLEANUP,
+        COUNT
+    };
+
+    /// Primal iterations are in phase 1 while the solution is primal infeasible. Barrier
+    /// iterations are those reported without a simplex model
+    enum class Iterations
+    {
+        PRIMAL_PHASE1,
+        PRIMAL_PHASE2,
+        DUAL,
+        BARRIER,
+        COUNT
+    };
+
+    ClpSolveLimits();
+
+    ClpEventHandler * clone() const override;
+
+    /// Stops on endOfIteration, and on the node event sent by ClpBranchAndBound, once a limit
+    /// is reached. Every later event of the same solve stops it as well. The presolve events
+    /// only move the phase clock
+    int event(Event whichEvent) override;
+
+    /// Wall clock seconds a solve may take, 0 for no limit
+    void setTimeLimit(double seconds);
+
+    /// Simplex iterations a solve may take, branch and bound nodes included, 0 for no limit
+    void setIterationLimit(int iterations);
+
+    /// Stops the running solve, or the next one when none is running. Safe to call from any
+    /// thread; the request is consumed by the solve it stops
+    void cancel();
+
+#ifdef __EMSCRIPTEN__
+    /// Int32Array, typically over a SharedArrayBuffer written by another thread, whose first
+    /// element cancels like cancel() when nonzero and is reset to 0 by the solve it stops.
+    /// undefined or null detaches it
+    void setCancelFlag(emscripten::val flag);
+#endif
+
+    /// Starts counting time and iterations for a new solve
+    void start();
+
+    /// Why the last solve stopped early, NONE when it ran to completion
+    Stop stopped() const;
+
+    static const char * name(Stop stop);
+
+    /// Time the last solve spent in a phase of ClpSimplex::initialSolve(), zero for the phases
+    /// it did not go through
+    std::chrono::nanoseconds phaseTime(Phase phase) const;
+
+    /// Iterations of one kind in the last solve
+    int iterations(Iterations kind) const;
+
+    /// Size of the model the last initialSolve() ran the simplex on, after presolve
+    int presolvedRows() const;
+    int presolvedColumns() const;
+
+private:
+    struct State
+    {
+        std::chrono::nanoseconds timeLimit { 0 };
+        int iterationLimit = 0;
+        std::chrono::steady_clock::time_point deadline;
+        int iterations = 0;
+        std::array<int, static_cast<size_t>(Iterations::COUNT)> iterationsByKind {};
+        Stop stopped = Stop::NONE;
+        std::array<std::chrono::nanoseconds, static_cast<size_t>(Phase::COUNT)> phaseTimes {};
+        Phase phase = Phase::COUNT;
+        std::chrono::steady_clock::time_point phaseStart;
+        int presolvedRows = 0;
+        int presolvedColumns = 0;
+        std::atomic<bool> cancelRequested { false };
+#ifdef __EMSCRIPTEN__
+        emscripten::val cancelFlag = emscripten::val::undefined();
+#endif
+    };
+
+    bool cancelRequested();
+
+    Iterations iterationKind() const;
+
+    /// Closes the running phase, if any, and starts the given one; COUNT only closes
+    void enterPhase(Phase phase);
+
+    std::shared_ptr<State> _state;
+};
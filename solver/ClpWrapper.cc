@@ -1,13 +1,29 @@
 
 #include "ClpWrapper.h"
+#include "ClpBranchAndBound.h"
+#include "ClpFactorization.hpp"
+#include "ClpRanging.h"
 #include "ClpSimplex.hpp"
+#include "ClpSolve.hpp"
+#include "ClpTaskPool.hpp"
 #include "floatdef.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cctype>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <string>
 
-FILE * CbcOrClpReadCommand = stdin;
-int CbcOrClpRead_mode = 1;
+#if defined(__EMSCRIPTEN__)
+#include <emscripten/heap.h>
+#elif !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+thread_local FILE * CbcOrClpReadCommand = stdin;
+thread_local int CbcOrClpRead_mode = 1;
 
 struct Membuf : std::streambuf
 {
@@ -27,21 +43,50 @@ struct Imemstream : virtual Membuf, std::istream
     }
 };
 
-std::string readContent(const std::string & problemFileOrContent)
+// Reads the chunks of a parse session in order, releasing every chunk once the parser has moved
+// past it, so the text is held at most once while the model is built
+struct ChunkStreambuf : std::streambuf
 {
-    using namespace std;
-    ifstream file(problemFileOrContent.c_str());
-    string problemContent;
-    if (file.good())
+    explicit ChunkStreambuf(std::deque<std::string> & chunks)
+    : _chunks(chunks)
     {
-        return string { istreambuf_iterator<char>(file), istreambuf_iterator<char>() };
     }
-    return problemFileOrContent;
-}
+
+    int_type underflow() override
+    {
+        if (_inUse)
+            _chunks.pop_front();
+        while (!_chunks.empty() && _chunks.front().empty())
+            _chunks.pop_front();
+        _inUse = !_chunks.empty();
+        if (!_inUse)
+            return traits_type::eof();
+
+        auto & chunk = _chunks.front();
+        setg(&chunk[0], &chunk[0], &chunk[0] + chunk.size());
+        return traits_type::to_int_type(chunk[0]);
+    }
+
+private:
+    std::deque<std::string> & _chunks;
+    bool _inUse = false;
+};
 
 ClpWrapper::ClpWrapper()
 : _model(std::make_shared<ClpSimplex>())
 {
+    // the model keeps a clone, which shares its limits and cancellation flag with _limits
+    _model->passInEventHandler(&_limits);
+}
+
+std::string ClpWrapper::engine()
+{
+    return CLP_FLOAT_ENGINE;
+}
+
+int ClpWrapper::setThreads(int threads)
+{
+    return ClpTaskPool::setThreads(threads);
 }
 
 std::string ClpWrapper::solve(const std::string & problemFileOrContent, int precision)
@@ -51,21 +96,454 @@ std::string ClpWrapper::solve(const std::string & problemFileOrContent, int prec
         return {};
     }
 
-    primal();
+    return solveLoaded(precision);
+}
+
+// integer durations only, floatdef.h specializes std::common_type<T, double>
+int64_t nowNs()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+std::string ClpWrapper::solveLoaded(int precision)
+{
+    int64_t branchAndBoundNs = 0;
+    ClpSolveStats::Totals kernels;
+    const ClpSolveStats::Collect collect(_solveOptions.stats ? &kernels : nullptr);
+    const auto solution = [&] {
+        auto result = getSolution(precision);
+        if (_solveOptions.method.empty() && !_solveOptions.stats)
+            return result;
+        // getSolution() ends with the closing brace of its object
+        result.pop_back();
+        if (!_solveOptions.method.empty())
+            result += ",\"phases\":" + phasesJson(branchAndBoundNs);
+        if (_solveOptions.stats)
+            result += ",\"stats\":" + statsJson(kernels);
+        return result + '}';
+    };
+    const auto integerSearch = [&] {
+        const auto start = nowNs();
+        branchAndBound(DefaultMaximumNodes);
+        branchAndBoundNs = nowNs() - start;
+    };
+
+    _limits.start();
+    if (!_cache.enabled())
+    {
+        solveLp();
+        if (hasIntegers())
+            integerSearch();
+        return solution();
+    }
+
+    auto modelKey = ClpSolutionCache::modelKey(*_model);
+    if (const auto entry = _cache.find(modelKey))
+    {
+        ClpSolutionCache::restore(*entry, *_model);
+        _boundsChanged = _objectiveChanged = false;
+        _integerSolution = entry->integerSolution;
+        _nodes = entry->nodes;
+        return solution();
+    }
+
+    auto structureKey = ClpSolutionCache::structureKey(*_model);
+    if (const auto basis = _cache.findBasis(structureKey))
+        _model->copyinStatus(basis->data());
+    solveLp();
+    const auto statusArray = _model->statusArray();
+    std::vector<unsigned char> basis;
+    if (_model->status() == 0 && statusArray)
+        basis.assign(statusArray, statusArray + _model->getNumCols() + _model->getNumRows());
+    if (hasIntegers())
+        integerSearch();
+    // a solution cut short by the limits may not be the optimal one
+    if (_model->status() == 0 && !basis.empty() && _limits.stopped() == ClpSolveLimits::Stop::NONE)
+        _cache.store(std::move(modelKey), std::move(structureKey), std::move(basis), *_model, _integerSolution, _nodes);
+
+    return solution();
+}
+
+bool solveTypeFromName(const std::string & name, ClpSolve::SolveType & type)
+{
+    static const std::pair<const char *, ClpSolve::SolveType> types[] = {
+        { "auto", ClpSolve::automatic },
+        { "dual", ClpSolve::useDual },
+        { "primal", ClpSolve::usePrimal },
+        { "sprint", ClpSolve::usePrimalorSprint },
+        { "barrier", ClpSolve::useBarrier },
+    };
+    for (const auto & [typeName, value] : types)
+    {
+        if (name == typeName)
+        {
+            type = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ClpWrapper::setSolveOptions(const SolveOptions & options)
+{
+    ClpSolve::SolveType type;
+    if ((!options.method.empty() && !solveTypeFromName(options.method, type)) || options.presolvePasses < 0)
+        return false;
+    _solveOptions = options;
+    return true;
+}
+
+const ClpWrapper::SolveOptions & ClpWrapper::solveOptions() const
+{
+    return _solveOptions;
+}
+
+void ClpWrapper::solveLp()
+{
+    ClpSolve::SolveType type;
+    if (!solveTypeFromName(_solveOptions.method, type))
+    {
+        primal();
+        return;
+    }
+
+    ClpSolve solveOptions;
+    solveOptions.setSolveType(type);
+    if (!_solveOptions.presolve)
+        solveOptions.setPresolveType(ClpSolve::presolveOff);
+    else if (_solveOptions.presolvePasses > 0)
+        solveOptions.setPresolveType(ClpSolve::presolveNumber, _solveOptions.presolvePasses);
+    // no SIGINT handler: it goes through a global model pointer, and cancel() covers interrupts
+    solveOptions.setSpecialOption(2, 1);
+
+    _limits.start();
+    _model->initialSolve(solveOptions);
+    applyStopStatus();
+    _boundsChanged = _objectiveChanged = false;
+    _integerSolution = false;
+}
+
+std::string ClpWrapper::phasesJson(int64_t branchAndBoundNs) const
+{
+    using Phase = ClpSolveLimits::Phase;
+    const auto ms = [](int64_t ns) { return static_cast<double>(ns) / 1.0e6; };
+    const auto phaseMs = [&](Phase phase) { return ms(_limits.phaseTime(phase).count()); };
+    std::stringstream ss;
+    ss << "{\"presolveMs\":" << phaseMs(Phase::PRESOLVE) << ",\"solveMs\":" << phaseMs(Phase::SOLVE)
+       << ",\"postsolveMs\":" << phaseMs(Phase::POSTSOLVE) << ",\"cleanupMs\":" << phaseMs(Phase::CLEANUP)
+       << ",\"branchAndBoundMs\":" << ms(branchAndBoundNs) << ",\"presolvedRows\":" << _limits.presolvedRows()
+       << ",\"presolvedColumns\":" << _limits.presolvedColumns() << "}";
+    return ss.str();
+}
+
+// Peak resident set of the process; the WASM heap only grows, so its size is its peak
+int64_t peakMemoryBytes()
+{
+#if defined(__EMSCRIPTEN__)
+    return static_cast<int64_t>(emscripten_get_heap_size());
+#elif defined(_WIN32)
+    return 0;
+#else
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return static_cast<int64_t>(usage.ru_maxrss);
+#else
+    return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+std::string ClpWrapper::statsJson(const ClpSolveStats::Totals & kernels) const
+{
+    using Iterations = ClpSolveLimits::Iterations;
+    const auto ms = [&](ClpSolveStats::Kernel kernel) { return static_cast<double>(kernels.nanoseconds[kernel]) / 1.0e6; };
+    const auto presolved = !_solveOptions.method.empty();
+    std::stringstream ss;
+    ss << "{\"primalPhase1Iterations\":" << _limits.iterations(Iterations::PRIMAL_PHASE1)
+       << ",\"primalPhase2Iterations\":" << _limits.iterations(Iterations::PRIMAL_PHASE2)
+       << ",\"dualIterations\":" << _limits.iterations(Iterations::DUAL)
+       << ",\"barrierIterations\":" << _limits.iterations(Iterations::BARRIER)
+       << ",\"factorizations\":" << kernels.calls[ClpSolveStats::factorize]
+       << ",\"lElements\":" << kernels.lElements << ",\"uElements\":" << kernels.uElements
+       << ",\"factorizeMs\":" << ms(ClpSolveStats::factorize) << ",\"ftranMs\":" << ms(ClpSolveStats::ftran)
+       << ",\"ftrans\":" << kernels.calls[ClpSolveStats::ftran] << ",\"btranMs\":" << ms(ClpSolveStats::btran)
+       << ",\"btrans\":" << kernels.calls[ClpSolveStats::btran] << ",\"pricingMs\":" << ms(ClpSolveStats::pricing)
+       << ",\"ratioTestMs\":" << ms(ClpSolveStats::ratioTest)
+       << ",\"rowsRemoved\":" << (presolved ? _model->getNumRows() - _limits.presolvedRows() : 0)
+       << ",\"columnsRemoved\":" << (presolved ? _model->getNumCols() - _limits.presolvedColumns() : 0)
+       << ",\"peakMemoryBytes\":" << peakMemoryBytes() << "}";
+    return ss.str();
+}
+
+void ClpWrapper::setCacheLimit(size_t maxBytes)
+{
+    _cache.setMaxBytes(maxBytes);
+}
+
+void ClpWrapper::clearCache()
+{
+    _cache.clear();
+}
+
+ClpSolutionCache::Stats ClpWrapper::cacheStats() const
+{
+    return _cache.stats();
+}
+
+std::string ClpWrapper::cacheStatsJson() const
+{
+    const auto stats = _cache.stats();
+    std::stringstream ss;
+    ss << "{\"hits\":" << stats.hits << ",\"warmStarts\":" << stats.warmStarts << ",\"misses\":" << stats.misses
+       << ",\"entries\":" << stats.entries << ",\"bytes\":" << stats.bytes << ",\"maxBytes\":" << stats.maxBytes
+       << "}";
+    return ss.str();
+}
+
+void ClpWrapper::beginBatch(size_t count)
+{
+    // clear() keeps the capacity reached by previous batches
+    _batchResults.clear();
+    _batchResults += '[';
+    _batchTimings.clear();
+    _batchTimings.reserve(count);
+    _model->factorization()->setPersistenceFlag(2);
+}
+
+void ClpWrapper::addBatchResult(bool loaded, int precision, int64_t startNs)
+{
+    const auto result = loaded ? solveLoaded(precision) : std::string {};
+    _batchTimings.push_back(static_cast<double>(nowNs() - startNs) / 1.0e6);
+    if (_batchResults.size() > 1)
+        _batchResults += ',';
+    _batchResults += result.empty() ? "null" : result;
+}
+
+std::string ClpWrapper::solveBatch(const std::vector<std::string> & problemFilesOrContents, int precision)
+{
+    return solveBatch(
+        problemFilesOrContents.size(), [&](size_t i) { return readLp(problemFilesOrContents[i]); }, precision);
+}
+
+std::string ClpWrapper::solveBatch(size_t count, const std::function<bool(size_t)> & loadProblem, int precision)
+{
+    beginBatch(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto start = nowNs();
+        addBatchResult(loadProblem(i), precision, start);
+    }
+    _batchResults += ']';
+    return _batchResults;
+}
+
+const std::vector<double> & ClpWrapper::batchTimings() const
+{
+    return _batchTimings;
+}
+
+std::string ClpWrapper::solveFromBasis(const std::string & problemFileOrContent,
+                                       const std::string & basis,
+                                       int precision)
+{
+    if (!readLp(problemFileOrContent) || !setBasis(basis))
+    {
+        return {};
+    }
+
+    // no createStatus() here, the simplex refactorizes the given basis and refines from it
+    _limits.start();
+    _model->primal();
+    applyStopStatus();
+    if (hasIntegers())
+        branchAndBound(DefaultMaximumNodes);
 
     return getSolution(precision);
 }
 
+std::string ClpWrapper::getBasis() const
+{
+    const auto size = _model->getNumCols() + _model->getNumRows();
+    const auto status = _model->statusArray();
+    std::string basis(size, '0' + ClpSimplex::isFree);
+    if (status)
+    {
+        for (auto i = 0; i < size; ++i)
+            basis[i] = static_cast<char>('0' + (status[i] & 7));
+    }
+    return basis;
+}
+
+bool ClpWrapper::setBasis(const std::string & basis)
+{
+    const auto size = _model->getNumCols() + _model->getNumRows();
+    if (basis.size() != size)
+        return false;
+
+    std::vector<unsigned char> status(size);
+    for (auto i = 0; i < size; ++i)
+    {
+        const auto s = basis[i] - '0';
+        if (s < ClpSimplex::isFree || s > ClpSimplex::isFixed)
+            return false;
+        status[i] = static_cast<unsigned char>(s);
+    }
+    _model->copyinStatus(status.data());
+    return true;
+}
+
 void ClpWrapper::primal()
 {
-    _model->createStatus();
+    if (!_model->statusExists())
+        _model->createStatus();
+    _limits.start();
     _model->primal();
+    applyStopStatus();
+    _boundsChanged = _objectiveChanged = false;
+    _integerSolution = false;
 }
 
 void ClpWrapper::dual()
 {
-    _model->createStatus();
+    if (!_model->statusExists())
+        _model->createStatus();
+    _limits.start();
     _model->dual();
+    applyStopStatus();
+    _boundsChanged = _objectiveChanged = false;
+    _integerSolution = false;
+}
+
+FloatT clampValue(FloatT x)
+{
+    if (x < TOO_SMALL_FLOAT)
+        return TOO_SMALL_FLOAT + 1;
+    if (x > TOO_BIG_FLOAT)
+        return TOO_BIG_FLOAT - 1;
+    return x;
+}
+
+bool ClpWrapper::setColumnBounds(int column, FloatT lower, FloatT upper)
+{
+    if (column < 0 || column >= _model->getNumCols())
+        return false;
+    _model->setColumnBounds(column, clampValue(lower), clampValue(upper));
+    _boundsChanged = true;
+    return true;
+}
+
+bool ClpWrapper::setRowBounds(int row, FloatT lower, FloatT upper)
+{
+    if (row < 0 || row >= _model->getNumRows())
+        return false;
+    _model->setRowBounds(row, clampValue(lower), clampValue(upper));
+    _boundsChanged = true;
+    return true;
+}
+
+bool ClpWrapper::setObjectiveCoefficient(int column, FloatT value)
+{
+    if (column < 0 || column >= _model->getNumCols())
+        return false;
+    _model->setObjectiveCoefficient(column, clampValue(value));
+    _objectiveChanged = true;
+    return true;
+}
+
+int ClpWrapper::resolve()
+{
+    if (_boundsChanged && !_objectiveChanged && _model->statusExists())
+        dual();
+    else
+        primal();
+    return _model->status();
+}
+
+int ClpWrapper::iterations() const
+{
+    return _model->numberIterations();
+}
+
+int ClpWrapper::status() const
+{
+    return _model->status();
+}
+
+void ClpWrapper::setTimeLimit(double seconds)
+{
+    _limits.setTimeLimit(seconds);
+}
+
+void ClpWrapper::setIterationLimit(int iterations)
+{
+    _limits.setIterationLimit(iterations);
+}
+
+void ClpWrapper::cancel()
+{
+    _limits.cancel();
+}
+
+std::string ClpWrapper::stopReason() const
+{
+    return ClpSolveLimits::name(_limits.stopped());
+}
+
+void ClpWrapper::applyStopStatus()
+{
+    // the simplex reports every stop by its event handler as 5; limits are reported as 3 like
+    // the maximumIterations and maximumSeconds of ClpSimplex. An integer solution found by
+    // branch and bound before the stop keeps its 0
+    const auto stop = _limits.stopped();
+    if (stop == ClpSolveLimits::Stop::NONE || _model->status() == 0)
+        return;
+    _model->setProblemStatus(stop == ClpSolveLimits::Stop::CANCELLED ? 5 : 3);
+}
+
+void ClpWrapper::setLogLevel(int level)
+{
+    _model->setLogLevel(level);
+}
+
+bool ClpWrapper::setInteger(int column)
+{
+    if (column < 0 || column >= _model->getNumCols())
+        return false;
+    _model->setInteger(column);
+    return true;
+}
+
+bool ClpWrapper::hasIntegers() const
+{
+    const auto numCols = _model->getNumCols();
+    for (int i = 0; i < numCols; ++i)
+    {
+        if (_model->isInteger(i))
+            return true;
+    }
+    return false;
+}
+
+bool ClpWrapper::branchAndBound(int maximumNodes)
+{
+    if (_model->status() != 0)
+    {
+        _integerSolution = false;
+        _nodes = 0;
+        return false;
+    }
+    ClpBranchAndBound search(*_model);
+    _integerSolution = search.solve(maximumNodes);
+    _nodes = search.nodes();
+    applyStopStatus();
+    return _integerSolution;
+}
+
+int ClpWrapper::nodes() const
+{
+    return _nodes;
 }
 
 std::vector<FloatT> toFloatVector(const FloatT * data, int len)
@@ -85,12 +563,29 @@ bool ClpWrapper::readLp(const std::string & problemFileOrContent)
     return readInput(problemFileOrContent, ProblemFormat::LP);
 }
 
+void ClpWrapper::resetModel()
+{
+    // loading a problem leaves both untouched (readLp only sets the direction when maximizing),
+    // reset them so a reused wrapper gives the same results as a fresh one
+    _model->setOptimizationDirection(1);
+    _model->setRandomSeed(12345678); // CoinThreadRandom's default seed
+}
+
 bool ClpWrapper::readInput(const std::string & problemFileOrContent, ProblemFormat format)
+{
+    // files are streamed and content is parsed in place, neither is copied
+    std::ifstream file(problemFileOrContent.c_str());
+    if (file.good())
+        return readStream(file, format);
+    Imemstream stream(problemFileOrContent.data(), problemFileOrContent.size());
+    return readStream(stream, format);
+}
+
+bool ClpWrapper::readStream(std::istream & stream, ProblemFormat format)
 {
     try
     {
-        auto problemContent = readContent(problemFileOrContent);
-        Imemstream stream(reinterpret_cast<char *>(&problemContent[0]), problemContent.size());
+        resetModel();
         if (format == ProblemFormat::LP)
             _model->readLp(stream);
         else if (format == ProblemFormat::MPS)
@@ -98,12 +593,39 @@ bool ClpWrapper::readInput(const std::string & problemFileOrContent, ProblemForm
             throw std::runtime_error("MPS format not supported just yet");
         return true;
     }
-    catch (const std::exception & e)
+    catch (...)
     {
+        // CoinLpIO throws CoinError and C strings besides standard exceptions
         return false;
     }
 }
 
+void ClpWrapper::beginParse()
+{
+    _parseChunks.clear();
+    _parsing = true;
+}
+
+bool ClpWrapper::feed(std::string chunk)
+{
+    if (!_parsing)
+        return false;
+    _parseChunks.push_back(std::move(chunk));
+    return true;
+}
+
+bool ClpWrapper::finish()
+{
+    if (!_parsing)
+        return false;
+    _parsing = false;
+    ChunkStreambuf buffer(_parseChunks);
+    std::istream stream(&buffer);
+    const auto loaded = readStream(stream, ProblemFormat::LP);
+    _parseChunks.clear();
+    return loaded;
+}
+
 std::string toString(const FloatT & v, int precision)
 {
     std::stringstream ss;
@@ -215,8 +737,8 @@ std::string ClpWrapper::getSolution(const int precision) const
     using namespace std;
     const auto dim = _model->getNumCols();
 
-    bool integerSolution = false;
-    if (precision <= 0 && dim <= 8)
+    bool integerSolution = _integerSolution;
+    if (!hasIntegers() && precision <= 0 && dim <= 8)
     {
         integerSolution = findBestFloorCeilSolution(_model.get());
     }
@@ -240,6 +762,143 @@ std::string ClpWrapper::getSolution(const int precision) const
     return solObjStr;
 }
 
+std::vector<std::string> toStringVector(const std::vector<FloatT> & values, int precision)
+{
+    std::vector<std::string> strings;
+    strings.reserve(values.size());
+    for (const auto & v : values)
+        strings.push_back(toString(v, precision));
+    return strings;
+}
+
+std::vector<std::string> ClpWrapper::getSolutionValues(int precision) const
+{
+    const auto dim = _model->getNumCols();
+    if (!hasIntegers() && precision <= 0 && dim <= 8)
+    {
+        findBestFloorCeilSolution(_model.get());
+    }
+    return toStringVector(toFloatVector(_model->getColSolution(), dim), precision);
+}
+
+std::vector<std::string> ClpWrapper::getUnboundedRayValues(int precision) const
+{
+    return toStringVector(toFloatVector(_model->unboundedRay(), _model->getNumCols()), precision);
+}
+
+std::vector<std::string> ClpWrapper::getInfeasibilityRayValues(int precision) const
+{
+    return toStringVector(toFloatVector(_model->infeasibilityRay(), _model->getNumCols()), precision);
+}
+
+std::vector<FloatT> solutionVector(const ClpSimplex & model, SolutionVector which)
+{
+    switch (which)
+    {
+    case SolutionVector::SOLUTION:
+        return toFloatVector(model.getColSolution(), model.getNumCols());
+    case SolutionVector::DUALS:
+        return toFloatVector(model.dualRowSolution(), model.getNumRows());
+    case SolutionVector::REDUCED_COSTS:
+        return toFloatVector(model.dualColumnSolution(), model.getNumCols());
+    case SolutionVector::ROW_ACTIVITIES:
+        return toFloatVector(model.primalRowSolution(), model.getNumRows());
+    }
+    return {};
+}
+
+const std::vector<double> & ClpWrapper::getValues(SolutionVector which) const
+{
+    const auto values = solutionVector(*_model, which);
+    auto & buffer = _valueBuffers[static_cast<size_t>(which)];
+    buffer.resize(values.size());
+    std::transform(values.begin(), values.end(), buffer.begin(), [](const FloatT & v) {
+        return static_cast<double>(v);
+    });
+    return buffer;
+}
+
+// Ranges past 1e30 are what CLP reports for a basis that never changes
+std::string rangeValuesJson(const std::vector<FloatT> & values, int precision)
+{
+    std::string json = "[";
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (i)
+            json += ',';
+        json += '"';
+        json += values[i] >= 1.0e30 ? "Infinity" : toString(values[i], precision);
+        json += '"';
+    }
+    return json + "]";
+}
+
+std::string sequencesJson(const std::vector<int> & sequences)
+{
+    std::string json = "[";
+    for (size_t i = 0; i < sequences.size(); ++i)
+    {
+        if (i)
+            json += ',';
+        json += std::to_string(sequences[i]);
+    }
+    return json + "]";
+}
+
+std::string ClpWrapper::ranging(const std::vector<int> & sequences, int precision, int threads)
+{
+    if (_integerSolution)
+        return {};
+    const auto which = sequences.empty() ? ClpRanging::allSequences(*_model) : sequences;
+    ClpRanging::Ranges ranges;
+    if (!ClpRanging::compute(*_model, which, threads, ranges))
+        return {};
+
+    return asJsonObject({ { "sequences", sequencesJson(which) },
+                          { "costIncrease", rangeValuesJson(ranges.costIncrease, precision) },
+                          { "costIncreaseSequence", sequencesJson(ranges.costIncreaseSequence) },
+                          { "costDecrease", rangeValuesJson(ranges.costDecrease, precision) },
+                          { "costDecreaseSequence", sequencesJson(ranges.costDecreaseSequence) },
+                          { "valueIncrease", rangeValuesJson(ranges.valueIncrease, precision) },
+                          { "valueIncreaseSequence", sequencesJson(ranges.valueIncreaseSequence) },
+                          { "valueDecrease", rangeValuesJson(ranges.valueDecrease, precision) },
+                          { "valueDecreaseSequence", sequencesJson(ranges.valueDecreaseSequence) } });
+}
+
+std::string ClpWrapper::getDecimals(SolutionVector which, int precision) const
+{
+    const auto values = solutionVector(*_model, which);
+    std::stringstream ss;
+    ss << std::fixed;
+    if (precision >= 0)
+        ss << std::setprecision(std::max(1, precision));
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (i)
+            ss << ' ';
+        ss << values[i];
+    }
+    return ss.str();
+}
+
+std::vector<std::string> ClpWrapper::getColumnNames() const
+{
+    const auto names = _model->columnNames();
+    return names ? *names : std::vector<std::string> {};
+}
+
+std::vector<std::string> ClpWrapper::getRowNames() const
+{
+    const auto names = _model->rowNames();
+    return names ? *names : std::vector<std::string> {};
+}
+
+void clampVector(std::vector<FloatT> & v)
+{
+    for (auto & x : v)
+        x = clampValue(x);
+}
+
 bool ClpWrapper::loadProblem(std::vector<FloatT> objec,
                              std::vector<FloatT> collb,
                              std::vector<FloatT> colub,
@@ -247,31 +906,8 @@ bool ClpWrapper::loadProblem(std::vector<FloatT> objec,
                              std::vector<FloatT> rowub,
                              std::vector<FloatT> matrix)
 {
-    const auto clampVector = [](std::vector<FloatT> & v) {
-        for (auto & x : v)
-        {
-            if (x < TOO_SMALL_FLOAT)
-                x = TOO_SMALL_FLOAT + 1;
-            if (x > TOO_BIG_FLOAT)
-                x = TOO_BIG_FLOAT - 1;
-        }
-    };
-
-    clampVector(objec);
-    clampVector(collb);
-    clampVector(colub);
-    clampVector(rowlb);
-    clampVector(rowub);
-    clampVector(matrix);
-
     const auto numCols = objec.size();
-    if (collb.size() != numCols || colub.size() != numCols)
-        return false;
-
     const auto numRows = std::max(rowlb.size(), rowub.size());
-    if (numRows != rowlb.size() || numRows != rowub.size())
-        return false;
-
     const auto matrixNumEl = numRows * numCols;
     if (matrixNumEl != matrix.size())
         return false;
@@ -289,34 +925,184 @@ bool ClpWrapper::loadProblem(std::vector<FloatT> objec,
         }
     }
 
-    const CoinPackedMatrix matrixData(true, rowIndices.data(), colIndices.data(), matrix.data(), matrix.size());
+    return loadProblemSparse(std::move(objec),
+                             std::move(collb),
+                             std::move(colub),
+                             std::move(rowlb),
+                             std::move(rowub),
+                             rowIndices,
+                             colIndices,
+                             std::move(matrix));
+}
+
+bool ClpWrapper::checkBounds(std::vector<FloatT> & objec,
+                             std::vector<FloatT> & collb,
+                             std::vector<FloatT> & colub,
+                             std::vector<FloatT> & rowlb,
+                             std::vector<FloatT> & rowub) const
+{
+    clampVector(objec);
+    clampVector(collb);
+    clampVector(colub);
+    clampVector(rowlb);
+    clampVector(rowub);
+
+    const auto numCols = objec.size();
+    if (collb.size() != numCols || colub.size() != numCols)
+        return false;
+
+    return rowlb.size() == rowub.size();
+}
+
+bool ClpWrapper::loadProblemSparse(std::vector<FloatT> objec,
+                                   std::vector<FloatT> collb,
+                                   std::vector<FloatT> colub,
+                                   std::vector<FloatT> rowlb,
+                                   std::vector<FloatT> rowub,
+                                   const std::vector<int> & rowIndices,
+                                   const std::vector<int> & colIndices,
+                                   std::vector<FloatT> elements)
+{
+    if (!checkBounds(objec, collb, colub, rowlb, rowub))
+        return false;
+    clampVector(elements);
+
+    const int numCols = objec.size();
+    const int numRows = rowlb.size();
+    if (rowIndices.size() != elements.size() || colIndices.size() != elements.size())
+        return false;
+    for (size_t k = 0; k < elements.size(); ++k)
+    {
+        if (rowIndices[k] < 0 || rowIndices[k] >= numRows || colIndices[k] < 0 || colIndices[k] >= numCols)
+            return false;
+    }
+
+    CoinPackedMatrix matrixData(true, rowIndices.data(), colIndices.data(), elements.data(), elements.size());
+    // empty trailing rows or columns are not seen by the triplet constructor
+    matrixData.setDimensions(numRows, numCols);
+    resetModel();
     _model->loadProblem(matrixData, collb.data(), colub.data(), objec.data(), rowlb.data(), rowub.data());
     _model->createStatus();
     return true;
 }
 
+bool ClpWrapper::loadProblemCSC(std::vector<FloatT> objec,
+                                std::vector<FloatT> collb,
+                                std::vector<FloatT> colub,
+                                std::vector<FloatT> rowlb,
+                                std::vector<FloatT> rowub,
+                                const std::vector<int> & columnStarts,
+                                const std::vector<int> & rowIndices,
+                                std::vector<FloatT> elements)
+{
+    if (!checkBounds(objec, collb, colub, rowlb, rowub))
+        return false;
+    clampVector(elements);
+
+    const int numCols = objec.size();
+    const int numRows = rowlb.size();
+    if (columnStarts.size() != numCols + 1 || rowIndices.size() != elements.size())
+        return false;
+    if (columnStarts.front() != 0 || columnStarts.back() != static_cast<int>(elements.size()))
+        return false;
+    for (auto c = 0; c < numCols; ++c)
+    {
+        if (columnStarts[c] > columnStarts[c + 1])
+            return false;
+    }
+    for (const auto r : rowIndices)
+    {
+        if (r < 0 || r >= numRows)
+            return false;
+    }
+
+    resetModel();
+    _model->loadProblem(numCols,
+                        numRows,
+                        columnStarts.data(),
+                        rowIndices.data(),
+                        elements.data(),
+                        collb.data(),
+                        colub.data(),
+                        objec.data(),
+                        rowlb.data(),
+                        rowub.data());
+    _model->createStatus();
+    return true;
+}
+
+std::vector<FloatT> parsePackedFloats(const std::string & packed)
+{
+    // values separated by whitespace or commas, parsed in place without per value allocations
+    std::vector<FloatT> vec;
+    std::string buffer(packed);
+    char * cursor = &buffer[0];
+    char * const end = cursor + buffer.size();
+    const auto isSeparator = [](char c) { return c == ',' || std::isspace(static_cast<unsigned char>(c)); };
+    while (cursor < end)
+    {
+        while (cursor < end && isSeparator(*cursor))
+            ++cursor;
+        char * token = cursor;
+        while (cursor < end && !isSeparator(*cursor))
+            ++cursor;
+        if (token == cursor)
+            break;
+        *cursor++ = '\0';
+        vec.push_back(toFloat(token));
+    }
+    return vec;
+}
+
 #ifdef __EMSCRIPTEN__
+// Copies a typed array into the WASM heap with a single TypedArray.set call
+template <typename T>
+std::vector<T> vecFromTypedArray(const emscripten::val & a)
+{
+    const auto size = a["length"].as<unsigned>();
+    std::vector<T> vec(size);
+    val view(typed_memory_view(size, vec.data()));
+    view.call<void>("set", a);
+    return vec;
+}
+
+// Accepts a Float64Array, a string of packed decimal values (for numbers double cannot
+// represent exactly) or a plain array of numbers or strings
 std::vector<FloatT> vecFromJS(const emscripten::val & a)
 {
+    if (a.isString())
+    {
+        return parsePackedFloats(a.as<std::string>());
+    }
+    if (a.instanceof(val::global("Float64Array")))
+    {
+        const auto values = vecFromTypedArray<double>(a);
+        return std::vector<FloatT>(values.begin(), values.end());
+    }
     std::vector<FloatT> vec;
     const auto size = a["length"].as<unsigned>();
     vec.reserve(size);
     for (auto i = 0; i < size; ++i)
     {
         const auto strval = a[i].call<std::string>("toString");
-        vec.push_back(FloatT(strval));
+        vec.push_back(toFloat(strval));
     }
     return vec;
 }
-val vecToJS(const std::vector<FloatT> & values, int precision)
+std::vector<int> intVecFromJS(const emscripten::val & a)
 {
-    val Array = val::global("Array");
-    val arr = Array.new_();
-    int i = 0;
-    for (auto & v : values)
+    if (a.instanceof(val::global("Int32Array")))
     {
-        arr.call<void>("push", val(toString(v, precision)));
+        return vecFromTypedArray<int>(a);
     }
+    return emscripten::vecFromJSArray<int>(a);
+}
+
+val stringsToJS(const std::vector<std::string> & strings)
+{
+    val arr = val::array();
+    for (const auto & str : strings)
+        arr.call<void>("push", val(str));
     return arr;
 }
 
@@ -331,25 +1117,136 @@ bool ClpWrapper::loadProblemJS(val objective, val col_lb, val col_ub, val row_lb
     return loadProblem(objec, collb, colub, rowlb, rowub, rowmx);
 }
 
+bool ClpWrapper::loadProblemSparseJS(
+    val objective, val col_lb, val col_ub, val row_lb, val row_ub, val rows, val cols, val values)
+{
+    return loadProblemSparse(vecFromJS(objective),
+                             vecFromJS(col_lb),
+                             vecFromJS(col_ub),
+                             vecFromJS(row_lb),
+                             vecFromJS(row_ub),
+                             intVecFromJS(rows),
+                             intVecFromJS(cols),
+                             vecFromJS(values));
+}
+
+bool ClpWrapper::loadProblemCSCJS(
+    val objective, val col_lb, val col_ub, val row_lb, val row_ub, val starts, val rows, val values)
+{
+    return loadProblemCSC(vecFromJS(objective),
+                          vecFromJS(col_lb),
+                          vecFromJS(col_ub),
+                          vecFromJS(row_lb),
+                          vecFromJS(row_ub),
+                          intVecFromJS(starts),
+                          intVecFromJS(rows),
+                          vecFromJS(values));
+}
+
 val ClpWrapper::getSolutionArray(int precision) const
 {
-    const auto dim = _model->getNumCols();
-    if (precision <= 0 && dim <= 8)
-    {
-        findBestFloorCeilSolution(_model.get());
-    }
-    return vecToJS(toFloatVector(_model->getColSolution(), dim), precision);
+    return stringsToJS(getSolutionValues(precision));
 }
 
 val ClpWrapper::getInfeasibilityRay(int precision) const
 {
-    const auto dim = _model->getNumCols();
-    return vecToJS(toFloatVector(_model->infeasibilityRay(), dim), precision);
+    return stringsToJS(getInfeasibilityRayValues(precision));
 }
 
 val ClpWrapper::getUnboundedRay(int precision) const
 {
-    const auto dim = _model->getNumCols();
-    return vecToJS(toFloatVector(_model->unboundedRay(), dim), precision);
+    return stringsToJS(getUnboundedRayValues(precision));
+}
+
+val ClpWrapper::getValuesJS(SolutionVector which) const
+{
+    const auto & values = getValues(which);
+    return val(typed_memory_view(values.size(), values.data()));
+}
+
+FloatT floatFromJS(const val & v)
+{
+    return toFloat(v.call<std::string>("toString"));
+}
+
+bool ClpWrapper::setColumnBoundsJS(int column, val lower, val upper)
+{
+    return setColumnBounds(column, floatFromJS(lower), floatFromJS(upper));
+}
+
+bool ClpWrapper::setRowBoundsJS(int row, val lower, val upper)
+{
+    return setRowBounds(row, floatFromJS(lower), floatFromJS(upper));
+}
+
+bool ClpWrapper::setObjectiveCoefficientJS(int column, val value)
+{
+    return setObjectiveCoefficient(column, floatFromJS(value));
+}
+
+val ClpWrapper::getColumnNamesJS() const
+{
+    return stringsToJS(getColumnNames());
+}
+
+val ClpWrapper::getRowNamesJS() const
+{
+    return stringsToJS(getRowNames());
+}
+
+val ClpWrapper::solveBatchJS(val problems, int precision)
+{
+    solveBatch(
+        problems["length"].as<size_t>(),
+        [&](size_t i) {
+            const auto problem = problems[i];
+            return problem.isString() ? readLp(problem.as<std::string>())
+                                      : loadProblemCSCJS(problem["objective"],
+                                                         problem["columnLower"],
+                                                         problem["columnUpper"],
+                                                         problem["rowLower"],
+                                                         problem["rowUpper"],
+                                                         problem["starts"],
+                                                         problem["rows"],
+                                                         problem["values"]);
+        },
+        precision);
+
+    val result = val::object();
+    result.set("results", val(_batchResults));
+    result.set("timings", val(typed_memory_view(_batchTimings.size(), _batchTimings.data())).call<val>("slice"));
+    return result;
+}
+
+void ClpWrapper::setCancelFlag(val flag)
+{
+    _limits.setCancelFlag(flag);
+}
+
+std::string ClpWrapper::rangingJS(val sequences, int precision)
+{
+    return ranging(sequences.isUndefined() || sequences.isNull() ? std::vector<int> {} : intVecFromJS(sequences),
+                   precision);
+}
+
+bool ClpWrapper::setSolveOptionsJS(val options)
+{
+    SolveOptions solveOptions;
+    if (!options.isUndefined() && !options.isNull())
+    {
+        const auto method = options["method"];
+        const auto presolve = options["presolve"];
+        const auto passes = options["passes"];
+        const auto stats = options["stats"];
+        if (!method.isUndefined())
+            solveOptions.method = method.as<std::string>();
+        if (!presolve.isUndefined())
+            solveOptions.presolve = presolve.as<bool>();
+        if (!passes.isUndefined())
+            solveOptions.presolvePasses = passes.as<int>();
+        if (!stats.isUndefined())
+            solveOptions.stats = stats.as<bool>();
+    }
+    return setSolveOptions(solveOptions);
 }
-#endif
\ No newline at end of file
+#endif
@@ -1,5 +1,13 @@
 #pragma once
+#include "ClpSolutionCache.h"
+#include "ClpSolveLimits.h"
+#include "ClpSolveStats.hpp"
 #include "floatdef.h"
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <istream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,24 +26,197 @@ enum class ProblemFormat
     LP,
     MPS
 };
+
+enum class SolutionVector
+{
+    SOLUTION,
+    DUALS,
+    REDUCED_COSTS,
+    ROW_ACTIVITIES
+};
+
+/// Parses decimals separated by whitespace or commas, keeping the full FloatT precision
+std::vector<FloatT> parsePackedFloats(const std::string & packed);
+
 class ClpWrapper
 {
 public:
+    static constexpr int DefaultMaximumNodes = 100000;
+
+    struct SolveOptions
+    {
+        /// Algorithm of solve() and solveBatch(): "" (the default) runs primal simplex on the
+        /// model as read; "auto", "dual", "primal", "sprint" or "barrier" (with crossover) go
+        /// through ClpSimplex::initialSolve(), which presolves the model first and, for "auto",
+        /// picks the algorithm from its shape
+        std::string method;
+        bool presolve = true;
+        /// Presolve passes, 0 for the ClpSolve default
+        int presolvePasses = 0;
+        /// Adds a "stats" object to the results of solve() and solveBatch(), see statsJson()
+        bool stats = false;
+    };
+
     ClpWrapper();
 
     std::string solve(const std::string & problemFileOrContent, int precision);
 
+    /// Solves the problem starting from a basis found by another (typically the double) engine,
+    /// so only the pivots needed to restore optimality in FloatT precision are performed
+    std::string solveFromBasis(const std::string & problemFileOrContent, const std::string & basis, int precision);
+
+    /// Scalar engine libclp was compiled with ("dec100", "bin113" or "double")
+    static std::string engine();
+
+    /// Number of threads the simplex kernels are split over, in builds with CLP_THREADS
+    /// (clp-wasm-mt). Returns the value used, always 1 in single threaded builds
+    static int setThreads(int threads);
+
+    /// Solves the problems one after the other on this wrapper's model, whose factorization
+    /// keeps its arrays at high-water size between models. Returns the solve() results packed
+    /// in one JSON array, null for problems that could not be read
+    std::string solveBatch(const std::vector<std::string> & problemFilesOrContents, int precision);
+
+    /// Same as above for count problems put into the model by loadProblem(i), which returns
+    /// false when problem i cannot be loaded
+    std::string solveBatch(size_t count, const std::function<bool(size_t)> & loadProblem, int precision);
+
+    /// Load and solve time of each problem of the last solveBatch() in milliseconds
+    const std::vector<double> & batchTimings() const;
+
+    /// Memory limit of the solution cache used by solve() and solveBatch(), 0 (the default)
+    /// disabling and emptying it. Resubmitted models are answered from the cache, models that
+    /// only differ in their numbers start from the cached optimal basis
+    void setCacheLimit(size_t maxBytes);
+
+    void clearCache();
+
+    ClpSolutionCache::Stats cacheStats() const;
+
+    /// cacheStats() as {"hits","warmStarts","misses","entries","bytes","maxBytes"}
+    std::string cacheStatsJson() const;
+
+    /// Returns false, keeping the current options, for an unknown method or negative passes.
+    /// With a method set the results of solve() and solveBatch() get a "phases" object:
+    /// {"presolveMs","solveMs","postsolveMs","cleanupMs","branchAndBoundMs","presolvedRows",
+    /// "presolvedColumns"}, the wall clock time of each phase (0 when it did not run) and the
+    /// size of the model the simplex ran on
+    bool setSolveOptions(const SolveOptions & options);
+
+    const SolveOptions & solveOptions() const;
+
 public:
     bool readLp(const std::string & problemFileOrContent);
 
     bool readMps(const std::string & problemFileOrContent);
 
+    /// Starts reading an LP problem given in chunks, dropping any session left unfinished.
+    /// Chunks may split lines and tokens anywhere
+    void beginParse();
+
+    /// Appends the next chunk of LP text, false when no parse session is open
+    bool feed(std::string chunk);
+
+    /// Parses the chunks fed since beginParse() into the model like readLp(), releasing each
+    /// chunk as soon as the parser is past it, and closes the session
+    bool finish();
+
+    /// Runs primal simplex, starting from the current basis if there is one
     void primal();
 
+    /// Runs dual simplex, starting from the current basis if there is one
     void dual();
 
+    /// Changes the bounds of a column, keeping the basis for the next resolve()
+    bool setColumnBounds(int column, FloatT lower, FloatT upper);
+
+    /// Changes the bounds (right hand side) of a row, keeping the basis for the next resolve()
+    bool setRowBounds(int row, FloatT lower, FloatT upper);
+
+    bool setObjectiveCoefficient(int column, FloatT value);
+
+    /// Re-solves from the last basis: dual simplex when only bounds or right hand sides changed
+    /// since the basis stays dual feasible, primal simplex otherwise. Returns the ClpSimplex status
+    int resolve();
+
+    /// Simplex iterations of the last primal(), dual() or resolve()
+    int iterations() const;
+
+    /// ClpSimplex status of the last solve: 0 optimal, 1 primal infeasible, 2 dual infeasible
+    /// (unbounded), 3 stopped on limits, 4 stopped on errors, 5 cancelled. After branchAndBound()
+    /// 0 means an integer solution was found
+    int status() const;
+
+    /// Wall clock seconds a solve may take, 0 (the default) for no limit. A solve is timed from
+    /// the start of solve(), primal(), dual() or resolve(), so branchAndBound() after primal()
+    /// shares its budget. A stopped solve keeps the basis and solution it reached, with status 3
+    void setTimeLimit(double seconds);
+
+    /// Simplex iterations a solve may take, counted like the time limit, 0 for no limit
+    void setIterationLimit(int iterations);
+
+    /// Stops the running solve at the end of its current iteration, or the next solve when
+    /// none is running, leaving status 5. Unlike every other method it may be called from
+    /// another thread while a solve runs
+    void cancel();
+
+    /// Why the last solve stopped early: "time", "iterations", "cancelled", or "" when it ran
+    /// to completion
+    std::string stopReason() const;
+
+    /// CLP message level, 0 silences the solver and the LP parser. Native builds print to stdout
+    void setLogLevel(int level);
+
+    /// Marks a column as integer (general, or binary when its bounds are 0 and 1)
+    bool setInteger(int column);
+
+    /// True when the model has integer columns, read from the Generals/Binaries sections
+    /// of an LP file or set with setInteger()
+    bool hasIntegers() const;
+
+    /// Branch and bound over the integer columns of a model already solved as an LP.
+    /// Returns true when an integer feasible solution was found within maximumNodes nodes
+    bool branchAndBound(int maximumNodes);
+
+    /// Nodes explored by the last branchAndBound()
+    int nodes() const;
+
     std::string getSolution(const int precision) const;
 
+    /// Values of the "solution", "unboundedRay" and "infeasibilityRay" entries of getSolution()
+    std::vector<std::string> getSolutionValues(int precision) const;
+
+    std::vector<std::string> getUnboundedRayValues(int precision) const;
+
+    std::vector<std::string> getInfeasibilityRayValues(int precision) const;
+
+    /// Values of a solution vector converted to double. The reference stays valid until the
+    /// next call for the same vector
+    const std::vector<double> & getValues(SolutionVector which) const;
+
+    /// Full precision values of a solution vector as one space separated string
+    std::string getDecimals(SolutionVector which, int precision) const;
+
+    /// Sensitivity ranges at the optimal basis of the last LP solve for the given sequence
+    /// numbers (columns, then rows numbered from the column count; every column and row when
+    /// empty) as JSON {"sequences", "costIncrease", "costIncreaseSequence", "costDecrease",
+    /// "costDecreaseSequence", "valueIncrease", "valueIncreaseSequence", "valueDecrease",
+    /// "valueDecreaseSequence"}: how far the cost and the value of each variable can move before
+    /// the basis changes ("Infinity" when it never does), and the sequence number of the
+    /// variable that would then enter (cost) or leave (value) the basis, -1 for none. All
+    /// variables share one factorization per thread; threads only applies to native builds.
+    /// Returns "" when the last solve was not optimal or ended in branch and bound
+    std::string ranging(const std::vector<int> & sequences, int precision, int threads = 1);
+
+    std::vector<std::string> getColumnNames() const;
+
+    std::vector<std::string> getRowNames() const;
+
+    /// Status of every column followed by every row, one ClpSimplex::Status digit each
+    std::string getBasis() const;
+
+    bool setBasis(const std::string & basis);
+
     bool loadProblem(std::vector<FloatT> objec,
                      std::vector<FloatT> collb,
                      std::vector<FloatT> colub,
@@ -43,15 +224,109 @@ public:
                      std::vector<FloatT> rowub,
                      std::vector<FloatT> matrix);
 
+    /// Loads a problem whose constraint matrix is given as (row, column, value) triplets;
+    /// duplicate entries are summed
+    bool loadProblemSparse(std::vector<FloatT> objec,
+                           std::vector<FloatT> collb,
+                           std::vector<FloatT> colub,
+                           std::vector<FloatT> rowlb,
+                           std::vector<FloatT> rowub,
+                           const std::vector<int> & rowIndices,
+                           const std::vector<int> & colIndices,
+                           std::vector<FloatT> elements);
+
+    /// Loads a problem whose constraint matrix is in compressed sparse column form,
+    /// columnStarts having numCols + 1 entries
+    bool loadProblemCSC(std::vector<FloatT> objec,
+                        std::vector<FloatT> collb,
+                        std::vector<FloatT> colub,
+                        std::vector<FloatT> rowlb,
+                        std::vector<FloatT> rowub,
+                        const std::vector<int> & columnStarts,
+                        const std::vector<int> & rowIndices,
+                        std::vector<FloatT> elements);
+
 #ifdef __EMSCRIPTEN__
     bool loadProblemJS(val objec, val col_lb, val col_ub, val row_lb, val row_ub, val matrix);
+    bool loadProblemSparseJS(val objec, val col_lb, val col_ub, val row_lb, val row_ub, val rows, val cols, val values);
+    bool loadProblemCSCJS(val objec, val col_lb, val col_ub, val row_lb, val row_ub, val starts, val rows, val values);
     val getSolutionArray(int precision) const;
     val getUnboundedRay(int precision) const;
     val getInfeasibilityRay(int precision) const;
+    /// Float64Array view over the WASM heap, invalidated by the next call or by a new solve
+    val getValuesJS(SolutionVector which) const;
+    bool setColumnBoundsJS(int column, val lower, val upper);
+    bool setRowBoundsJS(int row, val lower, val upper);
+    bool setObjectiveCoefficientJS(int column, val value);
+    val getColumnNamesJS() const;
+    val getRowNamesJS() const;
+    /// Batch of LP strings and/or CSC models ({objective, columnLower, columnUpper, rowLower,
+    /// rowUpper, starts, rows, values}), returned as {results, timings}
+    val solveBatchJS(val problems, int precision);
+    /// See ClpSolveLimits::setCancelFlag()
+    void setCancelFlag(val flag);
+    /// ranging() of an array or Int32Array of sequence numbers, all of them when undefined
+    std::string rangingJS(val sequences, int precision);
+    /// setSolveOptions() of {method, presolve, passes, stats}, missing fields taking their defaults
+    bool setSolveOptionsJS(val options);
 #endif
 
 private:
+    bool checkBounds(std::vector<FloatT> & objec,
+                     std::vector<FloatT> & collb,
+                     std::vector<FloatT> & colub,
+                     std::vector<FloatT> & rowlb,
+                     std::vector<FloatT> & rowub) const;
+
     bool readInput(const std::string & problemFileOrContent, ProblemFormat format);
 
+    bool readStream(std::istream & stream, ProblemFormat format);
+
+    void resetModel();
+
+    /// Reports stops of the last solve by the limits as status 3, cancellations as 5
+    void applyStopStatus();
+
+    /// LP solve of solve() and solveBatch(), by primal() or initialSolve() as the options say
+    void solveLp();
+
+    /// "phases" of a solve through initialSolve(), branchAndBoundNs being timed by the caller
+    std::string phasesJson(int64_t branchAndBoundNs) const;
+
+    /// "stats" of the last solve: {"primalPhase1Iterations","primalPhase2Iterations",
+    /// "dualIterations","barrierIterations","factorizations","lElements","uElements",
+    /// "factorizeMs","ftranMs","ftrans","btranMs","btrans","pricingMs","ratioTestMs",
+    /// "rowsRemoved","columnsRemoved","peakMemoryBytes"}. The kernel times come from the
+    /// ClpSolveStats timers and include each other where the kernels nest, the L and U sizes are
+    /// those of the last factorization, the presolve reductions are 0 without a method and the
+    /// peak memory is the resident set of the process (the WASM heap in the browser, 0 on Windows)
+    std::string statsJson(const ClpSolveStats::Totals & kernels) const;
+
+    std::string solveLoaded(int precision);
+
+    void beginBatch(size_t count);
+
+    void addBatchResult(bool loaded, int precision, int64_t startNs);
+
     std::shared_ptr<ClpSimplex> _model;
+
+    mutable std::array<std::vector<double>, 4> _valueBuffers;
+
+    bool _boundsChanged = false;
+    bool _objectiveChanged = false;
+
+    bool _integerSolution = false;
+    int _nodes = 0;
+
+    std::string _batchResults;
+    std::vector<double> _batchTimings;
+
+    ClpSolutionCache _cache;
+
+    ClpSolveLimits _limits;
+
+    SolveOptions _solveOptions;
+
+    bool _parsing = false;
+    std::deque<std::string> _parseChunks;
 };
\ No newline at end of file
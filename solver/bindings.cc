@@ -9,21 +9,36 @@ std::string solve(std::string problem, int precision)
     return clpWrapper.solve(problem, precision);
 }
 
+std::string solveBasis(std::string problem)
+{
+    ClpWrapper clpWrapper;
+    if (!clpWrapper.readLp(problem))
+        return {};
+    clpWrapper.primal();
+    return clpWrapper.getBasis();
+}
+
+std::string solveFromBasis(std::string problem, std::string basis, int precision)
+{
+    ClpWrapper clpWrapper;
+    return clpWrapper.solveFromBasis(problem, basis, precision);
+}
+
 #ifdef __EMSCRIPTEN__
 #include <emscripten/bind.h>
 #include <sstream>
 
 std::string bnRound(const std::string x)
 {
-    return mp::round(FloatT(x)).str();
+    return mp::round(DecFloatT(x)).str();
 }
 std::string bnCeil(const std::string & x)
 {
-    return mp::ceil(FloatT(x)).str();
+    return mp::ceil(DecFloatT(x)).str();
 }
 std::string bnFloor(const std::string & x)
 {
-    return mp::floor(FloatT(x)).str();
+    return mp::floor(DecFloatT(x)).str();
 }
 std::string version()
 {
@@ -39,34 +54,155 @@ EMSCRIPTEN_BINDINGS(solver)
     function("bnRound", &bnRound);
     function("bnFloor", &bnFloor);
     function("solve", &solve);
+    function("solveBasis", &solveBasis);
+    function("solveFromBasis", &solveFromBasis);
     function("version", &version);
+    function("engine", &ClpWrapper::engine);
+    function("setThreads", &ClpWrapper::setThreads);
+
+    enum_<SolutionVector>("SolutionVector")
+        .value("SOLUTION", SolutionVector::SOLUTION)
+        .value("DUALS", SolutionVector::DUALS)
+        .value("REDUCED_COSTS", SolutionVector::REDUCED_COSTS)
+        .value("ROW_ACTIVITIES", SolutionVector::ROW_ACTIVITIES);
 
     class_<ClpWrapper>("ClpWrapper")
         .constructor<>()
         .function("solve", &ClpWrapper::solve)
         .function("readLp", &ClpWrapper::readLp)
         .function("readMps", &ClpWrapper::readMps)
+        .function("beginParse", &ClpWrapper::beginParse)
+        .function("feed", &ClpWrapper::feed)
+        .function("finish", &ClpWrapper::finish)
         .function("primal", &ClpWrapper::primal)
         .function("dual", &ClpWrapper::dual)
+        .function("setColumnBounds", &ClpWrapper::setColumnBoundsJS)
+        .function("setRowBounds", &ClpWrapper::setRowBoundsJS)
+        .function("setObjectiveCoefficient", &ClpWrapper::setObjectiveCoefficientJS)
+        .function("resolve", &ClpWrapper::resolve)
+        .function("iterations", &ClpWrapper::iterations)
+        .function("status", &ClpWrapper::status)
+        .function("setTimeLimit", &ClpWrapper::setTimeLimit)
+        .function("setIterationLimit", &ClpWrapper::setIterationLimit)
+        .function("cancel", &ClpWrapper::cancel)
+        .function("setCancelFlag", &ClpWrapper::setCancelFlag)
+        .function("stopReason", &ClpWrapper::stopReason)
+        .function("setLogLevel", &ClpWrapper::setLogLevel)
+        .function("setInteger", &ClpWrapper::setInteger)
+        .function("hasIntegers", &ClpWrapper::hasIntegers)
+        .function("branchAndBound", &ClpWrapper::branchAndBound)
+        .function("nodes", &ClpWrapper::nodes)
         .function("getSolution", &ClpWrapper::getSolution)
+        .function("getBasis", &ClpWrapper::getBasis)
+        .function("setBasis", &ClpWrapper::setBasis)
+        .function("solveFromBasis", &ClpWrapper::solveFromBasis)
+        .function("solveBatch", &ClpWrapper::solveBatchJS)
+        .function("setCacheLimit", &ClpWrapper::setCacheLimit)
+        .function("clearCache", &ClpWrapper::clearCache)
+        .function("cacheStats", &ClpWrapper::cacheStatsJson)
+        .function("setSolveOptions", &ClpWrapper::setSolveOptionsJS)
         .function("loadProblem", &ClpWrapper::loadProblemJS)
+        .function("loadProblemSparse", &ClpWrapper::loadProblemSparseJS)
+        .function("loadProblemCSC", &ClpWrapper::loadProblemCSCJS)
         .function("getSolutionArray", &ClpWrapper::getSolutionArray)
         .function("getUnboundedRay", &ClpWrapper::getUnboundedRay)
-        .function("getInfeasibilityRay", &ClpWrapper::getInfeasibilityRay);
+        .function("getInfeasibilityRay", &ClpWrapper::getInfeasibilityRay)
+        .function("getValues", &ClpWrapper::getValuesJS)
+        .function("getDecimals", &ClpWrapper::getDecimals)
+        .function("ranging", &ClpWrapper::rangingJS)
+        .function("getColumnNames", &ClpWrapper::getColumnNamesJS)
+        .function("getRowNames", &ClpWrapper::getRowNamesJS);
 }
 
 #else
+#include "ClpBatchRunner.h"
+#include <cstring>
+#include <fstream>
 #include <iostream>
+
+// clp-wasm --batch <directory|manifest> [--threads n] [--precision p] [--time-limit seconds]
+//          [--output file.jsonl]
+int runBatch(int argc, char * argv[])
+{
+    std::string source, output;
+    int threads = 0;
+    int precision = 9;
+    double timeLimit = 0;
+    for (int k = 1; k < argc; ++k)
+    {
+        const auto hasValue = k + 1 < argc;
+        if (!std::strcmp(argv[k], "--batch") && hasValue)
+            source = argv[++k];
+        else if (!std::strcmp(argv[k], "--threads") && hasValue)
+            threads = std::atoi(argv[++k]);
+        else if (!std::strcmp(argv[k], "--precision") && hasValue)
+            precision = std::atoi(argv[++k]);
+        else if (!std::strcmp(argv[k], "--time-limit") && hasValue)
+            timeLimit = std::atof(argv[++k]);
+        else if (!std::strcmp(argv[k], "--output") && hasValue)
+            output = argv[++k];
+        else
+        {
+            std::cerr << "Unknown or incomplete option " << argv[k] << std::endl;
+            return 2;
+        }
+    }
+
+    const auto files = ClpBatchRunner::collectFiles(source);
+    if (files.empty())
+    {
+        std::cerr << "No LP or MPS files found in " << source << std::endl;
+        return 2;
+    }
+
+    std::ofstream outputFile;
+    if (!output.empty())
+        outputFile.open(output);
+    auto & out = output.empty() ? std::cout : outputFile;
+
+    ClpBatchRunner runner(threads, precision);
+    runner.setTimeLimit(timeLimit);
+    const auto summary = runner.run(files, out);
+    std::cerr << "Solved " << summary.files << " files (" << summary.failed << " failed) in " << summary.wallMs
+              << " ms on " << summary.threads << " threads: " << summary.throughput() << " files/s" << std::endl;
+    std::cerr << "Total parse " << summary.parseMs << " ms, solve " << summary.solveMs << " ms, serialize "
+              << summary.serializeMs << " ms" << std::endl;
+    return summary.failed ? 1 : 0;
+}
+
 int main(int argc, char * argv[])
 {
+    if (argc > 1 && !std::strcmp(argv[1], "--batch"))
+        return runBatch(argc, argv);
+
     const auto InfL = -10e27;
     const auto InfU = +10e27;
 
+    std::cout << "Engine: " << ClpWrapper::engine() << std::endl;
+
     ClpWrapper clp;
     const auto success = clp.loadProblem({-0.6, -0.5}, {InfL, InfL}, {InfU, InfU}, {InfL, InfL}, {1, 2}, { 1, 2, 3, 1 });
     clp.primal();
     std::cout << "Solution: " << clp.getSolution(9) << std::endl;
 
+    ClpWrapper sparse;
+    sparse.loadProblemSparse({-0.6, -0.5}, {InfL, InfL}, {InfU, InfU}, {InfL, InfL}, {1, 2}, {0, 0, 1, 1}, {0, 1, 0, 1}, {1, 2, 3, 1});
+    sparse.primal();
+    std::cout << "Sparse solution: " << sparse.getSolution(9) << std::endl;
+    std::cout << "Duals: " << sparse.getDecimals(SolutionVector::DUALS, 9) << std::endl;
+
+    sparse.setRowBounds(1, InfL, 1.5);
+    sparse.resolve();
+    std::cout << "Re-solved in " << sparse.iterations() << " iterations: " << sparse.getSolution(9) << std::endl;
+
+    sparse.setInteger(0);
+    sparse.setInteger(1);
+    sparse.setColumnBounds(0, 0, 10);
+    sparse.setColumnBounds(1, 0, 10);
+    sparse.resolve();
+    sparse.branchAndBound(ClpWrapper::DefaultMaximumNodes);
+    std::cout << "Integer solution in " << sparse.nodes() << " nodes: " << sparse.getSolution(9) << std::endl;
+
     for (int k = 1; k < argc; ++k)
     {
         const auto problemFile = std::string(argv[k]);
@@ -74,6 +210,14 @@ int main(int argc, char * argv[])
         std::cout << "Problem: " << problemFile << std::endl;
         std::cout << "Solution: " << solution << std::endl;
     }
+
+    if (argc > 1)
+    {
+        ClpWrapper batch;
+        batch.solveBatch(std::vector<std::string>(argv + 1, argv + argc), 9);
+        for (int k = 1; k < argc; ++k)
+            std::cout << "Batch solve of " << argv[k] << ": " << batch.batchTimings()[k - 1] << " ms" << std::endl;
+    }
     return 0;
 }
 #endif
@@ -0,0 +1,144 @@
+#include "ClpWrapper.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// clp-stress [data directory] [models] [threads]
+//
+// Solves the same set of models sequentially and then concurrently, every thread on its own
+// ClpWrapper, and fails if any concurrent result differs from the sequential one. Guards the
+// reentrancy of libclp: state shared between models would show up as a different result.
+
+namespace
+{
+// Small LCG so the generated models do not depend on the random state under test
+class Generator
+{
+public:
+    explicit Generator(uint32_t seed) : _state(seed) {}
+
+    int next(int range)
+    {
+        _state = 1664525u * _state + 1013904223u;
+        return static_cast<int>((_state >> 8) % static_cast<uint32_t>(range));
+    }
+
+private:
+    uint32_t _state;
+};
+
+// Production planning model: maximize profit over products sharing resources, every third one
+// with integer production amounts so branch and bound is exercised as well
+std::string generateModel(int index)
+{
+    Generator random(index + 1);
+    const auto products = 4 + random.next(12);
+    const auto resources = 3 + random.next(8);
+    std::ostringstream lp;
+    lp << "Maximize\n obj:";
+    for (int j = 0; j < products; ++j)
+        lp << " + " << 1 + random.next(40) << " x" << j;
+    lp << "\nSubject To\n";
+    for (int i = 0; i < resources; ++i)
+    {
+        lp << " r" << i << ":";
+        for (int j = 0; j < products; ++j)
+        {
+            // every row uses product i at least
+            if (j == i % products || random.next(3))
+                lp << " + " << 1 + random.next(9) << "." << random.next(10) << " x" << j;
+        }
+        lp << " <= " << 50 + random.next(500) << "\n";
+    }
+    lp << "Bounds\n";
+    for (int j = 0; j < products; ++j)
+        lp << " 0 <= x" << j << " <= " << 5 + random.next(60) << "\n";
+    if (index % 3 == 0)
+    {
+        lp << "Generals\n";
+        for (int j = 0; j < products; ++j)
+            lp << " x" << j << "\n";
+    }
+    lp << "End\n";
+    return lp.str();
+}
+
+std::string readFile(const std::string & path)
+{
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    const std::string dataDirectory = argc > 1 ? argv[1] : "tests/data";
+    const auto generated = argc > 2 ? std::atoi(argv[2]) : 200;
+    const auto threadCount = argc > 3 ? std::atoi(argv[3]) : 8;
+    constexpr int precision = 9;
+
+    std::vector<std::string> models;
+    std::error_code error;
+    for (const auto & entry : std::filesystem::directory_iterator(dataDirectory, error))
+    {
+        // diet_large alone takes longer than all the others together
+        const auto & path = entry.path();
+        if (path.extension() == ".lp" && path.stem() != "diet_large")
+            models.push_back(readFile(path.string()));
+    }
+    for (int i = 0; i < generated; ++i)
+        models.push_back(generateModel(i));
+
+    std::vector<std::string> expected(models.size());
+    {
+        ClpWrapper wrapper;
+        wrapper.setLogLevel(0);
+        for (size_t i = 0; i < models.size(); ++i)
+        {
+            expected[i] = wrapper.solve(models[i], precision);
+            if (expected[i].empty())
+            {
+                std::cerr << "Model " << i << " could not be read" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // twice, the second time with the models dealt the other way round, so every wrapper sees a
+    // different sequence of models than in the first round
+    std::atomic<int> mismatches { 0 };
+    for (int round = 0; round < 2; ++round)
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t] {
+                ClpWrapper wrapper;
+                wrapper.setLogLevel(0);
+                for (size_t k = t; k < models.size(); k += threadCount)
+                {
+                    const auto i = round == 0 ? k : models.size() - 1 - k;
+                    if (wrapper.solve(models[i], precision) != expected[i])
+                    {
+                        ++mismatches;
+                        std::cerr << "Model " << i << " differs in round " << round << std::endl;
+                    }
+                }
+            });
+        }
+        for (auto & thread : threads)
+            thread.join();
+    }
+
+    std::cout << models.size() << " models, " << threadCount << " threads, " << mismatches << " mismatches"
+              << std::endl;
+    return mismatches ? 1 : 0;
+}
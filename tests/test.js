@@ -88,11 +88,26 @@ describe("clp-wasm test suite", () => {
     }
   });
 
+  test("mixed precision solve matches the direct solve", () => {
+    for (const fileName of ['diet_large', 'lp', 'tinlake', 'big_numbers']) {
+      const lpContent = fs.readFileSync(`${__dirname}/data/${fileName}.lp`, "utf8");
+      const expected = solver.solve(lpContent);
+      const result = solver.solveMixed(lpContent, 9, solver);
+      expect(result.solution).toMatchObject(expected.solution);
+      expect(result.objectiveValue).toBe(expected.objectiveValue);
+    }
+  });
+
   test("get CLP version", () => {
     const version = solver.version();
     expect(version).toBe("1.17.3");
   });
 
+  test("default bundle uses the 100 digit engine", () => {
+    expect(solver.engine()).toBe("dec100");
+    expect(solver.setThreads(4)).toBe(1); // single threaded module
+  });
+
   test("ClpWrapper object: readLp", () => {
     const lpContent = fs.readFileSync(`${__dirname}/data/lp.lp`, "utf8");
     const lpBench = fs.readFileSync(`${__dirname}/bench/lp.json`, "utf8");
@@ -142,6 +157,288 @@ describe("clp-wasm test suite", () => {
     clp.delete();
   });
 
+  test("ClpWrapper loadProblemSparse and loadProblemCSC", () => {
+    const InfU = +Number.MAX_VALUE;
+    const InfL = -Number.MAX_VALUE;
+    const loaders = [
+      (clp) => clp.loadProblemSparse([-0.6, -0.5], [InfL, InfL], [InfU, InfU], [InfL, InfL], [1, 2], [0, 0, 1, 1], [0, 1, 0, 1], [1, 2, 3, 1]),
+      (clp) => clp.loadProblemCSC([-0.6, -0.5], [InfL, InfL], [InfU, InfU], [InfL, InfL], [1, 2], [0, 2, 4], [0, 1, 0, 1], [1, 3, 2, 1]),
+    ];
+    for (const load of loaders) {
+      const clp = new solver.ClpWrapper();
+      expect(load(clp)).toBeTruthy();
+      clp.primal();
+      const solution = clp.getSolutionArray(1);
+      expect(solution[0]).toBe("0.6");
+      expect(solution[1]).toBe("0.2");
+      clp.delete();
+    }
+    const clp = new solver.ClpWrapper();
+    expect(clp.loadProblemSparse([1], [0], [1], [0], [1], [2], [0], [1])).toBeFalsy();
+    clp.delete();
+  });
+
+  test("ClpWrapper loads typed arrays and packed decimal strings", () => {
+    const InfU = +Number.MAX_VALUE;
+    const InfL = -Number.MAX_VALUE;
+    const clp = new solver.ClpWrapper();
+    const success = clp.loadProblemCSC(new Float64Array([-10000, -1000, -100000, -1000000]),
+      new Float64Array([0, 0, 0, 0]),
+      "200000000000000000000 400000000000000000000 100000000000000000000 300000000000000000000",
+      new Float64Array([-200000000000000000000, InfL, -5e46, 0]),
+      new Float64Array([InfU, 9800000000000000000000, InfU, InfU]),
+      new Int32Array([0, 4, 8, 12, 16]),
+      new Int32Array([0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3]),
+      "1 1 850000000000000000000000000 -800000000000000000000000000 " +
+      "1 1 -150000000000000000000000000 200000000000000000000000000 " +
+      "-1 -1 -850000000000000000000000000 800000000000000000000000000 " +
+      "-1 -1 150000000000000000000000000 -200000000000000000000000000");
+    expect(success).toBeTruthy();
+    clp.primal();
+    const expected = ["125000000000000000000.0", "400000000000000000000.0", "100000000000000000000.0", "300000000000000000000.0"];
+    expect(clp.getSolutionArray(0)).toMatchObject(expected);
+    clp.delete();
+  });
+
+  test("ClpWrapper typed array results", () => {
+    const lpContent = fs.readFileSync(`${__dirname}/data/lp.lp`, "utf8");
+    const clp = new solver.ClpWrapper();
+    clp.readLp(lpContent);
+    clp.primal();
+    const solution = clp.getValues(solver.SolutionVector.SOLUTION).slice();
+    expect(solution).toBeInstanceOf(Float64Array);
+    expect(almostEq(solution[0], 0.6, 1e-9)).toBeTruthy();
+    expect(almostEq(solution[1], 0.2, 1e-9)).toBeTruthy();
+    expect(clp.getValues(solver.SolutionVector.DUALS).length).toBe(2);
+    expect(clp.getDecimals(solver.SolutionVector.SOLUTION, 1)).toBe("0.6 0.2");
+    expect(clp.getColumnNames()).toMatchObject(["x1", "x2"]);
+    expect(clp.getRowNames()).toMatchObject(["cons1", "cons2"]);
+    clp.delete();
+  });
+
+  test("ClpWrapper warm-start resolve after bound and objective changes", () => {
+    const clp = new solver.ClpWrapper();
+    const InfU = +Number.MAX_VALUE;
+    const InfL = -Number.MAX_VALUE;
+    clp.loadProblem([-0.6, -0.5], [InfL, InfL], [InfU, InfU], [InfL, InfL], [1, 2], [1, 2, 3, 1]);
+    clp.primal();
+    expect(clp.setRowBounds(1, InfL, 1.5)).toBeTruthy();
+    expect(clp.resolve()).toBe(0);
+    expect(clp.getSolutionArray(1)).toMatchObject(["0.4", "0.3"]);
+    expect(clp.setObjectiveCoefficient(0, -0.5)).toBeTruthy();
+    expect(clp.resolve()).toBe(0);
+    expect(JSON.parse(clp.getSolution(2)).objectiveValue).toBe("-0.35");
+    expect(clp.setColumnBounds(5, 0, 1)).toBeFalsy();
+    clp.delete();
+  });
+
+  test("branch and bound on models with integer columns", () => {
+    const mip = solver.solve(fs.readFileSync(`${__dirname}/data/mip.lp`, "utf8"), 2);
+    expect(mip.integerSolution).toBe(true);
+    expect(mip.solution).toMatchObject(["40.00", "10.50", "19.50", "3.00"]);
+    expect(mip.objectiveValue).toBe("122.50");
+
+    const mip2 = solver.solve(fs.readFileSync(`${__dirname}/data/mip2.lp`, "utf8"), 4);
+    expect(mip2.integerSolution).toBe(true);
+    expect(mip2.solution.slice(2)).toMatchObject(["1.0000", "0.0000"]);
+    expect(mip2.objectiveValue).toBe("-8.2333");
+
+    const clp = new solver.ClpWrapper();
+    clp.loadProblem([-0.6, -0.5], [0, 0], [10, 10], [-Number.MAX_VALUE, -Number.MAX_VALUE], [4, 6], [1, 2, 3, 1]);
+    clp.setInteger(0);
+    clp.setInteger(1);
+    expect(clp.hasIntegers()).toBe(true);
+    clp.primal();
+    expect(clp.branchAndBound(1000)).toBe(true);
+    expect(clp.nodes()).toBeGreaterThan(0);
+    expect(clp.status()).toBe(0);
+    expect(clp.getSolutionArray(1)).toMatchObject(["2.0", "0.0"]);
+    clp.delete();
+  });
+
+  test("batch solve matches individual solves", () => {
+    const problems = ['lp', 'mip', 'tinlake', 'mip2', 'big_numbers'].map(
+      (fileName) => fs.readFileSync(`${__dirname}/data/${fileName}.lp`, "utf8"));
+    const InfL = -Number.MAX_VALUE;
+    problems.push({
+      objective: [-0.6, -0.5], columnLower: [0, 0], columnUpper: [10, 10], rowLower: [InfL, InfL], rowUpper: [1, 2],
+      starts: [0, 2, 4], rows: [0, 1, 0, 1], values: [1, 3, 2, 1]
+    });
+    problems.push(Object.assign({}, problems[5], { starts: [0, 2] })); // too few column starts
+
+    const batch = solver.solveBatch(problems, 9);
+    expect(batch.results.length).toBe(problems.length);
+    expect(batch.timings.length).toBe(problems.length);
+    for (let i = 0; i < 5; ++i) {
+      expect(batch.results[i]).toMatchObject(solver.solve(problems[i], 9));
+    }
+    expect(batch.results[5].solution).toMatchObject(["0.600000000", "0.200000000"]);
+    expect(batch.results[6]).toBeNull();
+  });
+
+  test("ClpWrapper parses LP text fed in chunks", () => {
+    const lp = fs.readFileSync(`${__dirname}/data/tinlake.lp`, "utf8");
+    const clp = new solver.ClpWrapper();
+    expect(clp.feed(lp)).toBe(false); // no session open
+    clp.beginParse();
+    for (let i = 0; i < lp.length; i += 37) {
+      expect(clp.feed(lp.slice(i, i + 37))).toBe(true);
+    }
+    expect(clp.finish()).toBe(true);
+    clp.primal();
+    expect(JSON.parse(clp.getSolution(9))).toMatchObject(solver.solve(lp, 9));
+
+    clp.beginParse();
+    clp.feed(lp.slice(0, lp.length / 2));
+    expect(clp.finish()).toBe(false);
+    expect(clp.readLp("this is not an LP problem")).toBe(false);
+    clp.delete();
+  });
+
+  test("ClpWrapper solution cache", () => {
+    const lp = fs.readFileSync(`${__dirname}/data/tinlake.lp`, "utf8");
+    const clp = new solver.ClpWrapper();
+    clp.setCacheLimit(1 << 20);
+    const first = clp.solve(lp, 9);
+    expect(clp.solve(lp.replace(/tinInvest/g, "tin"), 9)).toBe(first.replace(/tinInvest/g, "tin"));
+    expect(clp.iterations()).toBe(0);
+    clp.solve(lp.replace("<= 9800", "<= 9700"), 9);
+    expect(JSON.parse(clp.cacheStats())).toMatchObject({ hits: 1, warmStarts: 1, misses: 1, entries: 2 });
+    clp.setCacheLimit(0);
+    expect(JSON.parse(clp.cacheStats()).entries).toBe(0);
+    clp.delete();
+  });
+
+  test("worker pool solves independent problems", async () => {
+    const ClpPool = require("../clp-wasm.pool.js");
+    const pool = new ClpPool({ workers: 2 });
+    await pool.ready;
+    const problems = ['lp', 'tinlake', 'mip', 'diet_large'].map(
+      (fileName) => fs.readFileSync(`${__dirname}/data/${fileName}.lp`, "utf8"));
+    const results = await Promise.all(problems.map(
+      (lp, i) => pool.solve(i % 2 ? new TextEncoder().encode(lp) : lp, { priority: i })));
+    for (let i = 0; i < problems.length; ++i) {
+      expect(results[i]).toMatchObject(solver.solve(problems[i]));
+    }
+
+    const controller = new AbortController();
+    const cancelled = pool.solve(problems[3], { signal: controller.signal });
+    controller.abort();
+    await expect(cancelled).rejects.toThrow("cancelled");
+    expect(await pool.solve(problems[1])).toMatchObject(solver.solve(problems[1]));
+    const limited = await pool.solve(problems[3], { timeLimit: 0.05 });
+    expect(limited.stopReason).toBe("time");
+    pool.terminate();
+  });
+
+  test("ClpWrapper ranging", () => {
+    const clp = new solver.ClpWrapper();
+    clp.readLp(fs.readFileSync(`${__dirname}/data/tinlake.lp`, "utf8"));
+    clp.primal();
+    expect(JSON.parse(clp.ranging([0, 1, 4], 6))).toEqual({
+      sequences: [0, 1, 4],
+      costIncrease: ["3990000.000000", "Infinity", "798000.000000"],
+      costIncreaseSequence: [3, -1, 3],
+      costDecrease: ["10000.000000", "3500.000000", "2800.000000"],
+      costDecreaseSequence: [7, 1, 1],
+      valueIncrease: ["125.000000", "300.000000", "325.000000"],
+      valueIncreaseSequence: [0, 0, 4],
+      valueDecrease: ["75.000000", "260.000000", "Infinity"],
+      valueDecreaseSequence: [0, 4, 4],
+    });
+    const all = JSON.parse(clp.ranging(undefined, 6));
+    expect(all.sequences).toEqual([0, 1, 2, 3, 4, 5, 6, 7]);
+    expect(all.costIncrease[4]).toBe("798000.000000");
+    expect(clp.ranging([8], 6)).toBe("");
+
+    clp.solve(fs.readFileSync(`${__dirname}/data/mip.lp`, "utf8"), 6);
+    expect(clp.ranging(undefined, 6)).toBe("");
+    clp.delete();
+  });
+
+  test("ClpWrapper solves through ClpSolve with presolve", () => {
+    const lp = fs.readFileSync(`${__dirname}/data/tinlake.lp`, "utf8");
+    const clp = new solver.ClpWrapper();
+    expect(clp.setSolveOptions({ method: "simplex" })).toBe(false);
+    expect(clp.setSolveOptions({ method: "dual", passes: -1 })).toBe(false);
+    expect(JSON.parse(clp.solve(lp, 6)).phases).toBeUndefined();
+    for (const method of ["auto", "dual", "primal", "sprint", "barrier"]) {
+      expect(clp.setSolveOptions({ method, passes: 5 })).toBe(true);
+      const result = JSON.parse(clp.solve(lp, 6));
+      expect(clp.status()).toBe(0);
+      expect(result.objectiveValue).toBe("311650000.000000");
+      expect(result.solution).toEqual(["125.000000", "400.000000", "100.000000", "300.000000"]);
+      expect(Object.keys(result.phases)).toEqual(["presolveMs", "solveMs", "postsolveMs", "cleanupMs",
+        "branchAndBoundMs", "presolvedRows", "presolvedColumns"]);
+      expect(result.phases.presolvedRows).toBe(3);
+    }
+    clp.setSolveOptions({ method: "dual", presolve: false });
+    const phases = JSON.parse(clp.solve(lp, 6)).phases;
+    expect(phases.presolvedRows).toBe(4);
+    expect(phases.postsolveMs).toBe(0);
+
+    clp.setSolveOptions({ method: "auto" });
+    const mip = JSON.parse(clp.solve(fs.readFileSync(`${__dirname}/data/mip.lp`, "utf8"), 6));
+    expect(mip.integerSolution).toBe(true);
+    expect(mip.objectiveValue).toBe("122.500000");
+    expect(mip.phases.branchAndBoundMs).toBeGreaterThan(0);
+    clp.delete();
+  });
+
+  test("ClpWrapper reports solver statistics", () => {
+    const lp = fs.readFileSync(`${__dirname}/data/tinlake.lp`, "utf8");
+    const clp = new solver.ClpWrapper();
+    expect(JSON.parse(clp.solve(lp, 6)).stats).toBeUndefined();
+    expect(clp.setSolveOptions({ stats: true })).toBe(true);
+    const stats = JSON.parse(clp.solve(lp, 6)).stats;
+    expect(Object.keys(stats)).toEqual(["primalPhase1Iterations", "primalPhase2Iterations", "dualIterations",
+      "barrierIterations", "factorizations", "lElements", "uElements", "factorizeMs", "ftranMs", "ftrans",
+      "btranMs", "btrans", "pricingMs", "ratioTestMs", "rowsRemoved", "columnsRemoved", "peakMemoryBytes"]);
+    expect(stats.primalPhase1Iterations + stats.primalPhase2Iterations).toBe(clp.iterations());
+    expect(stats.dualIterations).toBe(0);
+    expect(stats.factorizations).toBeGreaterThan(0);
+    expect(stats.uElements).toBeGreaterThan(0);
+    expect(stats.ftrans).toBeGreaterThan(0);
+    expect(stats.pricingMs).toBeGreaterThan(0);
+    expect(stats.rowsRemoved).toBe(0);
+    expect(stats.peakMemoryBytes).toBeGreaterThan(0);
+
+    clp.setSolveOptions({ method: "dual", stats: true });
+    const result = JSON.parse(clp.solve(lp, 6));
+    expect(result.phases.presolvedRows).toBe(3);
+    expect(result.stats.dualIterations).toBe(clp.iterations());
+    expect(result.stats.rowsRemoved).toBe(1);
+    expect(result.stats.columnsRemoved).toBe(0);
+    clp.delete();
+  });
+
+  test("ClpWrapper stops on limits and cancellation", () => {
+    const lp = fs.readFileSync(`${__dirname}/data/diet_large.lp`, "utf8");
+    const clp = new solver.ClpWrapper();
+    clp.setIterationLimit(10);
+    clp.readLp(lp);
+    clp.primal();
+    expect(clp.status()).toBe(3);
+    expect(clp.stopReason()).toBe("iterations");
+    expect(clp.iterations()).toBe(10);
+
+    clp.setIterationLimit(0);
+    clp.setTimeLimit(0.05);
+    expect(JSON.parse(clp.solve(lp, 9)).solution.length).toBeGreaterThan(0);
+    expect(clp.status()).toBe(3);
+    expect(clp.stopReason()).toBe("time");
+
+    clp.setTimeLimit(0);
+    clp.cancel();
+    clp.readLp(lp);
+    clp.primal();
+    expect(clp.status()).toBe(5);
+    expect(clp.stopReason()).toBe("cancelled");
+    expect(clp.resolve()).toBe(0);
+    expect(clp.stopReason()).toBe("");
+    clp.delete();
+  });
+
   test("ClpWrapper object: tinlake problem small", () => {
     const clp = new solver.ClpWrapper();
     const InfU = +Number.MAX_VALUE;
@@ -194,3 +491,39 @@ describe("clp-wasm test suite", () => {
   });
 });
 
+
+// Native addon, tested when the x64 build (./build.sh release x64) produced it
+const addonPath = `${__dirname}/../build_x64_release/clp-node.node`;
+(fs.existsSync(addonPath) ? describe : describe.skip)("clp-node native addon", () => {
+  let addon = null;
+  let wasm = null;
+
+  beforeAll(async () => {
+    addon = require(addonPath);
+    wasm = await require("../clp-wasm.all");
+  });
+
+  test("solves like the WASM module", async () => {
+    for (const fileName of ['lp', 'tinlake', 'mip', 'big_numbers']) {
+      const lp = fs.readFileSync(`${__dirname}/data/${fileName}.lp`, "utf8");
+      const expected = wasm.solve(lp, 9);
+      expect(JSON.parse(addon.solve(lp, 9))).toMatchObject(expected);
+      expect(JSON.parse(await addon.solveAsync(lp, 9))).toMatchObject(expected);
+    }
+    expect(addon.engine()).toBe(wasm.engine());
+    expect(addon.bnRound("12345678901234567890.5")).toBe(wasm.bnRound("12345678901234567890.5"));
+  });
+
+  test("ClpWrapper asynchronous calls", async () => {
+    const lp = fs.readFileSync(`${__dirname}/data/diet_large.lp`, "utf8");
+    const wrapper = new addon.ClpWrapper();
+    const pending = wrapper.solveAsync(lp, 9);
+    expect(() => wrapper.iterations()).toThrow("busy");
+    expect(JSON.parse(await pending).objectiveValue).toBe(wasm.solve(lp, 9).objectiveValue);
+
+    const batch = await wrapper.solveBatchAsync([lp, { objective: [1] }], 9);
+    expect(JSON.parse(batch.results)[1]).toBeNull();
+    expect(batch.timings.length).toBe(2);
+    expect(wrapper.getValues(addon.SolutionVector.DUALS)).toBeInstanceOf(Float64Array);
+  });
+});